@@ -0,0 +1,259 @@
+// Host microbenchmarks of the DSP core - built by env:native on lib/hal_native:
+//     pio run -e native -t exec                  (table)
+//     .pio/build/native/program --tsv > new.tsv  (machine-readable)
+//     python scripts/bench_compare.py old.tsv new.tsv
+//
+// Every case reports ns per sample and samples per second. A sample is one output sample
+// at SAMPLE_RATE, except update_pots, where it is one call, and morph, where it is one
+// step. Each case repeats until a run takes BENCH_MIN_MS and keeps the best of BENCH_RUNS
+// runs, which filters out scheduler noise. --tsv prints a header and then one row per
+// case, with stable case names:
+//     case <TAB> samples <TAB> ns_per_sample <TAB> samples_per_s
+
+#include "hal_native.h"
+#include "potentiometers/adc_potentiometer.h"
+#include "wavegen/audio_engine.h"
+#include "wavegen/morph.h"
+#include "wavegen/presets.h"
+#include "wavegen/pwm_audio.h"
+#include "wavegen/render_cache.h"
+#include "wavegen/waveform_gen.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef PIO_UNIT_TESTING // The test runner brings its own main()
+
+#define BENCH_MIN_MS 20
+#define BENCH_RUNS 5
+#define BENCH_LEN 22050    // Samples per render for the waveform cases (1 s)
+#define PREVIEW_SPAN 8192  // As main.c
+#define PREVIEW_POINTS 298 // LCD_PLOT_POINTS
+
+static const char* const wave_names[] = {"sine", "square", "triangle", "saw", "noise"};
+
+static bool tsv;
+static int min_ms = BENCH_MIN_MS;
+static int runs = BENCH_RUNS;
+
+static uint16_t pwm_buf[BENCH_LEN];
+static float float_buf[BENCH_LEN];
+static int16_t preview_osc[PREVIEW_SPAN];
+static int16_t preview_filtered[PREVIEW_SPAN];
+static int16_t preview_shaped[PREVIEW_SPAN];
+
+typedef int (*BenchFn)(void* ctx); // One call; returns the samples it produced
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000u + (uint64_t) ts.tv_nsec;
+}
+
+static void report(const char* name, long samples, double ns_per_sample) {
+    if (tsv) {
+        printf("%s\t%ld\t%.3f\t%.0f\n", name, samples, ns_per_sample, 1e9 / ns_per_sample);
+    } else {
+        printf("%-34s %10.2f ns/sample %14.0f samples/s\n", name, ns_per_sample,
+               1e9 / ns_per_sample);
+    }
+}
+
+static void bench(const char* name, BenchFn fn, void* ctx) {
+    double best = INFINITY;
+    long samples = 0;
+
+    for (int run = 0; run < runs; run++) {
+        uint64_t start = now_ns();
+        uint64_t elapsed;
+        samples = 0;
+        do {
+            samples += fn(ctx);
+            elapsed = now_ns() - start;
+        } while (elapsed < (uint64_t) min_ms * 1000000u);
+        if ((double) elapsed / samples < best)
+            best = (double) elapsed / samples;
+    }
+    report(name, samples, best);
+}
+
+// ==================================================
+// CASES
+// ==================================================
+typedef struct {
+    WaveParams params;
+    WaveKernel kernel;
+    int len;
+} RenderCase;
+
+static int run_generate_pwm(void* ctx) {
+    RenderCase* c = ctx;
+    waveform_set_kernel(c->kernel);
+    waveform_generate_pwm(pwm_buf, c->len, &c->params);
+    return c->len;
+}
+
+static int run_convert(void* ctx) {
+    (void) ctx;
+    convert_float_to_pwm(float_buf, pwm_buf, BENCH_LEN);
+    return BENCH_LEN;
+}
+
+// Pot sweeping back and forth, so every call is past the change threshold and writes
+static int run_update_pots(void* ctx) {
+    WaveParams* p = ctx;
+    static uint32_t step;
+
+    for (int i = 0; i < 256; i++, step += 97) {
+        uint32_t phase = step % 8190;
+        raw_adc_val = (phase < 4095) ? phase : 8190 - phase;
+        update_pots(p);
+    }
+    return 256;
+}
+
+// One sound through the whole engine (mix, fx, quantizer), the DMA ring played out by the
+// HAL until the stream stops. With flush set the render cache is emptied first, so each
+// hit is a miss: the voice synthesizes and the sound is also rendered into the cache, as
+// on a first hit. Otherwise it plays back from its cached render.
+typedef struct {
+    const WaveParams* params;
+    bool flush;
+} EngineCase;
+
+static int run_engine(void* ctx) {
+    EngineCase* c = ctx;
+    int slots = 0;
+    int n;
+
+    if (c->flush)
+        render_cache_init();
+    audio_engine_play(c->params);
+    while ((n = hal_native_dma_drain(NULL, 0)) > 0) {
+        slots += n;
+    }
+    return slots / AUDIO_OVERSAMPLE;
+}
+
+// Pot sweeping the morph slot end to end, one position per call. preview is what the UI
+// redraws per step (stage cache, only the stages the step dirties); otherwise each step is
+// a whole waveform_generate_pwm render, as before the stage cache.
+typedef struct {
+    MorphPath path;
+    WaveStageCache preview;
+    bool full;
+    int step;
+} MorphCase;
+
+static int run_morph(void* ctx) {
+    MorphCase* c = ctx;
+    WaveParams p;
+
+    c->step = (c->step + 1) % MORPH_POSITIONS;
+    morph_at(&c->path, (float) c->step / (MORPH_POSITIONS - 1), &p);
+    if (c->full) {
+        waveform_generate_pwm(pwm_buf, BENCH_LEN, &p);
+    } else {
+        waveform_render_preview(&c->preview, pwm_buf, PREVIEW_POINTS, &p);
+    }
+    return 1;
+}
+
+static void bench_morph(const char* name, const WaveParams* points, int count, bool full) {
+    static MorphCase c;
+    morph_init(&c.path, points, count);
+    waveform_stages_init(&c.preview, preview_osc, preview_filtered, preview_shaped,
+                         PREVIEW_SPAN);
+    c.full = full;
+    c.step = 0;
+    bench(name, run_morph, &c);
+}
+
+// Reference sound for the per-waveform cases: mid pitch with a little of every stage
+static const WaveParams reference = {.frequency = 220.0f,
+                                     .amplitude = 0.8f,
+                                     .decay = 1.0f,
+                                     .pitch_decay = 2.0f,
+                                     .noise_mix = 0.1f,
+                                     .env_curve = 4.0f,
+                                     .comp_amount = 0.3f};
+
+int main(int argc, char** argv) {
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--tsv")) {
+            tsv = true;
+        } else if (!strcmp(argv[i], "--quick")) {
+            min_ms = 2;
+            runs = 2;
+        } else {
+            fprintf(stderr, "usage: %s [--tsv] [--quick]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (tsv)
+        printf("case\tsamples\tns_per_sample\tsamples_per_s\n");
+
+    char name[64];
+    static const struct {
+        const char* name;
+        WaveKernel kernel;
+    } kernels[] = {{"fixed", WAVE_KERNEL_FIXED}, {"float", WAVE_KERNEL_FLOAT}};
+
+    for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++) {
+        for (int w = 0; w < 5; w++) {
+            RenderCase c = {reference, kernels[k].kernel, BENCH_LEN};
+            c.params.waveform_id = w;
+            snprintf(name, sizeof(name), "generate_pwm/%s/%s", kernels[k].name, wave_names[w]);
+            bench(name, run_generate_pwm, &c);
+        }
+        for (int p = 0; p < num_presets; p++) {
+            RenderCase c = {drum_presets[p], kernels[k].kernel, 0};
+            c.len = (int) ((c.params.env_attack + c.params.env_hold + c.params.decay) *
+                           SAMPLE_RATE);
+            c.len = (c.len < 1) ? 1 : (c.len > BENCH_LEN) ? BENCH_LEN : c.len;
+            snprintf(name, sizeof(name), "generate_pwm/%s/preset%d", kernels[k].name, p);
+            bench(name, run_generate_pwm, &c);
+        }
+    }
+    waveform_set_kernel(WAVEGEN_KERNEL_DEFAULT);
+
+    for (int i = 0; i < BENCH_LEN; i++) {
+        float_buf[i] = 1.1f * sinf(i * 0.05f); // Some of it past full scale, to hit the clamp
+    }
+    bench("convert_float_to_pwm", run_convert, NULL);
+
+    WaveParams pots = drum_presets[0];
+    for (int i = 0; i < PARAM_NUM; i++) {
+        idx = i;
+        pot_engaged[i] = true;
+        snprintf(name, sizeof(name), "update_pots/param%d", i);
+        bench(name, run_update_pots, &pots);
+    }
+
+    // Across all the presets every step re-runs the oscillator; a kick getting longer and
+    // quieter only moves envelope and post params, so the cached oscillator is reused
+    WaveParams long_kick[2] = {drum_presets[0], drum_presets[0]};
+    long_kick[1].decay = 1.0f;
+    long_kick[1].amplitude = 0.5f;
+    long_kick[1].env_curve = 2.0f;
+    bench_morph("morph/preview/presets", drum_presets, num_presets, false);
+    bench_morph("morph/preview/kick_decay", long_kick, 2, false);
+    bench_morph("morph/generate_pwm/presets", drum_presets, num_presets, true);
+    bench_morph("morph/generate_pwm/kick_decay", long_kick, 2, true);
+
+    pwm_audio_init();
+    audio_engine_init();
+    for (int p = 0; p < num_presets; p++) {
+        EngineCase miss = {&drum_presets[p], true};
+        EngineCase hit = {&drum_presets[p], false};
+        snprintf(name, sizeof(name), "engine/miss/preset%d", p);
+        bench(name, run_engine, &miss);
+        snprintf(name, sizeof(name), "engine/hit/preset%d", p);
+        bench(name, run_engine, &hit);
+    }
+
+    return 0;
+}
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef HAL_NATIVE_H
+#define HAL_NATIVE_H
+
+#include <stdint.h>
+
+// Host build of the firmware (env:native). The pico/ and hardware/ headers next to this
+// one declare the subset of the pico-sdk the sources call, and hal_native.c implements it
+// on the host: time from the monotonic clock, flash as a RAM image (erased and programmed
+// as NOR flash would be), and the DMA channels as plain records that hal_native_dma_drain()
+// plays out. Register writes land in dummy structs and everything else is a no-op, so the
+// audio path runs unchanged, with the caller standing in for the DMA/PWM hardware.
+
+#define HAL_NATIVE_SYS_HZ 150000000u              // clk_sys as the firmware runs it
+#define HAL_NATIVE_FLASH_BYTES (4u * 1024 * 1024) // Image behind XIP_BASE (zeroed: no bank)
+
+extern uint8_t hal_native_flash[HAL_NATIVE_FLASH_BYTES];
+
+// Finishes the transfer on the running DMA channel as the hardware would: its 16-bit
+// words are copied to out (up to max, out may be NULL), the chained channel starts and
+// DMA_IRQ_0 runs if the channel raises it. Returns the words transferred, 0 when no
+// channel is running (the stream has stopped).
+int hal_native_dma_drain(uint16_t* out, int max);
+
+// Power cut for flash tests: the next n flash_safe_execute() calls run, and every one after
+// that fails with PICO_ERROR_TIMEOUT without touching flash. n < 0 turns it off (default).
+void hal_native_flash_fail_after(int n);
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef HAL_NATIVE_HARDWARE_ADC_H
+#define HAL_NATIVE_HARDWARE_ADC_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct {
+    volatile uint32_t cs, result, fcs, fifo, div;
+} adc_hw_t;
+
+extern adc_hw_t* adc_hw;
+
+#define ADC_FCS_EN_BITS 0x00000001u
+#define ADC_FCS_DREQ_EN_BITS 0x00000008u
+
+void adc_init(void);
+void adc_gpio_init(unsigned gpio);
+void adc_select_input(unsigned input);
+void adc_run(bool run);
+
+#endif
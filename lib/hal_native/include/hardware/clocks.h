@@ -0,0 +1,10 @@
+#ifndef HAL_NATIVE_HARDWARE_CLOCKS_H
+#define HAL_NATIVE_HARDWARE_CLOCKS_H
+
+#include <stdint.h>
+
+enum clock_index { clk_ref, clk_sys, clk_peri, clk_usb, clk_adc };
+
+uint32_t clock_get_hz(enum clock_index clk_index); // HAL_NATIVE_SYS_HZ for clk_sys
+
+#endif
@@ -0,0 +1,46 @@
+#ifndef HAL_NATIVE_HARDWARE_DMA_H
+#define HAL_NATIVE_HARDWARE_DMA_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define NUM_DMA_CHANNELS 16
+
+enum dma_channel_transfer_size { DMA_SIZE_8 = 0, DMA_SIZE_16 = 1, DMA_SIZE_32 = 2 };
+enum { DREQ_ADC = 48 };
+
+// Only what hal_native_dma_drain() needs to play a channel out
+typedef struct {
+    int size;
+    int chain_to;
+} dma_channel_config;
+
+typedef struct {
+    volatile uint32_t read_addr, write_addr, transfer_count, ctrl_trig;
+} dma_channel_hw_t;
+
+typedef struct {
+    dma_channel_hw_t ch[NUM_DMA_CHANNELS];
+} dma_hw_t;
+
+extern dma_hw_t* dma_hw; // Raw register pokes land here and are ignored
+
+int dma_claim_unused_channel(bool required);
+dma_channel_config dma_channel_get_default_config(unsigned channel);
+void channel_config_set_transfer_data_size(dma_channel_config* c,
+                                           enum dma_channel_transfer_size size);
+void channel_config_set_read_increment(dma_channel_config* c, bool incr);
+void channel_config_set_write_increment(dma_channel_config* c, bool incr);
+void channel_config_set_dreq(dma_channel_config* c, unsigned dreq);
+void channel_config_set_chain_to(dma_channel_config* c, unsigned chain_to);
+void dma_channel_configure(unsigned channel, const dma_channel_config* config,
+                           volatile void* write_addr, const volatile void* read_addr,
+                           uint32_t transfer_count, bool trigger);
+void dma_channel_set_read_addr(unsigned channel, const volatile void* read_addr, bool trigger);
+void dma_channel_start(unsigned channel);
+void dma_channel_abort(unsigned channel);
+void dma_channel_set_irq0_enabled(unsigned channel, bool enabled);
+bool dma_channel_get_irq0_status(unsigned channel);
+void dma_channel_acknowledge_irq0(unsigned channel);
+
+#endif
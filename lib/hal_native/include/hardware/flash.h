@@ -0,0 +1,15 @@
+#ifndef HAL_NATIVE_HARDWARE_FLASH_H
+#define HAL_NATIVE_HARDWARE_FLASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define FLASH_PAGE_SIZE (1u << 8)
+#define FLASH_SECTOR_SIZE (1u << 12)
+
+// On hal_native_flash, with NOR semantics: erase sets bytes to 0xFF, programming can only
+// clear bits. Offsets and counts must be page (program) or sector (erase) aligned.
+void flash_range_erase(uint32_t flash_offs, size_t count);
+void flash_range_program(uint32_t flash_offs, const uint8_t* data, size_t count);
+
+#endif
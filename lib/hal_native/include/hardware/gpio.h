@@ -0,0 +1,20 @@
+#ifndef HAL_NATIVE_HARDWARE_GPIO_H
+#define HAL_NATIVE_HARDWARE_GPIO_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+enum { GPIO_FUNC_SPI = 1, GPIO_FUNC_PWM = 4, GPIO_FUNC_SIO = 5 };
+enum { GPIO_IN = 0, GPIO_OUT = 1 };
+enum { GPIO_IRQ_EDGE_FALL = 4, GPIO_IRQ_EDGE_RISE = 8 };
+
+void gpio_init(unsigned gpio);
+void gpio_set_function(unsigned gpio, int fn);
+void gpio_set_dir(unsigned gpio, bool out);
+void gpio_put(unsigned gpio, bool value);
+uint32_t gpio_get_irq_event_mask(unsigned gpio);
+void gpio_acknowledge_irq(unsigned gpio, uint32_t event_mask);
+void gpio_add_raw_irq_handler_masked(uint64_t gpio_mask, void (*handler)(void));
+void gpio_set_irq_enabled(unsigned gpio, uint32_t event_mask, bool enabled);
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef HAL_NATIVE_HARDWARE_IRQ_H
+#define HAL_NATIVE_HARDWARE_IRQ_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+enum { DMA_IRQ_0 = 10, DMA_IRQ_1 = 11, IO_IRQ_BANK0 = 21, NUM_IRQS = 52 };
+
+#define PICO_HIGHEST_IRQ_PRIORITY 0
+#define PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY 0x80
+
+typedef void (*irq_handler_t)(void);
+
+void irq_set_exclusive_handler(unsigned num, irq_handler_t handler);
+void irq_set_enabled(unsigned num, bool enabled);
+void irq_set_priority(unsigned num, uint8_t hardware_priority);
+
+#endif
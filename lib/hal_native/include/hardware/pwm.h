@@ -0,0 +1,30 @@
+#ifndef HAL_NATIVE_HARDWARE_PWM_H
+#define HAL_NATIVE_HARDWARE_PWM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct {
+    uint32_t csr, div, top;
+} pwm_config;
+
+typedef struct {
+    volatile uint32_t csr, div, ctr, cc, top;
+} pwm_slice_hw_t;
+
+typedef struct {
+    pwm_slice_hw_t slice[12];
+} pwm_hw_t;
+
+extern pwm_hw_t* pwm_hw;
+
+pwm_config pwm_get_default_config(void);
+void pwm_config_set_clkdiv(pwm_config* c, float div);
+void pwm_config_set_wrap(pwm_config* c, uint16_t wrap);
+void pwm_init(unsigned slice_num, pwm_config* c, bool start);
+void pwm_set_chan_level(unsigned slice_num, unsigned chan, uint16_t level);
+unsigned pwm_gpio_to_slice_num(unsigned gpio);
+unsigned pwm_gpio_to_channel(unsigned gpio);
+unsigned pwm_get_dreq(unsigned slice_num);
+
+#endif
@@ -0,0 +1,17 @@
+#ifndef HAL_NATIVE_HARDWARE_SYNC_H
+#define HAL_NATIVE_HARDWARE_SYNC_H
+
+#include <stdint.h>
+
+// Interrupts only run from hal_native_dma_drain(), on the caller's thread
+static inline uint32_t save_and_disable_interrupts(void) {
+    return 0;
+}
+static inline void restore_interrupts(uint32_t status) {
+    (void) status;
+}
+static inline void __dmb(void) {
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+#endif
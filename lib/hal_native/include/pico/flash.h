@@ -0,0 +1,14 @@
+#ifndef HAL_NATIVE_PICO_FLASH_H
+#define HAL_NATIVE_PICO_FLASH_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define PICO_OK 0
+#define PICO_ERROR_TIMEOUT -1
+
+// There is no other core to park: func just runs
+int flash_safe_execute(void (*func)(void*), void* param, uint32_t enter_exit_timeout_ms);
+bool flash_safe_execute_core_init(void);
+
+#endif
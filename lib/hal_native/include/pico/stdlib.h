@@ -0,0 +1,35 @@
+#ifndef HAL_NATIVE_PICO_STDLIB_H
+#define HAL_NATIVE_PICO_STDLIB_H
+
+#include "hal_native.h"
+#include "hardware/gpio.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Memory placement has no meaning on the host
+#define __not_in_flash_func(f) f
+#define __time_critical_func(f) f
+#define __aligned(x) __attribute__((aligned(x)))
+#define count_of(a) (sizeof(a) / sizeof((a)[0]))
+
+// Both XIP windows read the same host flash image
+#define XIP_BASE ((uintptr_t) hal_native_flash)
+#define XIP_NOCACHE_NOALLOC_BASE ((uintptr_t) hal_native_flash)
+#define PICO_FLASH_SIZE_BYTES HAL_NATIVE_FLASH_BYTES
+
+typedef uint64_t absolute_time_t;
+
+bool stdio_init_all(void);
+uint64_t time_us_64(void);
+uint32_t time_us_32(void);
+absolute_time_t get_absolute_time(void);
+uint32_t to_ms_since_boot(absolute_time_t t);
+void sleep_us(uint64_t us);
+void sleep_ms(uint32_t ms);
+
+static inline void tight_loop_contents(void) {}
+static inline void __wfe(void) {}
+static inline void __sev(void) {}
+
+#endif
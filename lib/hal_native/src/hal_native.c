@@ -0,0 +1,335 @@
+#include "hal_native.h"
+#include "hardware/adc.h"
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/flash.h"
+#include "hardware/gpio.h"
+#include "hardware/irq.h"
+#include "hardware/pwm.h"
+#include "pico/flash.h"
+#include "pico/stdlib.h"
+#include <assert.h>
+#include <string.h>
+#include <time.h>
+
+uint8_t hal_native_flash[HAL_NATIVE_FLASH_BYTES];
+
+// ==================================================
+// TIME
+// ==================================================
+static uint64_t boot_ns;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000u + (uint64_t) ts.tv_nsec;
+}
+
+bool stdio_init_all(void) {
+    return true;
+}
+
+uint64_t time_us_64(void) {
+    if (!boot_ns)
+        boot_ns = now_ns();
+    return (now_ns() - boot_ns) / 1000u;
+}
+
+uint32_t time_us_32(void) {
+    return (uint32_t) time_us_64();
+}
+
+absolute_time_t get_absolute_time(void) {
+    return time_us_64();
+}
+
+uint32_t to_ms_since_boot(absolute_time_t t) {
+    return (uint32_t) (t / 1000u);
+}
+
+void sleep_us(uint64_t us) {
+    struct timespec ts = {(time_t) (us / 1000000u), (long) (us % 1000000u) * 1000};
+    nanosleep(&ts, NULL);
+}
+
+void sleep_ms(uint32_t ms) {
+    sleep_us((uint64_t) ms * 1000u);
+}
+
+uint32_t clock_get_hz(enum clock_index clk_index) {
+    return (clk_index == clk_sys) ? HAL_NATIVE_SYS_HZ : 48000000u;
+}
+
+// ==================================================
+// FLASH
+// ==================================================
+void flash_range_erase(uint32_t flash_offs, size_t count) {
+    assert(flash_offs % FLASH_SECTOR_SIZE == 0 && count % FLASH_SECTOR_SIZE == 0);
+    assert(flash_offs + count <= HAL_NATIVE_FLASH_BYTES);
+    memset(hal_native_flash + flash_offs, 0xFF, count);
+}
+
+void flash_range_program(uint32_t flash_offs, const uint8_t* data, size_t count) {
+    assert(flash_offs % FLASH_PAGE_SIZE == 0 && count % FLASH_PAGE_SIZE == 0);
+    assert(flash_offs + count <= HAL_NATIVE_FLASH_BYTES);
+    for (size_t i = 0; i < count; i++) {
+        hal_native_flash[flash_offs + i] &= data[i];
+    }
+}
+
+static int flash_calls_left = -1;
+
+void hal_native_flash_fail_after(int n) {
+    flash_calls_left = n;
+}
+
+int flash_safe_execute(void (*func)(void*), void* param, uint32_t enter_exit_timeout_ms) {
+    (void) enter_exit_timeout_ms;
+    if (flash_calls_left == 0)
+        return PICO_ERROR_TIMEOUT;
+    if (flash_calls_left > 0)
+        flash_calls_left--;
+    func(param);
+    return PICO_OK;
+}
+
+bool flash_safe_execute_core_init(void) {
+    return true;
+}
+
+// ==================================================
+// INTERRUPTS
+// ==================================================
+static irq_handler_t irq_handlers[NUM_IRQS];
+static bool irq_enabled[NUM_IRQS];
+
+void irq_set_exclusive_handler(unsigned num, irq_handler_t handler) {
+    irq_handlers[num] = handler;
+}
+
+void irq_set_enabled(unsigned num, bool enabled) {
+    irq_enabled[num] = enabled;
+}
+
+void irq_set_priority(unsigned num, uint8_t hardware_priority) {
+    (void) num;
+    (void) hardware_priority;
+}
+
+// ==================================================
+// DMA
+// ==================================================
+static struct {
+    bool claimed;
+    bool busy;
+    bool irq0_enabled;
+    bool irq0;
+    int size;
+    int chain_to;
+    const volatile void* read_addr;
+    uint32_t count;
+} chans[NUM_DMA_CHANNELS];
+
+static dma_hw_t dma_regs;
+dma_hw_t* dma_hw = &dma_regs;
+
+int dma_claim_unused_channel(bool required) {
+    (void) required;
+    for (int c = 0; c < NUM_DMA_CHANNELS; c++) {
+        if (!chans[c].claimed) {
+            chans[c].claimed = true;
+            return c;
+        }
+    }
+    return -1;
+}
+
+dma_channel_config dma_channel_get_default_config(unsigned channel) {
+    return (dma_channel_config) {.size = DMA_SIZE_32, .chain_to = (int) channel};
+}
+
+void channel_config_set_transfer_data_size(dma_channel_config* c,
+                                           enum dma_channel_transfer_size size) {
+    c->size = size;
+}
+
+void channel_config_set_read_increment(dma_channel_config* c, bool incr) {
+    (void) c;
+    (void) incr;
+}
+
+void channel_config_set_write_increment(dma_channel_config* c, bool incr) {
+    (void) c;
+    (void) incr;
+}
+
+void channel_config_set_dreq(dma_channel_config* c, unsigned dreq) {
+    (void) c;
+    (void) dreq;
+}
+
+void channel_config_set_chain_to(dma_channel_config* c, unsigned chain_to) {
+    c->chain_to = (int) chain_to;
+}
+
+void dma_channel_configure(unsigned channel, const dma_channel_config* config,
+                           volatile void* write_addr, const volatile void* read_addr,
+                           uint32_t transfer_count, bool trigger) {
+    (void) write_addr;
+    chans[channel].size = config->size;
+    chans[channel].chain_to = config->chain_to;
+    chans[channel].read_addr = read_addr;
+    chans[channel].count = transfer_count;
+    chans[channel].busy = trigger;
+}
+
+void dma_channel_set_read_addr(unsigned channel, const volatile void* read_addr, bool trigger) {
+    chans[channel].read_addr = read_addr;
+    if (trigger)
+        chans[channel].busy = true;
+}
+
+void dma_channel_start(unsigned channel) {
+    chans[channel].busy = true;
+}
+
+void dma_channel_abort(unsigned channel) {
+    chans[channel].busy = false;
+}
+
+void dma_channel_set_irq0_enabled(unsigned channel, bool enabled) {
+    chans[channel].irq0_enabled = enabled;
+}
+
+bool dma_channel_get_irq0_status(unsigned channel) {
+    return chans[channel].irq0;
+}
+
+void dma_channel_acknowledge_irq0(unsigned channel) {
+    chans[channel].irq0 = false;
+}
+
+int hal_native_dma_drain(uint16_t* out, int max) {
+    int c = 0;
+    while (c < NUM_DMA_CHANNELS && !chans[c].busy) {
+        c++;
+    }
+    if (c == NUM_DMA_CHANNELS)
+        return 0;
+
+    int n = (int) chans[c].count;
+    if (out && chans[c].size == DMA_SIZE_16) {
+        memcpy(out, (const void*) chans[c].read_addr,
+               (size_t) ((n < max) ? n : max) * sizeof(uint16_t));
+    }
+
+    chans[c].busy = false;
+    if (chans[c].chain_to != c) {
+        chans[chans[c].chain_to].busy = true;
+    }
+    if (chans[c].irq0_enabled) {
+        chans[c].irq0 = true;
+        if (irq_enabled[DMA_IRQ_0] && irq_handlers[DMA_IRQ_0]) {
+            irq_handlers[DMA_IRQ_0]();
+        }
+    }
+    return n;
+}
+
+// ==================================================
+// GPIO, ADC, PWM - configuration only
+// ==================================================
+static adc_hw_t adc_regs;
+adc_hw_t* adc_hw = &adc_regs;
+
+static pwm_hw_t pwm_regs;
+pwm_hw_t* pwm_hw = &pwm_regs;
+
+void gpio_init(unsigned gpio) {
+    (void) gpio;
+}
+
+void gpio_set_function(unsigned gpio, int fn) {
+    (void) gpio;
+    (void) fn;
+}
+
+void gpio_set_dir(unsigned gpio, bool out) {
+    (void) gpio;
+    (void) out;
+}
+
+void gpio_put(unsigned gpio, bool value) {
+    (void) gpio;
+    (void) value;
+}
+
+uint32_t gpio_get_irq_event_mask(unsigned gpio) {
+    (void) gpio;
+    return 0;
+}
+
+void gpio_acknowledge_irq(unsigned gpio, uint32_t event_mask) {
+    (void) gpio;
+    (void) event_mask;
+}
+
+void gpio_add_raw_irq_handler_masked(uint64_t gpio_mask, void (*handler)(void)) {
+    (void) gpio_mask;
+    (void) handler;
+}
+
+void gpio_set_irq_enabled(unsigned gpio, uint32_t event_mask, bool enabled) {
+    (void) gpio;
+    (void) event_mask;
+    (void) enabled;
+}
+
+void adc_init(void) {}
+
+void adc_gpio_init(unsigned gpio) {
+    (void) gpio;
+}
+
+void adc_select_input(unsigned input) {
+    (void) input;
+}
+
+void adc_run(bool run) {
+    (void) run;
+}
+
+pwm_config pwm_get_default_config(void) {
+    return (pwm_config) {0};
+}
+
+void pwm_config_set_clkdiv(pwm_config* c, float div) {
+    c->div = (uint32_t) (div * 16.0f);
+}
+
+void pwm_config_set_wrap(pwm_config* c, uint16_t wrap) {
+    c->top = wrap;
+}
+
+void pwm_init(unsigned slice_num, pwm_config* c, bool start) {
+    (void) start;
+    pwm_hw->slice[slice_num].div = c->div;
+    pwm_hw->slice[slice_num].top = c->top;
+}
+
+void pwm_set_chan_level(unsigned slice_num, unsigned chan, uint16_t level) {
+    (void) chan;
+    pwm_hw->slice[slice_num].cc = level;
+}
+
+unsigned pwm_gpio_to_slice_num(unsigned gpio) {
+    return (gpio >> 1u) % 12u;
+}
+
+unsigned pwm_gpio_to_channel(unsigned gpio) {
+    return gpio & 1u;
+}
+
+unsigned pwm_get_dreq(unsigned slice_num) {
+    return slice_num;
+}
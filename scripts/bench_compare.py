@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+"""
+bench_compare.py — flag performance regressions between two benchmark runs
+
+Reads two --tsv outputs of the host benchmark (bench/bench.c, env:native) and
+prints the change in ns/sample for every case they share. Exits 1 when any case
+got slower by more than the threshold, so it can gate a CI job.
+
+Usage:
+    .pio/build/native/program --tsv > new.tsv
+    python scripts/bench_compare.py old.tsv new.tsv [--threshold 10]
+"""
+
+import argparse
+import csv
+import sys
+
+
+def load(path):
+    with open(path, newline="") as f:
+        rows = csv.DictReader(f, delimiter="\t")
+        return {row["case"]: float(row["ns_per_sample"]) for row in rows}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=10.0, help="allowed slowdown (%%)")
+    args = parser.parse_args()
+
+    old = load(args.baseline)
+    new = load(args.current)
+
+    regressions = 0
+    print(f"{'case':<34} {'old ns':>9} {'new ns':>9} {'change':>8}")
+    for case in old:
+        if case not in new:
+            print(f"{case:<34} {old[case]:>9.2f} {'-':>9}  missing")
+            continue
+        change = (new[case] / old[case] - 1.0) * 100.0
+        flag = ""
+        if change > args.threshold:
+            flag = "  SLOWER"
+            regressions += 1
+        print(f"{case:<34} {old[case]:>9.2f} {new[case]:>9.2f} {change:>+7.1f}%{flag}")
+    for case in new:
+        if case not in old:
+            print(f"{case:<34} {'-':>9} {new[case]:>9.2f}  new")
+
+    if regressions:
+        print(f"\n{regressions} case(s) slower by more than {args.threshold:g}%")
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+"""
+build_sample_bank.py — build a flash sample bank image for src/wavegen/sample_bank.c
+
+Reads PCM WAV files (8/16/24/32-bit, any rate, mono or stereo), mixes them to
+mono, resamples them to the engine rate and writes one binary image:
+
+    SampleBankHeader   magic "SBNK", version, count, image size
+    SampleBankEntry[]  name (16 bytes), offset, length, rate, bits
+    PCM data           signed 8- or 16-bit, each entry 4-byte aligned
+
+Names are the WAV file names without extension (first 15 characters), which is
+what sample_bank_find() looks up. Load the image at SAMPLE_BANK_FLASH_OFFSET:
+
+    python scripts/build_sample_bank.py kick.wav snare.wav -o bank.bin
+    picotool load bank.bin -o 0x10100000
+
+Only the standard library is used.
+"""
+
+import argparse
+import os
+import struct
+import sys
+import wave
+
+MAGIC = 0x4B4E4253  # "SBNK"
+VERSION = 1
+MAX_ENTRIES = 256
+NAME_LEN = 16
+HEADER = struct.Struct("<IHHII")
+ENTRY = struct.Struct("<16sIIIB3x")
+
+ENGINE_RATE = 22050
+FLASH_OFFSET = 1024 * 1024  # SAMPLE_BANK_FLASH_OFFSET
+STORE_BYTES = 512 * 1024  # PRESET_STORE_BYTES, at the top of flash - the bank must end below
+FLASH_SIZE = 4 * 1024 * 1024  # PICO_FLASH_SIZE_BYTES; --flash-size for other parts
+XIP_BASE = 0x10000000
+
+
+def read_wav(path):
+    """Returns (samples in [-1, 1) as mono floats, rate)."""
+    with wave.open(path, "rb") as w:
+        channels = w.getnchannels()
+        width = w.getsampwidth()
+        rate = w.getframerate()
+        raw = w.readframes(w.getnframes())
+
+    if width == 1:  # 8-bit WAV is unsigned
+        values = [(b - 128) / 128.0 for b in raw]
+    elif width in (2, 3, 4):
+        scale = float(1 << (8 * width - 1))
+        values = [
+            int.from_bytes(raw[i : i + width], "little", signed=True) / scale
+            for i in range(0, len(raw), width)
+        ]
+    else:
+        raise ValueError(f"{path}: unsupported sample width {width}")
+
+    mono = [sum(values[i : i + channels]) / channels for i in range(0, len(values), channels)]
+    return mono, rate
+
+
+def resample(samples, src_rate, dst_rate):
+    """Linear interpolation - drum transients survive it fine at these rates."""
+    if src_rate == dst_rate or len(samples) < 2:
+        return samples
+    step = src_rate / dst_rate
+    out = []
+    pos = 0.0
+    while pos < len(samples) - 1:
+        i = int(pos)
+        frac = pos - i
+        out.append(samples[i] + (samples[i + 1] - samples[i]) * frac)
+        pos += step
+    return out
+
+
+def encode(samples, bits, normalize):
+    peak = max((abs(s) for s in samples), default=0.0)
+    gain = (0.999 / peak) if (normalize and peak > 0) else 1.0
+    full = (1 << (bits - 1)) - 1
+    ints = [max(-full - 1, min(full, round(s * gain * full))) for s in samples]
+    return struct.pack(f"<{len(ints)}{'b' if bits == 8 else 'h'}", *ints)
+
+
+def build(paths, rate, bits, normalize, flash_size=FLASH_SIZE):
+    if len(paths) > MAX_ENTRIES:
+        raise ValueError(f"at most {MAX_ENTRIES} samples per bank")
+
+    entries = []
+    blobs = []
+    offset = HEADER.size + ENTRY.size * len(paths)
+    for path in paths:
+        samples, src_rate = read_wav(path)
+        out_rate = rate or src_rate
+        data = encode(resample(samples, src_rate, out_rate), bits, normalize)
+        offset = (offset + 3) & ~3
+        name = os.path.splitext(os.path.basename(path))[0].encode()[: NAME_LEN - 1]
+        entries.append(ENTRY.pack(name, offset, len(data) * 8 // bits, out_rate, bits))
+        blobs.append((offset, data))
+        offset += len(data)
+
+    limit = flash_size - STORE_BYTES - FLASH_OFFSET
+    if offset > limit:
+        raise ValueError(f"bank is {offset} bytes, {limit} fit below the preset store")
+
+    image = bytearray(offset)
+    HEADER.pack_into(image, 0, MAGIC, VERSION, len(paths), offset, 0)
+    for i, e in enumerate(entries):
+        image[HEADER.size + i * ENTRY.size : HEADER.size + (i + 1) * ENTRY.size] = e
+    for off, data in blobs:
+        image[off : off + len(data)] = data
+    return bytes(image)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    parser.add_argument("wavs", nargs="+", help="WAV files, in bank order")
+    parser.add_argument("-o", "--output", default="sample_bank.bin")
+    parser.add_argument("--rate", type=int, default=ENGINE_RATE, help="0 keeps each file's rate")
+    parser.add_argument("--bits", type=int, choices=(8, 16), default=16)
+    parser.add_argument("--normalize", action="store_true", help="scale each sample to full scale")
+    parser.add_argument("--flash-size", type=int, default=FLASH_SIZE // (1024 * 1024),
+                        help="board flash in MB (the bank must fit below the preset store)")
+    args = parser.parse_args()
+
+    image = build(args.wavs, args.rate, args.bits, args.normalize, args.flash_size * 1024 * 1024)
+    with open(args.output, "wb") as f:
+        f.write(image)
+
+    print(f"{args.output}: {len(args.wavs)} samples, {len(image)} bytes")
+    print(f"Load with: picotool load {args.output} -o 0x{XIP_BASE + FLASH_OFFSET:08x}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+"""
+dither_snr.py — in-band SNR of the PWM output quantizer (src/wavegen/dither.c)
+
+Builds dither.c with the host compiler, runs a quiet test tone through every
+quantizer mode at each oversampling factor and prints the SNR (signal against
+noise + distortion) inside the audio band, so truncation, TPDF dither and noise
+shaping can be compared on the same numbers the firmware produces.
+
+Usage:
+    python scripts/dither_snr.py [--band 10000] [--cc cc]
+"""
+
+import argparse
+import os
+import subprocess
+import tempfile
+
+import numpy as np
+
+SAMPLE_RATE = 22050
+PWM_WRAP = 255
+LENGTH = 1 << 16  # Samples at SAMPLE_RATE
+MODES = ["truncate", "dither", "shaped"]
+OVERSAMPLE = [1, 2, 4, 8]
+
+# (name, frequency Hz, level dBFS): an 808 tail a few hundred ms in, and a mid-level hat
+SIGNALS = [
+    ("808 tail", 55.0, -40.0),
+    ("quiet tone", 1000.0, -30.0),
+    ("mid tone", 1000.0, -12.0),
+]
+
+SRC = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src", "wavegen")
+
+HARNESS = r"""
+#include "dither.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+// argv: mode oversample; stdin: int32 Q15 samples; stdout: uint16 PWM levels
+int main(int argc, char** argv) {
+    PwmQuantizer q;
+    quantizer_init(&q, (QuantMode) atoi(argv[1]), atoi(argv[2]));
+
+    int32_t in[256];
+    uint16_t out[256 * 8];
+    size_t n;
+    while ((n = fread(in, sizeof(int32_t), 256, stdin)) > 0) {
+        quantizer_run(&q, in, out, (int) n);
+        fwrite(out, sizeof(uint16_t), n * q.oversample, stdout);
+    }
+    return 0;
+}
+"""
+
+
+def build(cc, workdir):
+    harness = os.path.join(workdir, "harness.c")
+    exe = os.path.join(workdir, "dither_snr")
+    with open(harness, "w") as f:
+        f.write(HARNESS)
+    sources = [harness, os.path.join(SRC, "dither.c"), os.path.join(SRC, "noise.c")]
+    subprocess.run([cc, "-O2", "-I", SRC, "-o", exe] + sources + ["-lm"], check=True)
+    return exe
+
+
+def tone(freq, level_db):
+    # Whole number of cycles over the capture, so the tone falls on one FFT bin
+    cycles = round(freq * LENGTH / SAMPLE_RATE)
+    t = np.arange(LENGTH)
+    x = 10 ** (level_db / 20) * np.sin(2 * np.pi * cycles * t / LENGTH)
+    return np.round(x * 32767).astype(np.int32), cycles
+
+
+def quantize(exe, samples, mode, oversample):
+    run = subprocess.run(
+        [exe, str(MODES.index(mode)), str(oversample)],
+        input=samples.tobytes(),
+        stdout=subprocess.PIPE,
+        check=True,
+    )
+    return np.frombuffer(run.stdout, dtype=np.uint16)
+
+
+def snr_db(levels, cycles, oversample, band):
+    # PWM duty back to [-1, 1]; the output RC/speaker average each PWM period
+    y = levels.astype(np.float64) * (2.0 / PWM_WRAP) - 1.0
+    power = np.abs(np.fft.rfft((y - y.mean()) * np.hanning(len(y)))) ** 2
+    bin_hz = SAMPLE_RATE * oversample / len(y)
+
+    signal = slice(cycles - 3, cycles + 4)  # Tone plus the Hann window's main lobe
+    noise = power.copy()
+    noise[signal] = 0
+    noise[: int(20 / bin_hz) + 1] = 0  # Below 20 Hz
+    noise[int(band / bin_hz) + 1 :] = 0
+    return 10 * np.log10(power[signal].sum() / noise.sum())
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    parser.add_argument("--band", type=float, default=10000.0, help="audio band edge (Hz)")
+    parser.add_argument("--cc", default=os.environ.get("CC", "cc"), help="host C compiler")
+    args = parser.parse_args()
+
+    with tempfile.TemporaryDirectory() as workdir:
+        exe = build(args.cc, workdir)
+
+        print(f"In-band SNR (dB), 20 Hz - {args.band / 1000:g} kHz, {PWM_WRAP + 1} PWM levels")
+        for name, freq, level in SIGNALS:
+            samples, cycles = tone(freq, level)
+            print(f"\n{name}: {freq:g} Hz at {level:g} dBFS")
+            print("  oversample " + "".join(f"{m:>10}" for m in MODES))
+            for os_factor in OVERSAMPLE:
+                row = [
+                    snr_db(quantize(exe, samples, m, os_factor), cycles, os_factor, args.band)
+                    for m in MODES
+                ]
+                print(f"  {os_factor:>9}x " + "".join(f"{v:>10.1f}" for v in row))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+"""
+export_golden.py — golden vectors from the Python reference model
+
+Renders every drum preset in src/wavegen/presets.h and a parameter grid through
+the model in scripts/waveform_test.py and writes them to test/golden/vectors.bin.
+The conformance test (test/test_conformance) renders the same params through the
+C engine and compares.
+
+The model runs at the firmware rate (22050 Hz), with a seeded generator and
+without its random detune, so the vectors are reproducible. It has no attack,
+hold or filter stage. Presets are exported with only the fields the model knows;
+the hats' high-pass is left out of both renders.
+
+Format (little-endian):
+    header   "WGLD", u32 version, u32 count, u32 sample rate
+    vector   char name[24], f32 params[9], u32 length, i16 samples[length]
+    params   frequency, amplitude, decay, waveform_id, offset_dc, pitch_decay,
+             noise_mix, env_curve, comp_amount (the WaveParams order)
+    samples  model output in Q15 (round(x * 32767))
+
+Usage:
+    python scripts/export_golden.py [--out test/golden/vectors.bin]
+"""
+
+import argparse
+import itertools
+import os
+import re
+import struct
+
+import numpy as np
+
+from waveform_test import WaveParams, waveform_generate
+
+SAMPLE_RATE = 22050
+VERSION = 1
+SEED = 362
+GRID_DECAY = 0.1  # s - long enough for the envelope, short enough to keep the file small
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+PRESETS_H = os.path.join(ROOT, "src", "wavegen", "presets.h")
+
+FIELDS = [
+    "frequency",
+    "amplitude",
+    "decay",
+    "waveform_id",
+    "offset_dc",
+    "pitch_decay",
+    "noise_mix",
+    "env_curve",
+    "comp_amount",
+]
+
+
+def load_presets():
+    # {60.0, 1.0, 0.25, 0, ...}, // 0:Kick
+    pattern = re.compile(r"\{([^{}]*)\},?\s*//\s*\d+:(.*)")
+    presets = []
+    with open(PRESETS_H) as f:
+        for line in f:
+            m = pattern.search(line)
+            if m:
+                values = [float(v) for v in m.group(1).split(",")][: len(FIELDS)]
+                name = re.sub(r"\W+", "_", m.group(2).strip().lower())
+                presets.append((f"preset_{name}", WaveParams(*values)))
+    return presets
+
+
+def grid():
+    # Every oscillator against pitch glide, noise blend and compressor settings
+    axes = itertools.product(range(5), [0.0, 6.0], [0.0, 0.4], [0.0, 0.5, 0.9])
+    for wave, pitch, noise, comp in axes:
+        name = f"w{wave}_p{pitch:g}_n{noise:g}_c{comp:g}"
+        yield name, WaveParams(220.0, 0.8, GRID_DECAY, wave, 0.0, pitch, noise, 4.0, comp)
+    # Corners the grid misses: high pitch (octave tables), DC into the compressor
+    for wave in (1, 3):
+        yield f"w{wave}_hi", WaveParams(1760.0, 0.8, GRID_DECAY, wave, 0.0, 0.0, 0.0, 4.0, 0.0)
+    yield "w0_dc", WaveParams(220.0, 0.6, GRID_DECAY, 0, 0.3, 0.0, 0.0, 4.0, 0.5)
+    yield "w2_full", WaveParams(110.0, 1.0, GRID_DECAY, 2, 0.0, 0.0, 0.0, 0.0, 0.0)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    parser.add_argument("--out", default=os.path.join(ROOT, "test", "golden", "vectors.bin"))
+    args = parser.parse_args()
+
+    vectors = load_presets() + list(grid())
+    rng = np.random.default_rng(SEED)
+
+    os.makedirs(os.path.dirname(args.out), exist_ok=True)
+    with open(args.out, "wb") as f:
+        f.write(struct.pack("<4sIII", b"WGLD", VERSION, len(vectors), SAMPLE_RATE))
+        for name, p in vectors:
+            samples = waveform_generate(1 << 30, p, SAMPLE_RATE, rng, drift=0.0)
+            q15 = np.round(samples * 32767).astype("<i2")
+            params = [float(getattr(p, field)) for field in FIELDS]
+            f.write(struct.pack("<24s9fI", name.encode()[:23], *params, len(q15)))
+            f.write(q15.tobytes())
+
+    size = os.path.getsize(args.out)
+    print(f"{len(vectors)} vectors, {size // 1024} KB -> {os.path.relpath(args.out, ROOT)}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,140 @@
+#!/usr/bin/env python3
+"""
+gen_wavetables.py — generate the band-limited wavetable bank for src/wavegen
+
+Writes src/wavegen/wavetables.c / wavetables.h with const int16 (Q15) tables,
+so they live in flash and cost nothing at startup:
+
+    wt_sine                      one 1024-entry sine table
+    wt_bank[wave][octave]        square, triangle and saw, one table per octave
+
+Table k is used for phase increments below 2^(WT_OCTAVE_SHIFT + k) and holds only
+the harmonics that stay below Nyquist there (256 >> k of them), so the oscillator
+never aliases. Every table has one guard entry for linear interpolation.
+
+Usage:
+    python scripts/gen_wavetables.py
+
+Also runs as a PlatformIO pre-build script (extra_scripts in platformio.ini) and
+only rewrites the outputs when this script is newer than them.
+"""
+
+import math
+import os
+
+WT_BITS = 10
+WT_SIZE = 1 << WT_BITS
+WT_OCTAVES = 9
+WT_OCTAVE_SHIFT = 23  # 2^23 phase increment ~= 43 Hz at 22.05 kHz
+MAX_HARMONICS = 256
+
+WAVES = ["square", "triangle", "saw"]
+
+
+def harmonic_amplitudes(wave, n):
+    """(sin_amp, cos_amp) of harmonic n, matching the naive waveforms in waveform_gen.c"""
+    if wave == "square":  # +1 for phase < 0.5
+        return (4.0 / (math.pi * n), 0.0) if n % 2 else (0.0, 0.0)
+    if wave == "triangle":  # 4|phase - 0.5| - 1, +1 at phase 0
+        return (0.0, 8.0 / (math.pi * n) ** 2) if n % 2 else (0.0, 0.0)
+    if wave == "saw":  # 2 * phase - 1, rising
+        return (-2.0 / (math.pi * n), 0.0)
+    raise ValueError(wave)
+
+
+def build_table(wave, harmonics, sin_lut, cos_lut):
+    acc = [0.0] * WT_SIZE
+    for n in range(1, harmonics + 1):
+        sa, ca = harmonic_amplitudes(wave, n)
+        if sa == 0.0 and ca == 0.0:
+            continue
+        # Lanczos sigma factor tames the Gibbs overshoot at the band edge
+        x = math.pi * n / (harmonics + 1)
+        sigma = math.sin(x) / x
+        sa *= sigma
+        ca *= sigma
+        for i in range(WT_SIZE):
+            k = (n * i) & (WT_SIZE - 1)
+            acc[i] += sa * sin_lut[k] + ca * cos_lut[k]
+
+    peak = max(abs(v) for v in acc)
+    return [int(round(v / peak * 32767)) for v in acc]
+
+
+def c_array(values, indent):
+    lines = []
+    for i in range(0, len(values), 10):
+        lines.append(indent + ", ".join(str(v) for v in values[i : i + 10]) + ",")
+    return "\n".join(lines)
+
+
+def generate(out_dir):
+    sin_lut = [math.sin(2 * math.pi * i / WT_SIZE) for i in range(WT_SIZE)]
+    cos_lut = [math.cos(2 * math.pi * i / WT_SIZE) for i in range(WT_SIZE)]
+
+    sine = [int(round(v * 32767)) for v in sin_lut]
+
+    header = f"""// Generated by scripts/gen_wavetables.py - do not edit
+#ifndef WAVETABLES_H
+#define WAVETABLES_H
+
+#include <stdint.h>
+
+#define WT_BITS {WT_BITS}
+#define WT_SIZE {WT_SIZE}
+#define WT_OCTAVES {WT_OCTAVES}
+#define WT_OCTAVE_SHIFT {WT_OCTAVE_SHIFT} // Table k serves increments below 2^(WT_OCTAVE_SHIFT + k)
+
+enum {{ WT_SQUARE, WT_TRIANGLE, WT_SAW, WT_WAVES }};
+
+extern const int16_t wt_sine[WT_SIZE + 1];
+extern const int16_t wt_bank[WT_WAVES][WT_OCTAVES][WT_SIZE + 1];
+
+#endif
+"""
+
+    body = ["// Generated by scripts/gen_wavetables.py - do not edit", '#include "wavetables.h"', ""]
+    body.append("// clang-format off")
+    body.append("const int16_t wt_sine[WT_SIZE + 1] = {")
+    body.append(c_array(sine + sine[:1], "    "))
+    body.append("};")
+    body.append("")
+    body.append("const int16_t wt_bank[WT_WAVES][WT_OCTAVES][WT_SIZE + 1] = {")
+    for wave in WAVES:
+        body.append(f"    {{ // {wave}")
+        for k in range(WT_OCTAVES):
+            table = build_table(wave, MAX_HARMONICS >> k, sin_lut, cos_lut)
+            body.append(f"        {{ // octave {k}: {MAX_HARMONICS >> k} harmonics")
+            body.append(c_array(table + table[:1], "            "))
+            body.append("        },")
+        body.append("    },")
+    body.append("};")
+    body.append("// clang-format on")
+    body.append("")
+
+    with open(os.path.join(out_dir, "wavetables.h"), "w") as f:
+        f.write(header)
+    with open(os.path.join(out_dir, "wavetables.c"), "w") as f:
+        f.write("\n".join(body))
+
+
+def main(project_dir, script_path=None):
+    out_dir = os.path.join(project_dir, "src", "wavegen")
+    outputs = [os.path.join(out_dir, n) for n in ("wavetables.c", "wavetables.h")]
+
+    # As a build hook, skip the work when the outputs are already up to date
+    if script_path and all(os.path.exists(o) for o in outputs):
+        if min(os.path.getmtime(o) for o in outputs) >= os.path.getmtime(script_path):
+            return
+
+    print("Generating band-limited wavetables...")
+    generate(out_dir)
+
+
+try:
+    Import("env")  # noqa: F821 - defined when run by PlatformIO
+    _project = env["PROJECT_DIR"]  # noqa: F821
+    main(_project, os.path.join(_project, "scripts", "gen_wavetables.py"))
+except NameError:
+    if __name__ == "__main__":
+        main(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
@@ -1,6 +1,4 @@
 import numpy as np
-import matplotlib.pyplot as plt
-from scipy.io.wavfile import write
 from pathlib import Path
 
 # --- Constants ---
@@ -34,18 +32,20 @@ class WaveParams:
 
 
 # --- Universal Waveform Generator ---
-def waveform_generate(max_samples, p):
-    total_samples = int(p.decay * SAMPLE_RATE)
+# sample_rate, rng and drift let scripts/export_golden.py render at the firmware rate
+# with a seeded generator and no random detune; the defaults are the original model.
+def waveform_generate(max_samples, p, sample_rate=SAMPLE_RATE, rng=np.random, drift=0.002):
+    total_samples = int(p.decay * sample_rate)
     total_samples = min(total_samples, max_samples)
-    t = np.arange(total_samples) / SAMPLE_RATE
+    t = np.arange(total_samples) / sample_rate
 
     # --- Frequency envelope (pitch drop + drift) ---
     freq = (
         p.frequency
         * np.exp(-p.pitch_decay * t)
-        * (1 + np.random.uniform(-0.002, 0.002))
+        * (1 + rng.uniform(-drift, drift))
     )
-    phase = np.cumsum(freq / SAMPLE_RATE) % 1.0
+    phase = np.cumsum(freq / sample_rate) % 1.0
 
     # --- Base waveform ---
     if p.waveform_id == 0:
@@ -57,13 +57,13 @@ def waveform_generate(max_samples, p):
     elif p.waveform_id == 3:
         val = 2.0 * phase - 1.0
     elif p.waveform_id == 4:
-        val = np.random.uniform(-1.0, 1.0, total_samples)
+        val = rng.uniform(-1.0, 1.0, total_samples)
     else:
         raise ValueError("Invalid waveform_id")
 
     # --- Noise blending ---
     if p.noise_mix > 0.0:
-        noise = np.random.uniform(-1.0, 1.0, total_samples)
+        noise = rng.uniform(-1.0, 1.0, total_samples)
         val = (1 - p.noise_mix) * val + p.noise_mix * noise
 
     # --- Exponential amplitude envelope ---
@@ -98,65 +98,49 @@ def waveform_generate(max_samples, p):
     return np.clip(val, -1.0, 1.0)
 
 
-# --- Output Directory ---
-root = Path(__file__).parents[1]
-out_dir = root / "test" / "waveforms"
-out_dir.mkdir(parents=True, exist_ok=True)
-
-
-# --- Presets ---
-presets = [
-    WaveParams(
-        60.0, 1.0, 0.25, 0, 0.0, pitch_decay=8.0, env_curve=4.0, comp_amount=0.5
-    ),  # Kick
-    WaveParams(
-        250.0,
-        0.8,
-        0.15,
-        0,
-        0.0,
-        pitch_decay=0.8,
-        noise_mix=0.8,
-        env_curve=5.0,
-        comp_amount=0.6,
-    ),  # Snare
-    WaveParams(
-        8000.0, 0.5, 0.05, 4, 0.0, noise_mix=1.0, env_curve=6.0, comp_amount=0.3
-    ),  # Closed Hat
-    WaveParams(
-        55.0, 1.0, 1.2, 0, 0.0, pitch_decay=2.0, env_curve=2.5, comp_amount=0.25
-    ),  # 808
-    WaveParams(440.0, 0.7, 0.5, 2, 0.0, comp_amount=0.2),  # Tone
-    WaveParams(
-        8000.0, 0.5, 0.25, 4, 0.0, noise_mix=1.0, env_curve=3.0, comp_amount=0.4
-    ),  # Open Hat
-]
-
+# --- Generate and Export ---
+# The WAVs and plots come from the firmware's own engine (scripts/wavegen.py), so they are
+# what the device plays. The model above is kept as the independent reference that
+# scripts/export_golden.py renders the conformance vectors from.
 names = ["kick", "snare", "hat", "808", "tone", "open_hat"]
 
 
-# --- Generate and Export ---
-print("=== Waveform Generator Test ===")
-for name, p in zip(names, presets):
-    buffer = waveform_generate(int(SAMPLE_RATE), p)
-    n = len(buffer)
-
-    # Save WAV
-    wav_path = out_dir / f"{name}.wav"
-    scaled = np.int16(buffer * 32767)
-    write(wav_path, int(SAMPLE_RATE), scaled)
-
-    # Save Plot
-    png_path = out_dir / f"{name}.png"
-    plt.figure(figsize=(9, 3))
-    plt.plot(buffer[:2000])
-    plt.title(f"{name.capitalize()} Waveform Preview")
-    plt.xlabel("Sample")
-    plt.ylabel("Amplitude")
-    plt.tight_layout()
-    plt.savefig(png_path, dpi=150)
-    plt.close()
-
-    print(f"Saved {name}: {n} samples → {wav_path.name}, {png_path.name}")
-
-print("All waveforms generated successfully.")
+def main():
+    import matplotlib.pyplot as plt
+    from scipy.io.wavfile import write
+
+    import wavegen
+
+    # --- Output Directory ---
+    root = Path(__file__).parents[1]
+    out_dir = root / "test" / "waveforms"
+    out_dir.mkdir(parents=True, exist_ok=True)
+
+    print("=== Waveform Generator Test ===")
+    for name, p in zip(names, wavegen.presets()):
+        scaled = wavegen.render(p, dtype=np.int16)
+        buffer = scaled / 32768.0
+        n = len(buffer)
+
+        # Save WAV
+        wav_path = out_dir / f"{name}.wav"
+        write(wav_path, wavegen.SAMPLE_RATE, scaled)
+
+        # Save Plot
+        png_path = out_dir / f"{name}.png"
+        plt.figure(figsize=(9, 3))
+        plt.plot(buffer[:2000])
+        plt.title(f"{name.capitalize()} Waveform Preview")
+        plt.xlabel("Sample")
+        plt.ylabel("Amplitude")
+        plt.tight_layout()
+        plt.savefig(png_path, dpi=150)
+        plt.close()
+
+        print(f"Saved {name}: {n} samples → {wav_path.name}, {png_path.name}")
+
+    print("All waveforms generated successfully.")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,335 @@
+#!/usr/bin/env python3
+"""
+wavegen.py — the firmware's synthesis engine (src/wavegen) for Python scripts
+
+Builds waveform_gen.c and the rest of the synthesis core with the host compiler
+into a shared library (cached under .pio/pywavegen, rebuilt when a source
+changes) and renders through it with ctypes, so scripts get the device's audio
+sample for sample instead of a NumPy re-implementation of it.
+
+Samples are written by the C code straight into NumPy arrays: params go in as a
+structured array with the WaveParams layout (PARAMS_DTYPE) and output arrays are
+passed by pointer, so nothing is copied either way. Batches render on all cores
+through the job queue of the offline renderer (tools/render). ctypes releases
+the GIL around every call.
+
+    import wavegen
+    kick = wavegen.render(wavegen.preset(0))  # float32 in [-1, 1]
+    p = wavegen.params(8)
+    p[:] = wavegen.preset(0)
+    p["frequency"] = np.linspace(40, 90, 8)   # 8 kicks, one per pitch
+    out, lengths = wavegen.render_batch(p, max_samples=22050)
+
+Output formats (dtype):
+    float32  Q15 / 32768, as the engine sees it
+    int16    Q15 saturated to 16 bits, as written to WAV
+    uint16   undithered PWM levels (0..PWM_WRAP) - the device also dithers them
+
+Usage (self-check and timing):
+    python scripts/wavegen.py [--cc cc]
+"""
+
+import argparse
+import ctypes
+import hashlib
+import os
+import subprocess
+import time
+
+import numpy as np
+
+SAMPLE_RATE = 22050
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+SRC = os.path.join(ROOT, "src")
+WAVEGEN = os.path.join(SRC, "wavegen")
+RENDER = os.path.join(ROOT, "tools", "render")
+CACHE = os.path.join(ROOT, ".pio", "pywavegen")
+
+SOURCES = [
+    os.path.join(WAVEGEN, "waveform_gen.c"),
+    os.path.join(WAVEGEN, "dsp.c"),
+    os.path.join(WAVEGEN, "noise.c"),
+    os.path.join(WAVEGEN, "envelope.c"),
+    os.path.join(WAVEGEN, "wavetables.c"),
+    os.path.join(RENDER, "job_queue.c"),
+]
+HEADERS = ["waveform_gen.h", "dsp.h", "envelope.h", "noise.h", "pwm_audio.h", "presets.h"]
+
+# WaveParams, field for field (src/wavegen/waveform_gen.h)
+PARAMS_DTYPE = np.dtype(
+    [
+        ("frequency", "<f4"),
+        ("amplitude", "<f4"),
+        ("decay", "<f4"),
+        ("waveform_id", "<i4"),
+        ("offset_dc", "<f4"),
+        ("pitch_decay", "<f4"),
+        ("noise_mix", "<f4"),
+        ("env_curve", "<f4"),
+        ("comp_amount", "<f4"),
+        ("env_attack", "<f4"),
+        ("env_hold", "<f4"),
+        ("filter_type", "<i4"),
+        ("filter_cutoff", "<f4"),
+        ("filter_res", "<f4"),
+        ("filter_env", "<f4"),
+        ("filter_decay", "<f4"),
+    ]
+)
+
+KERNELS = {"float": 0, "fixed": 1, "fixed_generic": 2}  # WaveKernel
+FORMATS = {np.dtype(np.float32): 0, np.dtype(np.int16): 1, np.dtype(np.uint16): 2}
+
+SHIM = r"""
+#include "job_queue.h"
+#include "wavegen/presets.h"
+#include "wavegen/pwm_audio.h"
+#include "wavegen/waveform_gen.h"
+#include <stddef.h>
+
+#define BLOCK 1024
+
+enum { FMT_F32, FMT_I16, FMT_PWM };
+
+typedef struct {
+    const WaveParams* params;
+    void* out;
+    int stride; // Samples per row
+    int format;
+    int32_t* lengths;
+} Batch;
+
+int wg_params_size(void) {
+    return sizeof(WaveParams);
+}
+
+int wg_num_presets(void) {
+    return num_presets;
+}
+
+const WaveParams* wg_presets(void) {
+    return drum_presets;
+}
+
+int wg_length(const WaveParams* p) {
+    WaveVoice v;
+    waveform_voice_start(&v, p);
+    return v.total_samples;
+}
+
+// Renders p into out (len samples of the format, zero past the end of the sound)
+int wg_render(const WaveParams* p, void* out, int len, int format) {
+    int32_t q15[BLOCK];
+    WaveVoice v;
+    int total = 0;
+
+    waveform_voice_start(&v, p);
+    for (int done = 0; done < len; done += BLOCK) {
+        int n = (len - done < BLOCK) ? len - done : BLOCK;
+        total += waveform_voice_render_q15(&v, q15, n);
+        if (format == FMT_F32) {
+            float* f = (float*) out + done;
+            for (int i = 0; i < n; i++) {
+                f[i] = q15[i] * (1.0f / 32768.0f);
+            }
+        } else if (format == FMT_I16) {
+            int16_t* s = (int16_t*) out + done;
+            for (int i = 0; i < n; i++) {
+                s[i] = (int16_t) ((q15[i] > 32767) ? 32767 : q15[i]);
+            }
+        } else {
+            uint16_t* s = (uint16_t*) out + done;
+            for (int i = 0; i < n; i++) {
+                s[i] = pwm_level_q15(q15[i]);
+            }
+        }
+    }
+    return total;
+}
+
+static void batch_job(int job, int worker, void* ctx) {
+    Batch* b = ctx;
+    int bytes = (b->format == FMT_F32) ? 4 : 2;
+    char* row = (char*) b->out + (size_t) job * b->stride * bytes;
+    b->lengths[job] = wg_render(&b->params[job], row, b->stride, b->format);
+    (void) worker;
+}
+
+void wg_render_batch(const WaveParams* params, int count, void* out, int stride, int format,
+                     int32_t* lengths, int threads) {
+    Batch b = {params, out, stride, format, lengths};
+    job_queue_run(count, threads, batch_job, &b);
+}
+
+void wg_set_kernel(int kernel) {
+    waveform_set_kernel((WaveKernel) kernel);
+}
+"""
+
+_lib = None
+
+
+def build(cc=None):
+    """Compiles the library if a source changed; returns its path."""
+    cc = cc or os.environ.get("CC", "cc")
+    flags = ["-std=gnu11", "-O2", "-shared", "-fPIC", "-pthread", "-I", SRC, "-I", RENDER]
+    digest = hashlib.sha1((SHIM + cc + " ".join(flags)).encode())
+    for path in SOURCES + [os.path.join(WAVEGEN, h) for h in HEADERS]:
+        with open(path, "rb") as f:
+            digest.update(f.read())
+    lib = os.path.join(CACHE, f"libwavegen-{digest.hexdigest()[:12]}.so")
+    if os.path.exists(lib):
+        return lib
+
+    os.makedirs(CACHE, exist_ok=True)
+    shim = os.path.join(CACHE, "wavegen_shim.c")
+    with open(shim, "w") as f:
+        f.write(SHIM)
+    tmp = lib + ".tmp"
+    subprocess.run([cc] + flags + ["-o", tmp, shim] + SOURCES + ["-lm"], check=True)
+    os.replace(tmp, lib)  # Atomic, in case two scripts build at once
+    return lib
+
+
+def load(cc=None):
+    """The loaded library (built on first use)."""
+    global _lib
+    if _lib is not None:
+        return _lib
+
+    lib = ctypes.CDLL(build(cc))
+    params = np.ctypeslib.ndpointer(PARAMS_DTYPE, flags="C_CONTIGUOUS")
+    lengths = np.ctypeslib.ndpointer(np.int32, flags="C_CONTIGUOUS,WRITEABLE")
+    lib.wg_params_size.restype = ctypes.c_int
+    lib.wg_num_presets.restype = ctypes.c_int
+    lib.wg_presets.restype = ctypes.c_void_p
+    lib.wg_length.argtypes = [params]
+    lib.wg_length.restype = ctypes.c_int
+    lib.wg_render.argtypes = [params, ctypes.c_void_p, ctypes.c_int, ctypes.c_int]
+    lib.wg_render.restype = ctypes.c_int
+    lib.wg_render_batch.argtypes = [
+        params,
+        ctypes.c_int,
+        ctypes.c_void_p,
+        ctypes.c_int,
+        ctypes.c_int,
+        lengths,
+        ctypes.c_int,
+    ]
+    lib.wg_render_batch.restype = None
+    lib.wg_set_kernel.argtypes = [ctypes.c_int]
+
+    if lib.wg_params_size() != PARAMS_DTYPE.itemsize:
+        raise RuntimeError("PARAMS_DTYPE is out of step with WaveParams in waveform_gen.h")
+    _lib = lib
+    return lib
+
+
+def params(count=None, **fields):
+    """Zeroed WaveParams (one, or an array of count), with any fields set."""
+    p = np.zeros(() if count is None else count, dtype=PARAMS_DTYPE)
+    for name, value in fields.items():
+        p[name] = value
+    return p
+
+
+def presets():
+    """The firmware's drum_presets (src/wavegen/presets.h), as a PARAMS_DTYPE array."""
+    lib = load()
+    n = lib.wg_num_presets()
+    buf = (ctypes.c_char * (n * PARAMS_DTYPE.itemsize)).from_address(lib.wg_presets())
+    return np.frombuffer(buf, dtype=PARAMS_DTYPE, count=n).copy()
+
+
+def preset(index):
+    return presets()[index]
+
+
+def length(p):
+    """Sound length in samples (attack + hold + decay)."""
+    return load().wg_length(np.ascontiguousarray(p, dtype=PARAMS_DTYPE))
+
+
+def _output(out, shape, dtype):
+    if out is None:
+        return np.empty(shape, dtype=dtype)
+    if out.dtype not in FORMATS or not out.flags.c_contiguous or not out.flags.writeable:
+        raise ValueError("out must be a writeable C-contiguous float32, int16 or uint16 array")
+    if out.shape != shape:
+        raise ValueError(f"out has shape {out.shape}, expected {shape}")
+    return out
+
+
+def set_kernel(kernel):
+    """Engine kernel for later renders: 'fixed' (the firmware default), 'float' or
+    'fixed_generic'. Process-wide, like waveform_set_kernel()."""
+    load().wg_set_kernel(KERNELS[kernel])
+
+
+def render(p, max_samples=None, dtype=np.float32, out=None):
+    """One sound. Returns the samples up to its end (a view of out, if given).
+    max_samples (or out's length) caps it; by default the whole sound is rendered."""
+    lib = load()
+    p = np.ascontiguousarray(p, dtype=PARAMS_DTYPE)
+    if max_samples is None:
+        max_samples = len(out) if out is not None else lib.wg_length(p)
+    dtype = np.dtype(out.dtype if out is not None else dtype)
+    out = _output(out, (max_samples,), dtype)
+    n = lib.wg_render(p, out.ctypes.data, max_samples, FORMATS[dtype])
+    return out[:n]
+
+
+def render_batch(p, max_samples=None, dtype=np.float32, out=None, threads=None):
+    """Every sound in the PARAMS_DTYPE array p, one per row of a (len(p), max_samples)
+    array, across threads workers (default: every core). Rows are zero past the end
+    of their sound. Returns (out, lengths)."""
+    lib = load()
+    p = np.ascontiguousarray(p, dtype=PARAMS_DTYPE).reshape(-1)
+    if max_samples is None:
+        if out is not None:
+            max_samples = out.shape[1]
+        else:
+            max_samples = max((length(x) for x in p), default=0)
+    dtype = np.dtype(out.dtype if out is not None else dtype)
+    out = _output(out, (len(p), max_samples), dtype)
+    lengths = np.empty(len(p), dtype=np.int32)
+    threads = threads or os.cpu_count() or 1
+    lib.wg_render_batch(p, len(p), out.ctypes.data, max_samples, FORMATS[dtype], lengths, threads)
+    return out, lengths
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    parser.add_argument("--cc", default=os.environ.get("CC", "cc"), help="host C compiler")
+    args = parser.parse_args()
+
+    load(args.cc)
+    names = ["kick", "snare", "hat", "808", "tone", "open_hat"]
+    for i, p in enumerate(presets()):
+        x = render(p)
+        name = names[i] if i < len(names) else str(i)
+        print(f"preset {i} {name:<9} {len(x):6d} samples  peak {np.abs(x).max():.3f}")
+
+    # Batch against single renders, then the batch rate on a pitch x decay sweep
+    p = params(1000)
+    p[:] = preset(0)
+    p["frequency"] = np.repeat(np.linspace(30, 120, 40), 25)
+    p["decay"] = np.tile(np.linspace(0.05, 1.0, 25), 40)
+    out, lengths = render_batch(p, dtype=np.int16)
+    for i in range(0, len(p), 97):
+        single = render(p[i], dtype=np.int16)
+        assert lengths[i] == len(single) and np.array_equal(out[i, : lengths[i]], single)
+
+    start = time.perf_counter()
+    out, lengths = render_batch(p, dtype=np.int16, out=out)
+    elapsed = time.perf_counter() - start
+    total = int(lengths.sum())
+    print(
+        f"batch of {len(p)}: {total / SAMPLE_RATE:.1f} s of audio in {elapsed * 1000:.1f} ms "
+        f"({total / elapsed:.0f} samples/s), matches single renders"
+    )
+
+
+if __name__ == "__main__":
+    main()
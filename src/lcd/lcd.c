@@ -4,6 +4,7 @@
 //============================================================================
 
 #include "lcd.h"
+#include "../potentiometers/adc_potentiometer.h"
 #include "hardware/spi.h"
 #include "pico/stdlib.h"
 #include <stdint.h>
@@ -1012,7 +1013,7 @@ void LCD_DrawPicture(u16 x0, u16 y0, const Picture* pic) {
     lcddev.select(0);
 }
 
-void LCD_PrintWaveMenu(int id, int freq, int amp, int decay, int dc_offset, int pitch_decay, int noise_mix, int env_curve, int comp_amount, int select)
+void LCD_PrintWaveMenu(int id, int freq, int amp, int decay, int dc_offset, int pitch_decay, int noise_mix, int env_curve, int comp_amount, int select, int morph)
 {
     LCD_DrawFillRectangle(170, 9, 235, 235, COLOR_WHITE);
 
@@ -1043,7 +1044,12 @@ void LCD_PrintWaveMenu(int id, int freq, int amp, int decay, int dc_offset, int
         LCD_DrawRectangle( 175, 165, 190, 220, COLOR_BLACK);
     }
 
-    if (select <=3)
+    if (select == MORPH_SLOT) // Box the morph position on the ID line below
+    {
+        LCD_DrawRectangle( 215, 63, 230, 110, COLOR_BLACK);
+    }
+
+    if (select <=3 || select == MORPH_SLOT)
     {
         sprintf(settings_str, "Freq: %-6d | Amp: %-6d", freq, amp);
         sprintf(settings_str_2, "Dec: %-7d | Off: %-6d", decay, dc_offset);
@@ -1080,7 +1086,17 @@ void LCD_PrintWaveMenu(int id, int freq, int amp, int decay, int dc_offset, int
     }
 
     char id_str[40];
-    sprintf(id_str, "Signal ID: %s", type);
+    if (select == MORPH_SLOT)
+    {
+        char pos[8] = "--";
+        if (morph >= 0)
+            sprintf(pos, "%d%%", morph);
+        sprintf(id_str, "Morph: %-5s| %s", pos, type);
+    }
+    else
+    {
+        sprintf(id_str, "Signal ID: %s", type);
+    }
     LCD_DrawString(215, 11, COLOR_BLACK, COLOR_BLACK, id_str, 16, 1, 1);
 }
 
@@ -1088,16 +1104,14 @@ void LCD_PlotWaveform(uint16_t* samples, int sample_count) {
 
     int width = WIDTH - 11;   // screen width
     int height = HEIGHT - 70; // screen height , leave room for text at top
-    int cut_len = 8000;
-    int buffer_count = sample_count - cut_len;
 
     // Clear screen 
     LCD_DrawFillRectangle(0, 11, height, width, COLOR_BLACK);
 
-    float buffer[(int) (sample_count - cut_len)];
-    memcpy(buffer, samples, (sample_count - cut_len - 1) * sizeof(int));
-    // scale
-    int new_res = buffer_count / width;
+    // scale - samples are PWM levels (0..255)
+    int new_res = sample_count / (width - 11);
+    if (new_res < 1)
+        new_res = 1;
 
     // Previous point
     int prev_y = (height / 2);
@@ -1107,11 +1121,11 @@ void LCD_PlotWaveform(uint16_t* samples, int sample_count) {
         // Average
         float sum = 0;
         for (int i = 0; i < new_res; i++) {
-            int idx = x * new_res + i;
-            if (idx >= buffer_count)
+            int idx = (x - 11) * new_res + i;
+            if (idx >= sample_count)
                 break;
-            float val = (buffer[idx] / 127.5f) - 1.0f;
-            sum += buffer[idx];
+            float val = (samples[idx] / 127.5f) - 1.0f;
+            sum += val;
         }
         float avg = sum / new_res;
 
@@ -90,8 +90,11 @@ typedef struct {
 } Picture;
 
 void LCD_DrawPicture(u16 x0, u16 y0, const Picture* pic);
+// select 0-7 highlights a param; 8 is the morph slot, where morph is the position along
+// the preset path in percent (-1 until the pot is turned)
 void LCD_PrintWaveMenu(int id, int freq, int amp, int decay, int dc_offset, int pitch_decay,
-                       int noise_mix, int env_curve, int comp_amount, int select);
+                       int noise_mix, int env_curve, int comp_amount, int select, int morph);
+#define LCD_PLOT_POINTS 298 // Columns drawn by LCD_PlotWaveform (one sample per column)
 void LCD_PlotWaveform(uint16_t* samples, int sample_count);
 
 #endif
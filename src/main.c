@@ -4,8 +4,15 @@
 #include "lcd/lcd_setup.h"
 #include "pico/stdlib.h"
 #include "potentiometers/adc_potentiometer.h"
+#include "wavegen/audio_core.h"
+#include "wavegen/audio_engine.h"
+#include "wavegen/kernel_bench.h"
+#include "wavegen/morph.h"
+#include "wavegen/preset_store.h"
 #include "wavegen/presets.h"
 #include "wavegen/pwm_audio.h"
+#include "wavegen/sample_bank.h"
+#include "wavegen/sequencer.h"
 #include "wavegen/waveform_gen.h"
 #include <math.h>
 #include <stdio.h>
@@ -73,13 +80,57 @@
 // ============================================================================
 WaveParams adc_buffer;
 
-// Timing configuration for live editing
-#define EDIT_TIMEOUT_MS 1000 // Play waveform after 1 second of no edits
-uint32_t last_edit_time = 0;
-bool params_changed = false;
+// Step sequencer over the drum presets - the hats share a choke group
+#define SEQUENCER_AUTOSTART 0 // 1: play the default pattern from boot
+#define CHOKE_HATS 1
 
-extern uint16_t pwm_buf[MAX_SAMPLES];
-static float lcd_buf[MAX_SAMPLES]; // Float buffer for LCD display
+static void setup_sequencer(void) {
+    for (int t = 0; t < SEQ_TRACKS && t < num_presets; t++) {
+        audio_core_set_track(t, &drum_presets[t], (t == 2 || t == 5) ? CHOKE_HATS : CHOKE_NONE);
+    }
+
+    // Bit n = step n (16ths)
+    sequencer_set_pattern(0, 0x1111); // Kick on the beat
+    sequencer_set_pattern(1, 0x1010); // Snare on 2 and 4
+    sequencer_set_pattern(2, 0x5555); // Closed hat on 8ths
+    sequencer_set_pattern(5, 0x8080); // Open hat on the last 16th of each half
+    sequencer_set_swing(0.2f);
+
+    if (SEQUENCER_AUTOSTART) {
+        audio_core_sequencer_run(true);
+    }
+}
+
+// Delay send on the mix: a short diffused feedback delay reads as a small room
+#define FX_ROOM 0 // 1: room on the mix from boot (changes the sound of every preset)
+static const FxDelayParams room = {
+    .time = 0.07f, .feedback = 0.45f, .send = 0.3f, .level = 0.35f, .diffusion = 0.6f};
+
+// Print the render kernel benchmark at boot, before the audio side starts
+#define KERNEL_BENCH 0
+
+// Audio streams from small blocks, so only a decimated preview is kept for the LCD
+#define PREVIEW_SPAN 8192 // Samples shown on screen (~0.37 s)
+static uint16_t lcd_buf[LCD_PLOT_POINTS];
+
+// Intermediate stage outputs, so pot edits only re-run the stages they affect
+static int16_t preview_osc[PREVIEW_SPAN];
+static int16_t preview_filtered[PREVIEW_SPAN];
+static int16_t preview_shaped[PREVIEW_SPAN];
+static WaveStageCache preview;
+
+// Morph slot: the pot sweeps kick -> snare -> ... -> open hat
+static MorphPath morph;
+
+// The last edit survives a power cycle: saved (params only, one page program) once the
+// pots have been still for PRESET_AUTOSAVE_MS, and restored at boot
+#define PRESET_SLOT_LAST_EDIT 0
+#define PRESET_AUTOSAVE_MS 3000
+
+// Morph position for the menu in percent, -1 until the pot has been turned in the slot
+static int morph_percent(void) {
+    return (morph.position < 0) ? -1 : morph.position * 100 / (MORPH_POSITIONS - 1);
+}
 
 int main() {
     stdio_init_all();
@@ -89,10 +140,32 @@ int main() {
     init_button(BUTTON_PIN_RIGHT);
     init_adc_dma();
 
-    pwm_audio_init();
+    if (KERNEL_BENCH) {
+        kernel_bench_run();
+    }
+
+    // Before core 1 starts, so a first-boot format has no audio to stall
+    if (!preset_store_init()) {
+        printf("Preset store: flash write failed\n");
+    }
+
+    // Audio engine on core 1 (AUDIO_ON_CORE1); presets play straight from RAM from
+    // the first hit
+    audio_core_init(drum_presets, num_presets);
+    printf("Sample bank: %d samples\n", sample_bank_count()); // Read-only flash, safe here
+    PresetStoreStats store;
+    preset_store_get_stats(&store);
+    printf("Preset store: %d presets, %d KB free\n", store.records, store.bytes_free / 1024);
+    if (FX_ROOM) {
+        audio_core_set_fx(&room);
+    }
+    setup_sequencer();
     setup_lcd();
+    waveform_stages_init(&preview, preview_osc, preview_filtered, preview_shaped, PREVIEW_SPAN);
 
-    adc_buffer = drum_presets[0];
+    const PresetRecord* last_edit = preset_store_get(PRESET_SLOT_LAST_EDIT);
+    adc_buffer = last_edit ? last_edit->params : drum_presets[0];
+    morph_init(&morph, drum_presets, num_presets); // Up to MORPH_MAX_POINTS
 
     // Set the global pointer to our params (this is for later when we have 8 params)
     set_current_params(&adc_buffer);
@@ -102,13 +175,27 @@ int main() {
                       (int) (0), (int) (0),
                       (int) (0), (int) (0),
                       (int) (0), (int) (0),
-                      (int) (0), 0);
+                      (int) (0), 0, -1);
 
+    int slot = idx;
+    uint32_t edit_ms = 0;
+    bool edit_unsaved = false;
     for (;;) {
-        uint32_t current_time = to_ms_since_boot(get_absolute_time());
+        // Entering the morph slot doesn't change the sound until the pot is turned
+        if (idx != slot) {
+            slot = idx;
+            if (slot == MORPH_SLOT)
+                morph_rearm(&morph, raw_adc_val * (1.0f / 4095.0f));
+        }
 
-        // Update potentiometer values - returns true if params changed
-        bool params_updated = update_pots(&adc_buffer);
+        // Update potentiometer values - returns true if params changed. In the morph slot
+        // the pot moves along the preset path instead of setting one param.
+        bool params_updated;
+        if (slot == MORPH_SLOT) {
+            params_updated = morph_update(&morph, raw_adc_val * (1.0f / 4095.0f), &adc_buffer);
+        } else {
+            params_updated = update_pots(&adc_buffer);
+        }
 
         if (update_lcd_params) {
             update_lcd_params = false;
@@ -118,36 +205,49 @@ int main() {
                 (int) (adc_buffer.amplitude * 100), (int) (adc_buffer.decay * 100),
                 (int) (adc_buffer.offset_dc * 100), (int) (adc_buffer.pitch_decay * 100),
                 (int) (adc_buffer.noise_mix * 100), (int) (adc_buffer.env_curve * 100),
-                (int) (adc_buffer.comp_amount * 100), idx);
+                (int) (adc_buffer.comp_amount * 100), idx, morph_percent());
         }
         if (params_updated || menu_updated) {
-            // Regenerate waveform with new parameters
-            waveform_generate_pwm(pwm_buf, MAX_SAMPLES, &adc_buffer);
-            waveform_generate(pwm_buf, MAX_SAMPLES, &adc_buffer); // Generate float version for
+            // Render just enough of the new sound for the display
+            waveform_render_preview(&preview, lcd_buf, LCD_PLOT_POINTS, &adc_buffer);
 
             // Redraw LCD display
 
             // LCD_DrawFillRectangle(11, 60, 319, 239, BLACK);
 
-            LCD_PlotWaveform(pwm_buf, MAX_SAMPLES);
+            LCD_PlotWaveform(lcd_buf, LCD_PLOT_POINTS);
             LCD_PrintWaveMenu(
                 adc_buffer.waveform_id, (int) adc_buffer.frequency,
                 (int) (adc_buffer.amplitude * 100), (int) (adc_buffer.decay * 100),
                 (int) (adc_buffer.offset_dc * 100), (int) (adc_buffer.pitch_decay * 100),
                 (int) (adc_buffer.noise_mix * 100), (int) (adc_buffer.env_curve * 100),
-                (int) (adc_buffer.comp_amount * 100), idx);
+                (int) (adc_buffer.comp_amount * 100), idx, morph_percent());
+
+            // Heard at once: the sounding live voice glides to the new params (no
+            // re-render), or a new one starts if the last has ended
+            audio_core_edit_live(&adc_buffer);
 
-            params_changed = true;
             menu_updated = false;
-            last_edit_time = current_time;
         }
 
-        if (params_changed && (current_time - last_edit_time) >= EDIT_TIMEOUT_MS) {
-            printf("Playing waveform...\n");
-
-            pwm_play_pwm_nonblocking(pwm_buf, MAX_SAMPLES);
+        // Autosave once the pots settle, not on every step of a turn
+        uint32_t now = to_ms_since_boot(get_absolute_time());
+        if (params_updated) {
+            edit_ms = now;
+            edit_unsaved = true;
+        } else if (edit_unsaved && now - edit_ms >= PRESET_AUTOSAVE_MS) {
+            edit_unsaved = false;
+            if (!preset_store_save(PRESET_SLOT_LAST_EDIT, "last edit", &adc_buffer, false)) {
+                printf("Preset store: autosave failed\n");
+            }
+        }
 
-            params_changed = false; // Reset change flag
+        // Notifications from the audio core
+        AudioEvent ev;
+        while (audio_core_poll(&ev)) {
+            if (ev.type == AUDIO_EVT_RENDERED) {
+                printf("Rendered #%u\n", (unsigned) ev.arg);
+            }
         }
 
         // only sleep if nothing happened
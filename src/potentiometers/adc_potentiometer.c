@@ -25,15 +25,16 @@ void button_isr_left() {
         gpio_acknowledge_irq(BUTTON_PIN_LEFT, GPIO_IRQ_EDGE_RISE);
 
         // Toggle mode flag
-        if (idx == 0 || idx == 3 || idx == 4 || idx == 7) {
+        if (idx == 0 || idx == 3 || idx == 4 || idx == 7 || idx == MORPH_SLOT) {
             update_lcd_params = true;
         }
         menu_updated = true;
         idx--;
-        idx = (idx < 0) ? (PARAM_NUM - 1) : idx;
+        idx = (idx < 0) ? (MENU_SLOTS - 1) : idx;
 
         // Mark new parameter as not engaged yet
-        pot_engaged[idx] = false;
+        if (idx < PARAM_NUM)
+            pot_engaged[idx] = false;
     }
 }
 
@@ -44,15 +45,16 @@ void button_isr_right() {
         gpio_acknowledge_irq(BUTTON_PIN_RIGHT, GPIO_IRQ_EDGE_RISE);
 
         // Toggle mode flag
-        if (idx == 0 || idx == 3 || idx == 4 || idx == 7) {
+        if (idx == 0 || idx == 3 || idx == 4 || idx == 7 || idx == MORPH_SLOT) {
             update_lcd_params = true;
         }
         menu_updated = true;
         idx++;
-        idx = (idx >= PARAM_NUM) ? 0 : idx;
+        idx = (idx >= MENU_SLOTS) ? 0 : idx;
 
         // Mark new parameter as not engaged yet
-        pot_engaged[idx] = false;
+        if (idx < PARAM_NUM)
+            pot_engaged[idx] = false;
     }
 }
 
@@ -39,6 +39,8 @@ static const struct {
 #define POT_PIN 44                 // Pin num of ptentiomeer
 #define PARAM_NUM 8                // Number of parameters, 8 as we know of rn
 #define POT_ENGAGE_THRESHOLD 0.05f // Engagement threshold
+#define MORPH_SLOT PARAM_NUM       // Menu slot after the params: the pot morphs the presets
+#define MENU_SLOTS (PARAM_NUM + 1) // Slots the buttons cycle through
 
 extern volatile uint32_t raw_adc_val;
 extern volatile bool menu_updated;
@@ -0,0 +1,253 @@
+#include "audio_core.h"
+#include "pico/flash.h"
+#include "pico/multicore.h"
+#include "pico/stdlib.h"
+#include "preset_store.h"
+#include "pwm_audio.h"
+#include "render_cache.h"
+#include "sample_bank.h"
+#include "sequencer.h"
+#include <stddef.h>
+
+typedef enum {
+    CMD_PLAY,
+    CMD_PLAY_SAMPLE,
+    CMD_PLAY_STORED,
+    CMD_EDIT_LIVE,
+    CMD_SET_TRACK,
+    CMD_SEQUENCER,
+    CMD_SET_RETRIGGER,
+    CMD_SET_STEAL,
+    CMD_SET_FX,
+} AudioCmdType;
+
+typedef struct {
+    AudioCmdType type;
+    uint32_t id;
+    int arg;                 // Choke group, mode or run flag
+    int track;               // CMD_SET_TRACK, the bank index or the store slot
+    float gain, pitch;       // CMD_PLAY_SAMPLE, CMD_PLAY_STORED (gain only)
+    const WaveParams* sound; // CMD_SET_TRACK - must stay valid while assigned
+    WaveParams params;       // CMD_PLAY, CMD_EDIT_LIVE
+    FxDelayParams fx;        // CMD_SET_FX
+} AudioCmd;
+
+// ==================================================
+// RINGS (single producer, single consumer)
+// ==================================================
+// The producer fills a slot and then publishes it by advancing head; the consumer
+// reads it and then frees it by advancing tail. Shared SRAM is coherent between the
+// cores, so acquire/release ordering on the indices is all that is needed.
+#if AUDIO_ON_CORE1
+static AudioCmd cmd_ring[AUDIO_CMD_QUEUE];
+static uint32_t cmd_head; // Core 0
+static uint32_t cmd_tail; // Core 1
+#endif
+
+static AudioEvent evt_ring[AUDIO_EVENT_QUEUE];
+static uint32_t evt_head; // Audio side
+static uint32_t evt_tail; // Core 0
+
+static uint32_t next_id;
+
+static const WaveParams* prerender_sounds;
+static int prerender_count;
+
+static void execute(const AudioCmd* cmd);
+
+static void notify(AudioEventType type, uint32_t arg) {
+    uint32_t head = evt_head;
+    if (head - __atomic_load_n(&evt_tail, __ATOMIC_ACQUIRE) >= AUDIO_EVENT_QUEUE) {
+        return; // Core 0 isn't draining - drop rather than stall audio
+    }
+    evt_ring[head % AUDIO_EVENT_QUEUE] = (AudioEvent) {type, arg};
+    __atomic_store_n(&evt_head, head + 1, __ATOMIC_RELEASE);
+}
+
+static bool post(const AudioCmd* cmd) {
+#if AUDIO_ON_CORE1
+    uint32_t head = cmd_head;
+    if (head - __atomic_load_n(&cmd_tail, __ATOMIC_ACQUIRE) >= AUDIO_CMD_QUEUE) {
+        return false;
+    }
+    cmd_ring[head % AUDIO_CMD_QUEUE] = *cmd;
+    __atomic_store_n(&cmd_head, head + 1, __ATOMIC_RELEASE);
+    __sev(); // Wake core 1 from __wfe()
+#else
+    execute(cmd);
+#endif
+    return true;
+}
+
+// ==================================================
+// AUDIO SIDE
+// ==================================================
+// A stored render plays in place like a bank sample; a preset saved without one
+// synthesizes (through the render cache) like any other sound
+static void play_stored(int slot, float gain, int choke_group) {
+    const PresetRecord* r = preset_store_get(slot);
+    if (!r)
+        return;
+
+    SamplePlayer player;
+    if (sample_player_start_pcm(&player, preset_store_samples(r), r->length,
+                                (uint32_t) SAMPLE_RATE, 16, gain, 1.0f)) {
+        audio_engine_play_player(&player, choke_group);
+        return;
+    }
+    WaveParams p = r->params;
+    p.amplitude *= gain;
+    audio_engine_play_choke(&p, choke_group);
+}
+
+static void execute(const AudioCmd* cmd) {
+    switch (cmd->type) {
+    case CMD_PLAY:
+        audio_engine_play_choke(&cmd->params, cmd->arg);
+        notify(AUDIO_EVT_RENDERED, cmd->id);
+        break;
+    case CMD_PLAY_SAMPLE:
+        audio_engine_play_sample(cmd->track, cmd->gain, cmd->pitch, cmd->arg);
+        notify(AUDIO_EVT_RENDERED, cmd->id);
+        break;
+    case CMD_PLAY_STORED:
+        play_stored(cmd->track, cmd->gain, cmd->arg);
+        notify(AUDIO_EVT_RENDERED, cmd->id);
+        break;
+    case CMD_EDIT_LIVE:
+        audio_engine_edit_live(&cmd->params);
+        break;
+    case CMD_SET_TRACK:
+        sequencer_set_track(cmd->track, cmd->sound, cmd->arg);
+        break;
+    case CMD_SEQUENCER:
+        if (cmd->arg) {
+            sequencer_start();
+        } else {
+            sequencer_stop();
+        }
+        break;
+    case CMD_SET_RETRIGGER:
+        audio_engine_set_retrigger((RetriggerMode) cmd->arg);
+        break;
+    case CMD_SET_STEAL:
+        audio_engine_set_steal((VoiceStealMode) cmd->arg);
+        break;
+    case CMD_SET_FX:
+        audio_engine_set_fx(&cmd->fx);
+        break;
+    }
+}
+
+// Everything the engine, its DMA IRQ and the render cache need, on the calling core
+static void audio_side_init(void) {
+    pwm_audio_init(); // Registers the DMA IRQ on this core
+    audio_engine_init();
+    render_cache_init();
+    render_cache_prerender(prerender_sounds, prerender_count);
+    sample_bank_init();
+    sequencer_init();
+    notify(AUDIO_EVT_READY, 0);
+}
+
+#if AUDIO_ON_CORE1
+static uint32_t core1_stack[AUDIO_CORE1_STACK / sizeof(uint32_t)];
+
+static void core1_main(void) {
+    // Lets core 0 park this core while it writes flash (preset_store.c)
+    flash_safe_execute_core_init();
+    audio_side_init();
+
+    for (;;) {
+        uint32_t tail = cmd_tail;
+        if (tail == __atomic_load_n(&cmd_head, __ATOMIC_ACQUIRE)) {
+            __wfe(); // Until core 0 posts (__sev) or the DMA IRQ has run
+            continue;
+        }
+        execute(&cmd_ring[tail % AUDIO_CMD_QUEUE]);
+        __atomic_store_n(&cmd_tail, tail + 1, __ATOMIC_RELEASE);
+    }
+}
+#endif
+
+// ==================================================
+// CORE 0 API
+// ==================================================
+void audio_core_init(const WaveParams* prerender, int count) {
+    prerender_sounds = prerender;
+    prerender_count = count;
+
+#if AUDIO_ON_CORE1
+    // Own stack: block renders in the DMA IRQ nest on top of cache renders
+    multicore_launch_core1_with_stack(core1_main, core1_stack, sizeof(core1_stack));
+
+    // Wait for READY so nothing races the sequencer/cache setup on core 1
+    AudioEvent ev;
+    while (!(audio_core_poll(&ev) && ev.type == AUDIO_EVT_READY)) {
+        tight_loop_contents();
+    }
+#else
+    audio_side_init();
+#endif
+}
+
+uint32_t audio_core_play(const WaveParams* p, int choke_group) {
+    AudioCmd cmd = {.type = CMD_PLAY, .id = ++next_id, .arg = choke_group, .params = *p};
+    return post(&cmd) ? cmd.id : 0;
+}
+
+uint32_t audio_core_play_sample(int index, float gain, float pitch, int choke_group) {
+    AudioCmd cmd = {.type = CMD_PLAY_SAMPLE,
+                    .id = ++next_id,
+                    .track = index,
+                    .gain = gain,
+                    .pitch = pitch,
+                    .arg = choke_group};
+    return post(&cmd) ? cmd.id : 0;
+}
+
+uint32_t audio_core_play_stored(int slot, float gain, int choke_group) {
+    AudioCmd cmd = {
+        .type = CMD_PLAY_STORED, .id = ++next_id, .track = slot, .gain = gain, .arg = choke_group};
+    return post(&cmd) ? cmd.id : 0;
+}
+
+bool audio_core_edit_live(const WaveParams* p) {
+    AudioCmd cmd = {.type = CMD_EDIT_LIVE, .params = *p};
+    return post(&cmd);
+}
+
+bool audio_core_set_track(int track, const WaveParams* sound, int choke_group) {
+    AudioCmd cmd = {.type = CMD_SET_TRACK, .track = track, .sound = sound, .arg = choke_group};
+    return post(&cmd);
+}
+
+bool audio_core_sequencer_run(bool run) {
+    AudioCmd cmd = {.type = CMD_SEQUENCER, .arg = run};
+    return post(&cmd);
+}
+
+bool audio_core_set_retrigger(RetriggerMode mode) {
+    AudioCmd cmd = {.type = CMD_SET_RETRIGGER, .arg = mode};
+    return post(&cmd);
+}
+
+bool audio_core_set_steal(VoiceStealMode mode) {
+    AudioCmd cmd = {.type = CMD_SET_STEAL, .arg = mode};
+    return post(&cmd);
+}
+
+bool audio_core_set_fx(const FxDelayParams* fx) {
+    AudioCmd cmd = {.type = CMD_SET_FX, .fx = *fx};
+    return post(&cmd);
+}
+
+bool audio_core_poll(AudioEvent* ev) {
+    uint32_t tail = evt_tail;
+    if (tail == __atomic_load_n(&evt_head, __ATOMIC_ACQUIRE)) {
+        return false;
+    }
+    *ev = evt_ring[tail % AUDIO_EVENT_QUEUE];
+    __atomic_store_n(&evt_tail, tail + 1, __ATOMIC_RELEASE);
+    return true;
+}
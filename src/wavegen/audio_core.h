@@ -0,0 +1,53 @@
+#ifndef AUDIO_CORE_H
+#define AUDIO_CORE_H
+
+#include "audio_engine.h"
+#include "waveform_gen.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Front end for the audio side: the streaming engine, its DMA IRQ, the render cache
+// and the sequencer clock. With AUDIO_ON_CORE1 they all live on core 1 and core 0 talks
+// to them through a lock-free command ring, so LCD/SPI work on core 0 can never hold up
+// a block render. With AUDIO_ON_CORE1 0 the same calls run inline on core 0.
+
+#ifndef AUDIO_ON_CORE1 // Override with -DAUDIO_ON_CORE1=0
+#define AUDIO_ON_CORE1 1
+#endif
+
+#define AUDIO_CMD_QUEUE 16   // Commands in flight from core 0
+#define AUDIO_EVENT_QUEUE 16 // Notifications waiting for core 0
+#define AUDIO_CORE1_STACK 8192
+
+typedef enum {
+    AUDIO_EVT_READY,   // Audio side initialized (presets rendered)
+    AUDIO_EVT_RENDERED // A play command finished, including any cache render; arg = its id
+} AudioEventType;
+
+typedef struct {
+    AudioEventType type;
+    uint32_t arg;
+} AudioEvent;
+
+// Brings up the audio side, renders sounds into the render cache (e.g. the presets) and
+// opens the flash sample bank.
+// Returns once it is ready, so the sequencer setters below are safe to call.
+void audio_core_init(const WaveParams* prerender, int count);
+
+// Commands - params are copied; each returns false if the command ring is full.
+// audio_core_play returns an id that comes back in its AUDIO_EVT_RENDERED event.
+uint32_t audio_core_play(const WaveParams* p, int choke_group);
+uint32_t audio_core_play_sample(int index, float gain, float pitch, int choke_group);
+// A preset_store.h slot: its stored render, played in place, or else its params
+uint32_t audio_core_play_stored(int slot, float gain, int choke_group);
+bool audio_core_edit_live(const WaveParams* p); // See audio_engine_edit_live
+bool audio_core_set_track(int track, const WaveParams* sound, int choke_group);
+bool audio_core_sequencer_run(bool run);
+bool audio_core_set_retrigger(RetriggerMode mode);
+bool audio_core_set_steal(VoiceStealMode mode);
+bool audio_core_set_fx(const FxDelayParams* fx);
+
+// Next notification from the audio side; false when there is none
+bool audio_core_poll(AudioEvent* ev);
+
+#endif
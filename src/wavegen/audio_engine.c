@@ -0,0 +1,523 @@
+#include "audio_engine.h"
+#include "dsp.h"
+#include "hardware/clocks.h"
+#include "pico/stdlib.h"
+#include "pwm_audio.h"
+#include "render_cache.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct {
+    WaveVoice wave;
+    const RenderCacheEntry* cached; // Pinned render played instead of wave, or NULL
+    int cache_pos;
+    bool from_bank; // Plays player (flash sample) instead of wave
+    SamplePlayer player;
+    bool live; // Synthesized voice that follows audio_engine_edit_live()
+    bool active;
+    int choke_group;
+    uint32_t age;   // Trigger sequence number - lower is older
+    int delay;      // Samples into the current block before the voice starts
+    int fade_pos;   // < RETRIGGER_FADE_SAMPLES while fading out after a choke or steal
+    int fade_start; // Sample in the current block where the fade begins
+} EngineVoice;
+
+static EngineVoice voices[AUDIO_MAX_VOICES];
+static EngineVoice stolen; // Voice whose slot was just reused, faded out underneath
+static uint32_t next_age;
+static RetriggerMode retrigger_mode = RETRIGGER_CROSSFADE;
+static VoiceStealMode steal_mode = STEAL_QUIETEST;
+
+// Mix bus and per-voice scratch - IRQ only, kept off the 2KB IRQ stack
+static int32_t mix_bus[AUDIO_BLOCK_SIZE];
+static int32_t voice_buf[AUDIO_BLOCK_SIZE];
+static PwmQuantizer quantizer;
+
+static AudioEngineStats stats;
+static uint32_t cycles_per_us;
+
+static int fx_tail_left; // Samples the delay keeps ringing after the voices have ended
+
+static volatile AudioBlockHook block_hook;
+static void* volatile block_hook_ctx;
+
+// ==================================================
+// TRIGGER HANDOFF (lock-free single-producer queue)
+// ==================================================
+// Main writes a slot and then publishes it by advancing trig_head; the IRQ reads the
+// slot and then releases it by advancing trig_tail. A slot is never written while the
+// IRQ may read it, so edits to the caller's params can't tear a sound, and several hits
+// landing between two blocks all play.
+typedef struct {
+    WaveParams params;
+    const RenderCacheEntry* cached; // Pinned by the caller, or NULL to synthesize
+    int choke_group;
+    bool from_bank; // Play player instead of params/cached
+    SamplePlayer player;
+    bool live;
+} Trigger;
+
+static Trigger trig_queue[AUDIO_TRIGGER_QUEUE];
+static uint32_t trig_head; // Written by main only
+static uint32_t trig_tail; // Written by the IRQ only
+
+// Exactly one of p and player is non-NULL
+static bool trigger_push(const WaveParams* p, const RenderCacheEntry* cached,
+                         const SamplePlayer* player, int choke_group, bool live) {
+    uint32_t head = trig_head;
+    if (head - __atomic_load_n(&trig_tail, __ATOMIC_ACQUIRE) >= AUDIO_TRIGGER_QUEUE) {
+        return false; // IRQ hasn't caught up - drop the hit
+    }
+    Trigger* t = &trig_queue[head % AUDIO_TRIGGER_QUEUE];
+    t->from_bank = (player != NULL);
+    if (player) {
+        t->player = *player;
+    } else {
+        t->params = *p;
+    }
+    t->cached = cached;
+    t->choke_group = choke_group;
+    t->live = live;
+    __atomic_store_n(&trig_head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+static const Trigger* trigger_peek(void) {
+    uint32_t tail = trig_tail;
+    if (tail == __atomic_load_n(&trig_head, __ATOMIC_ACQUIRE)) {
+        return NULL;
+    }
+    return &trig_queue[tail % AUDIO_TRIGGER_QUEUE];
+}
+
+static void trigger_pop(void) {
+    __atomic_store_n(&trig_tail, trig_tail + 1, __ATOMIC_RELEASE);
+}
+
+// ==================================================
+// LIVE EDITS (latest-value mailbox)
+// ==================================================
+// Only the newest edit matters, so instead of queueing, main overwrites one slot under a
+// sequence count (odd while writing) and the IRQ takes a copy when the count is even and
+// unchanged across the copy.
+static WaveParams live_slot;
+static volatile uint32_t live_seq; // Written by main only
+static uint32_t live_seen;         // IRQ only
+static uint32_t live_trigger_end;  // Main only: trig_head just past the last live trigger
+
+static void live_publish(const WaveParams* p) {
+    __atomic_store_n(&live_seq, live_seq + 1, __ATOMIC_RELEASE);
+    live_slot = *p;
+    __atomic_store_n(&live_seq, live_seq + 1, __ATOMIC_RELEASE);
+}
+
+static bool live_take(WaveParams* out) {
+    uint32_t seq = __atomic_load_n(&live_seq, __ATOMIC_ACQUIRE);
+    if ((seq & 1) || seq == live_seen)
+        return false;
+    *out = live_slot;
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if (__atomic_load_n(&live_seq, __ATOMIC_RELAXED) != seq)
+        return false; // Overwritten mid-copy - take it next block
+    live_seen = seq;
+    return true;
+}
+
+// ==================================================
+// VOICE ALLOCATION (runs in the DMA IRQ)
+// ==================================================
+static bool voice_fading(const EngineVoice* v) {
+    return v->fade_pos < RETRIGGER_FADE_SAMPLES;
+}
+
+static bool voice_ended(const EngineVoice* v) {
+    if (v->from_bank)
+        return sample_player_done(&v->player);
+    if (v->cached)
+        return v->cache_pos >= render_cache_length(v->cached);
+    return v->wave.pos >= v->wave.total_samples;
+}
+
+// Current loudness estimate for stealing
+static float voice_level(const EngineVoice* v) {
+    if (v->from_bank)
+        return sample_player_level(&v->player);
+    if (v->cached)
+        return render_cache_level(v->cached, v->cache_pos) * (1.0f / Q15_ONE);
+    return v->wave.params.amplitude * envelope_level(&v->wave.env);
+}
+
+static int voice_render(EngineVoice* v, int32_t* out, int len) {
+    if (v->from_bank)
+        return sample_player_render(&v->player, out, len);
+    if (v->cached) {
+        int n = render_cache_read(v->cached, v->cache_pos, out, len);
+        v->cache_pos += n;
+        return n;
+    }
+    return waveform_voice_render_q15(&v->wave, out, len);
+}
+
+static void voice_deactivate(EngineVoice* v) {
+    v->active = false;
+    if (v->cached) {
+        render_cache_release(v->cached);
+        v->cached = NULL;
+    }
+}
+
+// Steal priority: a voice already fading out, then the oldest or quietest
+static EngineVoice* voice_pick_victim(void) {
+    EngineVoice* victim = &voices[0];
+    float victim_level = 2.0f;
+
+    for (int k = 0; k < AUDIO_MAX_VOICES; k++) {
+        EngineVoice* v = &voices[k];
+        if (voice_fading(v)) {
+            return v;
+        }
+        if (steal_mode == STEAL_OLDEST) {
+            if (v->age < victim->age)
+                victim = v;
+        } else {
+            float level = voice_level(v);
+            if (level < victim_level) {
+                victim = v;
+                victim_level = level;
+            }
+        }
+    }
+    return victim;
+}
+
+static EngineVoice* voice_alloc(int offset) {
+    for (int k = 0; k < AUDIO_MAX_VOICES; k++) {
+        if (!voices[k].active) {
+            return &voices[k];
+        }
+    }
+
+    // All busy: move the victim to the release slot so it fades instead of clicking.
+    // A second steal in the same block replaces that release, which then cuts hard.
+    EngineVoice* victim = voice_pick_victim();
+    if (stolen.active) {
+        voice_deactivate(&stolen);
+    }
+    stolen = *victim; // Takes over the victim's cache pin
+    if (!voice_fading(&stolen)) {
+        stolen.fade_pos = 0;
+        stolen.fade_start = offset;
+    }
+    return victim;
+}
+
+// Claims a voice that starts offset samples into the current block; choked or stolen
+// voices start fading at the same sample. The caller sets up its source.
+static EngineVoice* voice_claim(int choke_group, int offset) {
+    if (choke_group != CHOKE_NONE) {
+        for (int k = 0; k < AUDIO_MAX_VOICES; k++) {
+            EngineVoice* v = &voices[k];
+            if (v->active && v->choke_group == choke_group && !voice_fading(v)) {
+                v->fade_pos = 0;
+                v->fade_start = offset;
+            }
+        }
+    }
+
+    EngineVoice* v = voice_alloc(offset);
+    v->active = true;
+    v->choke_group = choke_group;
+    v->age = next_age++;
+    v->delay = offset;
+    v->fade_pos = RETRIGGER_FADE_SAMPLES;
+    return v;
+}
+
+static EngineVoice* voice_trigger(const WaveParams* p, const RenderCacheEntry* cached,
+                                  int choke_group, int offset) {
+    EngineVoice* v = voice_claim(choke_group, offset);
+    v->from_bank = false;
+    v->live = false;
+    v->cached = cached;
+    v->cache_pos = 0;
+    if (!cached) {
+        // Own noise per trigger (age counts triggers): a snare and a hat starting together
+        // would otherwise sum the same sequence coherently
+        waveform_voice_start(&v->wave, p);
+        waveform_voice_seed(&v->wave, v->age);
+    }
+    return v;
+}
+
+static void voice_trigger_sample(const SamplePlayer* player, int choke_group, int offset) {
+    EngineVoice* v = voice_claim(choke_group, offset);
+    v->from_bank = true;
+    v->live = false;
+    v->cached = NULL;
+    v->player = *player;
+}
+
+static void voices_reset(void) {
+    for (int k = 0; k < AUDIO_MAX_VOICES; k++) {
+        if (voices[k].active)
+            voice_deactivate(&voices[k]);
+    }
+    if (stolen.active)
+        voice_deactivate(&stolen);
+}
+
+// ==================================================
+// BLOCK FILL (runs in the DMA IRQ)
+// ==================================================
+// Adds one voice to the bus from its start sample; a fading voice only renders
+// up to the end of its fade
+static void mix_voice(EngineVoice* v, int len) {
+    int begin = v->delay;
+    int end = len;
+    int fade_at = len;
+    v->delay = 0;
+
+    if (voice_fading(v)) {
+        fade_at = (v->fade_start > begin) ? v->fade_start : begin;
+        end = fade_at + RETRIGGER_FADE_SAMPLES - v->fade_pos;
+        if (end > len)
+            end = len;
+        v->fade_start = 0;
+    }
+    if (begin >= end) {
+        return; // Starts in a later block
+    }
+
+    int n = voice_render(v, voice_buf, end - begin);
+    int32_t* bus = mix_bus + begin;
+    int i = 0;
+    for (; i < n && begin + i < fade_at; i++) {
+        bus[i] += voice_buf[i];
+    }
+    for (; i < n; i++, v->fade_pos++) {
+        // Linear fade: gain 256 -> 0 over RETRIGGER_FADE_SAMPLES
+        int32_t gain = 256 - (v->fade_pos * 256) / RETRIGGER_FADE_SAMPLES;
+        bus[i] += (voice_buf[i] * gain) >> 8;
+    }
+
+    bool done;
+    if (n < end - begin) {
+        done = true; // Sound ended
+    } else if (voice_fading(v)) {
+        done = (end < len); // Otherwise the fade continues into the next block
+    } else {
+        done = voice_ended(v);
+    }
+    if (done) {
+        voice_deactivate(v);
+    }
+}
+
+static bool engine_fill(uint16_t* block, int slots, void* ctx) {
+    uint32_t start_us = time_us_32();
+    int len = slots / AUDIO_OVERSAMPLE; // Samples
+
+    // New hits start only at a block boundary
+    const Trigger* t;
+    while ((t = trigger_peek()) != NULL) {
+        if (t->from_bank) {
+            voice_trigger_sample(&t->player, t->choke_group, 0);
+        } else {
+            voice_trigger(&t->params, t->cached, t->choke_group, 0)->live = t->live;
+        }
+        trigger_pop();
+    }
+
+    // Newest live edit: sounding live voices glide to it
+    WaveParams edit;
+    if (live_take(&edit)) {
+        for (int k = 0; k < AUDIO_MAX_VOICES; k++) {
+            if (voices[k].active && voices[k].live) {
+                waveform_voice_retarget(&voices[k].wave, &edit);
+            }
+        }
+    }
+
+    // Sample-accurate triggers from the block clock (sequencer)
+    AudioBlockHook hook = block_hook;
+    if (hook) {
+        hook(len, block_hook_ctx);
+    }
+
+    for (int i = 0; i < len; i++) {
+        mix_bus[i] = 0;
+    }
+
+    // The int32 bus has headroom for every voice at full scale, so the sum never wraps
+    // and only saturates once, in the soft clip
+    int active = 0;
+    for (int k = 0; k < AUDIO_MAX_VOICES; k++) {
+        if (voices[k].active) {
+            mix_voice(&voices[k], len);
+            active++;
+        }
+    }
+    if (stolen.active) {
+        mix_voice(&stolen, len);
+    }
+
+    uint32_t fx_us = time_us_32();
+    if (fx_delay_active()) {
+        fx_delay_process(mix_bus, len);
+        fx_tail_left = (active || stolen.active) ? fx_delay_tail() : fx_tail_left - len;
+    } else {
+        fx_tail_left = 0;
+    }
+    fx_us = time_us_32() - fx_us;
+
+    dsp_soft_clip_q15(mix_bus, len);
+    quantizer_run(&quantizer, mix_bus, block, len);
+
+    stats.last_cycles = (time_us_32() - start_us) * cycles_per_us;
+    if (stats.last_cycles > stats.max_cycles)
+        stats.max_cycles = stats.last_cycles;
+    stats.fx_cycles = fx_us * cycles_per_us;
+    stats.active_voices = active;
+
+    // Keep streaming (silence if need be) while a block clock is attached or echoes ring
+    if (block_hook || fx_tail_left > 0)
+        return true;
+    for (int k = 0; k < AUDIO_MAX_VOICES; k++) {
+        if (voices[k].active)
+            return true;
+    }
+    return stolen.active;
+}
+
+void audio_engine_trigger_at(const WaveParams* p, const RenderCacheEntry* cached, int choke_group,
+                             int offset) {
+    if (cached) {
+        render_cache_pin(cached); // The voice's own pin, dropped when it ends
+    }
+    voice_trigger(p, cached, choke_group, offset);
+}
+
+void audio_engine_set_block_hook(AudioBlockHook hook, void* ctx) {
+    // Clear first so the IRQ never pairs the new hook with the old context
+    block_hook = NULL;
+    block_hook_ctx = ctx;
+    block_hook = hook;
+
+    if (hook && !pwm_is_playing()) {
+        pwm_stream_start(engine_fill, NULL);
+    }
+}
+
+void audio_engine_init(void) {
+    voices_reset();
+    quantizer_init(&quantizer, AUDIO_QUANTIZER, AUDIO_OVERSAMPLE);
+    fx_delay_init();
+    fx_tail_left = 0;
+
+    uint32_t sys_hz = clock_get_hz(clk_sys);
+    cycles_per_us = sys_hz / 1000000;
+    stats.budget_cycles = (uint32_t) (AUDIO_BLOCK_SIZE * (sys_hz / SAMPLE_RATE));
+    audio_engine_reset_stats();
+}
+
+void audio_engine_set_retrigger(RetriggerMode mode) {
+    retrigger_mode = mode;
+}
+
+void audio_engine_set_steal(VoiceStealMode mode) {
+    steal_mode = mode;
+}
+
+void audio_engine_set_fx(const FxDelayParams* fx) {
+    fx_delay_set(fx);
+}
+
+void audio_engine_play(const WaveParams* p) {
+    audio_engine_play_choke(p, CHOKE_NONE);
+}
+
+// Triggers a sound on a free voice (or a stolen one when all are busy). A cached
+// render plays with no synthesis at all; otherwise the voice synthesizes.
+void audio_engine_play_choke(const WaveParams* p, int choke_group) {
+    if (pwm_is_playing() && retrigger_mode == RETRIGGER_CUT) {
+        // Stop the DMA so no IRQ can touch the voices, then restart below
+        pwm_stream_stop();
+        voices_reset();
+    }
+
+    const RenderCacheEntry* cached = render_cache_lookup(p);
+    if (!trigger_push(p, cached, NULL, choke_group, false) && cached) {
+        render_cache_release(cached);
+    }
+
+    if (!pwm_is_playing()) {
+        pwm_stream_start(engine_fill, NULL);
+    }
+
+    // Missed: render it now, while it plays, so the next hit of this sound is free
+    if (!cached) {
+        const RenderCacheEntry* e = render_cache_acquire(p);
+        if (e)
+            render_cache_release(e);
+    }
+}
+
+// Flash samples need no rendering or caching - the voice reads the bank in place
+bool audio_engine_play_sample(int index, float gain, float pitch, int choke_group) {
+    SamplePlayer player;
+    if (!sample_player_start(&player, index, gain, pitch))
+        return false;
+    audio_engine_play_player(&player, choke_group);
+    return true;
+}
+
+void audio_engine_play_player(const SamplePlayer* player, int choke_group) {
+    if (pwm_is_playing() && retrigger_mode == RETRIGGER_CUT) {
+        pwm_stream_stop();
+        voices_reset();
+    }
+    trigger_push(NULL, NULL, player, choke_group, false);
+    if (!pwm_is_playing()) {
+        pwm_stream_start(engine_fill, NULL);
+    }
+}
+
+// Live voices always synthesize (a cached render can't follow edits)
+void audio_engine_edit_live(const WaveParams* p) {
+    live_publish(p);
+
+    // A live trigger still in the queue counts as sounding - it picks up this edit too
+    uint32_t tail = __atomic_load_n(&trig_tail, __ATOMIC_ACQUIRE);
+    bool sounding = (int32_t) (live_trigger_end - tail) > 0;
+    for (int k = 0; k < AUDIO_MAX_VOICES; k++) {
+        sounding = sounding || (voices[k].active && voices[k].live && !voice_fading(&voices[k]));
+    }
+    if (sounding)
+        return;
+
+    if (pwm_is_playing() && retrigger_mode == RETRIGGER_CUT) {
+        pwm_stream_stop();
+        voices_reset();
+    }
+    if (trigger_push(p, NULL, NULL, CHOKE_LIVE, true)) {
+        live_trigger_end = trig_head;
+    }
+    if (!pwm_is_playing()) {
+        pwm_stream_start(engine_fill, NULL);
+    }
+}
+
+bool audio_engine_is_playing(void) {
+    return pwm_is_playing();
+}
+
+void audio_engine_get_stats(AudioEngineStats* out) {
+    *out = stats;
+}
+
+void audio_engine_reset_stats(void) {
+    stats.last_cycles = 0;
+    stats.max_cycles = 0;
+    stats.active_voices = 0;
+}
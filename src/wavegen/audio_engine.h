@@ -0,0 +1,77 @@
+#ifndef AUDIO_ENGINE_H
+#define AUDIO_ENGINE_H
+
+#include "dither.h"
+#include "fx_delay.h"
+#include "render_cache.h"
+#include "sample_bank.h"
+#include "waveform_gen.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Polyphonic streaming engine: up to AUDIO_MAX_VOICES sounds render side by side, one
+// AUDIO_BLOCK_SIZE block at a time from the DMA IRQ, and are mixed into the PWM output
+// (int32 Q15 bus, through the delay send, soft clipped once per block, then dithered down
+// to PWM levels).
+
+#define AUDIO_MAX_VOICES 8        // Concurrent sounds before stealing starts
+#define AUDIO_TRIGGER_QUEUE 8     // Hits that can be pending between two blocks
+#define RETRIGGER_FADE_SAMPLES 64 // Fade when a voice is choked or stolen (~3 ms)
+
+#define CHOKE_NONE 0   // Choke group of sounds that never cut each other
+#define CHOKE_LIVE (-1) // Live-edit voices: a new one fades out the last
+
+#ifndef AUDIO_QUANTIZER // Mix bus -> PWM conversion, see dither.h
+#define AUDIO_QUANTIZER QUANT_SHAPED
+#endif
+
+typedef enum {
+    RETRIGGER_CROSSFADE, // New hit starts at the next block, layered over the playing voices
+    RETRIGGER_CUT        // Abort the current transfer, drop every voice and restart immediately
+} RetriggerMode;
+
+typedef enum {
+    STEAL_OLDEST,  // Reuse the voice that started first
+    STEAL_QUIETEST // Reuse the voice with the lowest current level
+} VoiceStealMode;
+
+// Render load, measured around each block fill
+typedef struct {
+    uint32_t last_cycles;   // Last block
+    uint32_t max_cycles;    // Worst block since init or audio_engine_reset_stats()
+    uint32_t budget_cycles; // One block period - going over it underruns the DMA
+    uint32_t fx_cycles;     // Delay bus share of last_cycles
+    int active_voices;      // Voices rendered in the last block
+} AudioEngineStats;
+
+// Block clock: called from the DMA IRQ at the start of every block, before mixing, with
+// the block length. It may call audio_engine_trigger_at() to start voices on exact samples.
+// While a hook is set the stream keeps running, playing silence between hits.
+typedef void (*AudioBlockHook)(int len, void* ctx);
+
+void audio_engine_init(void);                // Call after pwm_audio_init()
+void audio_engine_play(const WaveParams* p); // Params are copied - caller may keep editing
+// Same, but first fades out every voice in the same choke group (closed hat cuts open hat)
+void audio_engine_play_choke(const WaveParams* p, int choke_group);
+// Live editing: sounding live voices glide to p (see waveform_voice_retarget); if none is
+// sounding, p starts a new live voice. Call on every edit - no re-render is involved.
+void audio_engine_edit_live(const WaveParams* p);
+// Plays a flash sample bank entry in place (see sample_bank.h); false if index is invalid
+bool audio_engine_play_sample(int index, float gain, float pitch, int choke_group);
+// Plays a started player (sample_player_start_pcm), e.g. a stored render; its data must
+// stay readable until the voice ends
+void audio_engine_play_player(const SamplePlayer* player, int choke_group);
+void audio_engine_set_retrigger(RetriggerMode mode);
+void audio_engine_set_steal(VoiceStealMode mode);
+void audio_engine_set_fx(const FxDelayParams* fx);
+bool audio_engine_is_playing(void);
+
+void audio_engine_set_block_hook(AudioBlockHook hook, void* ctx); // NULL to detach
+// Block hook only (IRQ context): start a voice offset samples into the current block,
+// from cached (already pinned by the caller) when not NULL
+void audio_engine_trigger_at(const WaveParams* p, const RenderCacheEntry* cached, int choke_group,
+                             int offset);
+void audio_engine_get_stats(AudioEngineStats* stats);
+void audio_engine_reset_stats(void);
+
+#endif
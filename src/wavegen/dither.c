@@ -0,0 +1,65 @@
+#include "dither.h"
+#include "dsp.h"
+#include "pwm_audio.h"
+
+#define LSB (1 << 16)       // One PWM level in the Q16 level domain
+#define ERR_LIMIT (2 * LSB) // Caps the fed-back error when the output sits on a rail
+
+// Q15 sample -> PWM level with 16 fractional bits (the same mapping as pwm_level_q15)
+static inline int32_t level_q16(int32_t x) {
+    return (sat(x, -Q15_ONE, Q15_ONE) + 32768) * PWM_WRAP;
+}
+
+static inline uint16_t quantize(PwmQuantizer* q, int32_t v) {
+    if (q->mode == QUANT_TRUNCATE)
+        return (uint16_t) (v >> 16);
+
+    // Error feedback: the output is v + e filtered by the noise transfer function
+    // (1 - z^-1) at 1x or (1 - z^-1)^2 oversampled, which is zero at DC
+    int32_t u = v;
+    if (q->mode == QUANT_SHAPED) {
+        u -= (q->oversample > 1) ? 2 * q->err1 - q->err2 : q->err1;
+    }
+
+    // TPDF: two 16-bit uniforms from one draw, +-1 LSB triangular
+    uint32_t r = noise_next(&q->rng);
+    int32_t tpdf = (int32_t) (r & 0xFFFF) + (int32_t) (r >> 16) - LSB;
+
+    int32_t y = sat((u + tpdf + LSB / 2) >> 16, 0, PWM_WRAP);
+    q->err2 = q->err1;
+    q->err1 = sat((y << 16) - u, -ERR_LIMIT, ERR_LIMIT);
+    return (uint16_t) y;
+}
+
+void quantizer_init(PwmQuantizer* q, QuantMode mode, int oversample) {
+    q->mode = mode;
+    q->oversample = 1;
+    q->os_shift = 0;
+    while (q->oversample < oversample && q->oversample < 8) {
+        q->oversample <<= 1;
+        q->os_shift++;
+    }
+    q->prev = level_q16(0);
+    q->err1 = 0;
+    q->err2 = 0;
+    noise_seed(&q->rng, DITHER_SEED);
+}
+
+void quantizer_run(PwmQuantizer* q, const int32_t* in, uint16_t* out, int len) {
+    if (q->oversample == 1) {
+        for (int i = 0; i < len; i++) {
+            out[i] = quantize(q, level_q16(in[i]));
+        }
+        return;
+    }
+
+    // Linear interpolation up to the PWM rate; the last slot of each sample lands on it
+    for (int i = 0; i < len; i++) {
+        int32_t cur = level_q16(in[i]);
+        int32_t delta = cur - q->prev;
+        for (int k = 1; k <= q->oversample; k++) {
+            *out++ = quantize(q, q->prev + ((delta * k) >> q->os_shift));
+        }
+        q->prev = cur;
+    }
+}
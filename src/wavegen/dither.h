@@ -0,0 +1,36 @@
+#ifndef DITHER_H
+#define DITHER_H
+
+#include "noise.h"
+#include <stdint.h>
+
+// Output quantizer: Q15 samples -> PWM levels (PWM_WRAP + 1 steps). Instead of
+// truncating, it can add TPDF dither (turns quiet-signal distortion into a flat noise
+// floor) and shape the error with feedback so the noise lands above the audio band,
+// most effectively when the PWM runs oversampled. All fixed point, one xorshift per
+// output slot.
+
+#define DITHER_SEED 0xD1748E55u // Apart from the voices' noise, so the two don't correlate
+
+typedef enum {
+    QUANT_TRUNCATE, // Plain truncation, as the rest of the codebase does
+    QUANT_DITHER,   // TPDF dither, flat noise
+    QUANT_SHAPED    // TPDF dither + error feedback: 1st order at 1x, 2nd order oversampled
+} QuantMode;
+
+typedef struct {
+    QuantMode mode;
+    int oversample;     // PWM slots per sample: 1, 2, 4 or 8
+    int os_shift;       // log2(oversample)
+    int32_t prev;       // Last input sample (Q16 PWM level), for interpolation
+    int32_t err1, err2; // Quantization error history (Q16 levels)
+    NoiseGen rng;
+} PwmQuantizer;
+
+void quantizer_init(PwmQuantizer* q, QuantMode mode, int oversample);
+
+// len Q15 samples in [-32768, 32768] -> len * oversample PWM levels (linearly interpolated
+// between samples when oversampled)
+void quantizer_run(PwmQuantizer* q, const int32_t* in, uint16_t* out, int len);
+
+#endif
@@ -0,0 +1,190 @@
+#include "dsp.h"
+#include <math.h>
+
+void compressor_init(Compressor* c, float amount, bool is_sine) {
+    if (amount < 0.0f)
+        amount = 0.0f;
+    if (amount > 1.0f)
+        amount = 1.0f;
+
+    c->active = (amount > 0.0f);
+
+    float threshold = 0.8f - 0.6f * amount;
+    float ratio = is_sine ? 1.0f + 5.0f * amount : 1.0f + 9.0f * amount;
+    float makeup = is_sine ? 1.0f + 0.6f * amount : 1.0f + 1.0f * amount;
+    float limit = (amount > 0.8f) ? 1.0f - (1.0f - threshold) * 0.5f : 1.0f;
+
+    // All the divides happen here, once per sound
+    for (int i = 0; i <= COMP_LUT_SIZE; i++) {
+        float in = 2.0f * i / COMP_LUT_SIZE;
+        float out = (in > threshold) ? threshold + (in - threshold) / ratio : in;
+        out *= makeup;
+        if (out > limit)
+            out = limit;
+
+        c->curve[i] = (uint16_t) lrintf(out * Q15_ONE);
+    }
+}
+
+void dsp_noise_mix_q15(int16_t* osc, const int16_t* noise, int len, int32_t mix_q15) {
+    int32_t dry = Q15_ONE - mix_q15;
+    for (int i = 0; i < len; i++) {
+        osc[i] = (int16_t) ((osc[i] * dry + noise[i] * mix_q15) >> 15);
+    }
+}
+
+void dsp_noise_mix_float(float* osc, const float* noise, int len, float mix) {
+    float dry = 1.0f - mix;
+    for (int i = 0; i < len; i++) {
+        osc[i] = osc[i] * dry + noise[i] * mix;
+    }
+}
+
+// Interpolated curve lookup on a Q15 magnitude
+static inline int32_t comp_curve(const Compressor* c, uint32_t mag) {
+    if (mag > 0xFFFF)
+        mag = 0xFFFF;
+    uint32_t index = mag >> COMP_IN_SHIFT;
+    int32_t frac = (int32_t) (mag & ((1u << COMP_IN_SHIFT) - 1));
+    int32_t a = c->curve[index];
+    return a + (((c->curve[index + 1] - a) * frac) >> COMP_IN_SHIFT);
+}
+
+void dsp_compress_q15(const Compressor* c, int32_t* buf, int len) {
+    for (int i = 0; i < len; i++) {
+        int32_t x = buf[i];
+        int32_t sign = x >> 31; // 0 or -1
+        int32_t out = comp_curve(c, (uint32_t) ((x ^ sign) - sign));
+        buf[i] = (out ^ sign) - sign;
+    }
+}
+
+void dsp_compress_float(const Compressor* c, float* buf, int len) {
+    for (int i = 0; i < len; i++) {
+        float x = buf[i];
+        float mag = fminf(fabsf(x), 2.0f) * Q15_ONE;
+        float out = comp_curve(c, (uint32_t) mag) * (1.0f / Q15_ONE);
+        buf[i] = copysignf(out, x);
+    }
+}
+
+void dsp_soft_clip_q15(int32_t* buf, int len) {
+    const int32_t room = Q15_ONE - SOFT_CLIP_KNEE;
+    for (int i = 0; i < len; i++) {
+        int32_t x = buf[i];
+        int32_t sign = x >> 31;
+        int32_t mag = (x ^ sign) - sign;
+        if (mag > SOFT_CLIP_KNEE) {
+            // knee + room * e / (e + room), rearranged to stay in 32 bits (one hardware divide)
+            mag = Q15_ONE - (room * room) / (mag - SOFT_CLIP_KNEE + room);
+        }
+        buf[i] = (mag ^ sign) - sign;
+    }
+}
+
+// ==================================================
+// STATE-VARIABLE FILTER
+// ==================================================
+#define SVF_MIN_DAMPING 0.05f // Resonance limit: peak gain ~20x, inside the Q23 headroom
+#define SVF_MAX_CUTOFF 0.45f  // tan() blows up at Nyquist
+
+static inline int32_t svf_coef(float x) {
+    return (int32_t) lrintf(x * (float) (1 << SVF_COEF_BITS));
+}
+
+void svf_init(Svf* f, FilterType type, float res) {
+    f->type = type;
+    svf_set_resonance(f, res);
+    f->ic1 = f->ic2 = 0;
+    f->ic1f = f->ic2f = 0.0f;
+    svf_set_cutoff(f, SVF_MAX_CUTOFF);
+}
+
+void svf_set_resonance(Svf* f, float res) {
+    f->k = fmaxf(2.0f - 2.0f * res, SVF_MIN_DAMPING);
+    f->k_q = svf_coef(f->k);
+}
+
+void svf_set_cutoff(Svf* f, float cutoff) {
+    cutoff = fminf(fmaxf(cutoff, 0.0001f), SVF_MAX_CUTOFF);
+    float g = tanf(3.14159265f * cutoff);
+    f->a1 = 1.0f / (1.0f + g * (g + f->k));
+    f->a2 = g * f->a1;
+    f->a3 = g * f->a2;
+    f->a1_q = svf_coef(f->a1);
+    f->a2_q = svf_coef(f->a2);
+    f->a3_q = svf_coef(f->a3);
+}
+
+static inline int32_t svf_mul(int32_t coef, int32_t x) {
+    return (int32_t) (((int64_t) coef * x) >> SVF_COEF_BITS);
+}
+
+// One sample of the TPT SVF; the response type is a compile-time constant at each call
+// site, so every mode gets its own branch-free loop
+#define SVF_TICK_Q(type, x, y)                                                                     \
+    do {                                                                                           \
+        int32_t v0 = (x) << SVF_STATE_SHIFT;                                                       \
+        int32_t v3 = v0 - ic2;                                                                     \
+        int32_t v1 = svf_mul(a1, ic1) + svf_mul(a2, v3);                                           \
+        int32_t v2 = ic2 + svf_mul(a2, ic1) + svf_mul(a3, v3);                                     \
+        ic1 = 2 * v1 - ic1;                                                                        \
+        ic2 = 2 * v2 - ic2;                                                                        \
+        int32_t o = ((type) == FILTER_LOWPASS)    ? v2                                             \
+                    : ((type) == FILTER_BANDPASS) ? v1                                             \
+                                                  : v0 - svf_mul(k, v1) - v2;                      \
+        (y) = (int16_t) sat(o >> SVF_STATE_SHIFT, -Q15_ONE, Q15_ONE - 1);                          \
+    } while (0)
+
+#define SVF_LOOP_Q(type)                                                                           \
+    for (int i = 0; i + 1 < len; i += 2) { /* Unrolled by two */                                   \
+        SVF_TICK_Q(type, buf[i], buf[i]);                                                          \
+        SVF_TICK_Q(type, buf[i + 1], buf[i + 1]);                                                  \
+    }                                                                                              \
+    if (len & 1) {                                                                                 \
+        SVF_TICK_Q(type, buf[len - 1], buf[len - 1]);                                              \
+    }
+
+void dsp_svf_q15(Svf* f, int16_t* buf, int len) {
+    int32_t a1 = f->a1_q, a2 = f->a2_q, a3 = f->a3_q, k = f->k_q;
+    int32_t ic1 = f->ic1, ic2 = f->ic2;
+
+    switch (f->type) {
+    case FILTER_LOWPASS:
+        SVF_LOOP_Q(FILTER_LOWPASS);
+        break;
+    case FILTER_HIGHPASS:
+        SVF_LOOP_Q(FILTER_HIGHPASS);
+        break;
+    case FILTER_BANDPASS:
+        SVF_LOOP_Q(FILTER_BANDPASS);
+        break;
+    default:
+        return;
+    }
+
+    f->ic1 = ic1;
+    f->ic2 = ic2;
+}
+
+void dsp_svf_float(Svf* f, float* buf, int len) {
+    if (f->type == FILTER_OFF)
+        return;
+
+    float ic1 = f->ic1f, ic2 = f->ic2f;
+    for (int i = 0; i < len; i++) {
+        float v0 = buf[i];
+        float v3 = v0 - ic2;
+        float v1 = f->a1 * ic1 + f->a2 * v3;
+        float v2 = ic2 + f->a2 * ic1 + f->a3 * v3;
+        ic1 = 2.0f * v1 - ic1;
+        ic2 = 2.0f * v2 - ic2;
+
+        float o = (f->type == FILTER_LOWPASS)    ? v2
+                  : (f->type == FILTER_BANDPASS) ? v1
+                                                 : v0 - f->k * v1 - v2;
+        buf[i] = fminf(fmaxf(o, -1.0f), 1.0f);
+    }
+    f->ic1f = ic1;
+    f->ic2f = ic2;
+}
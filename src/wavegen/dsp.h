@@ -0,0 +1,76 @@
+#ifndef DSP_H
+#define DSP_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// --- Fixed-point helpers ---
+#define Q15_ONE 32768
+#define Q31_ONE 0x7FFFFFFF
+
+// Rounded Q31 multiply (truncation would bias long exponential decays downward)
+static inline int32_t q31_mul(int32_t a, int32_t b) {
+    return (int32_t) (((int64_t) a * b + (1 << 30)) >> 31);
+}
+
+// Saturate to [lo, hi] - compiles to SSAT/USAT style clamps on the M33
+static inline int32_t sat(int32_t x, int32_t lo, int32_t hi) {
+    return (x < lo) ? lo : (x > hi) ? hi : x;
+}
+
+// Block-processed DSP stages shared by the render kernels. Each stage runs over a
+// whole chunk with no per-sample branches; callers skip a stage per block when it's off.
+
+// Compressor transfer curve |in| -> |out|, sampled over |in| in [0, 2) (amp + DC can reach 2)
+#define COMP_LUT_BITS 8
+#define COMP_LUT_SIZE (1 << COMP_LUT_BITS)
+#define COMP_IN_SHIFT (16 - COMP_LUT_BITS) // Q15 magnitude (< 65536) -> table index
+
+typedef struct {
+    bool active;                        // false when comp_amount is 0 - stage is skipped
+    uint16_t curve[COMP_LUT_SIZE + 1];  // Q15 output magnitude, +1 guard entry
+} Compressor;
+
+// Same curve as scripts/waveform_test.py: threshold/ratio/makeup from the amount,
+// gentler settings for sine, plus a limiter above amount 0.8
+void compressor_init(Compressor* c, float amount, bool is_sine);
+
+// Noise blend: osc = (1 - mix) * osc + mix * noise
+void dsp_noise_mix_q15(int16_t* osc, const int16_t* noise, int len, int32_t mix_q15);
+void dsp_noise_mix_float(float* osc, const float* noise, int len, float mix);
+
+// Compress in place. Q15 input may range +-2.0 (+-65536); output is within +-1.0.
+void dsp_compress_q15(const Compressor* c, int32_t* buf, int len);
+void dsp_compress_float(const Compressor* c, float* buf, int len);
+
+// Bus soft clip for a sum of Q15 voices: linear up to SOFT_CLIP_KNEE, then a rational
+// curve with matching slope that approaches (never reaches) full scale. Output within +-1.0.
+#define SOFT_CLIP_KNEE 24576 // 0.75 in Q15
+void dsp_soft_clip_q15(int32_t* buf, int len);
+
+// Resonant state-variable filter, trapezoidal (TPT) form: stable at any cutoff below
+// Nyquist and under cutoff changes between chunks. Coefficients are set per chunk
+// (one tanf); the fixed kernel runs Q28 coefficients on Q23 state, which leaves 8 bits
+// of headroom for the resonant peak.
+typedef enum { FILTER_OFF, FILTER_LOWPASS, FILTER_HIGHPASS, FILTER_BANDPASS } FilterType;
+
+#define SVF_COEF_BITS 28
+#define SVF_STATE_SHIFT 8 // Q15 -> Q23
+
+typedef struct {
+    FilterType type;
+    float k, a1, a2, a3;          // Damping (2 - 2 * res) and the coefficients from cutoff
+    int32_t k_q, a1_q, a2_q, a3_q; // Same in Q28
+    int32_t ic1, ic2;             // Fixed kernel integrator state (Q23)
+    float ic1f, ic2f;             // Float kernel integrator state
+} Svf;
+
+void svf_init(Svf* f, FilterType type, float res); // res 0.0-1.0, clears the state
+void svf_set_cutoff(Svf* f, float cutoff);         // Fraction of the sample rate, < 0.5
+void svf_set_resonance(Svf* f, float res);         // Applies at the next svf_set_cutoff
+
+// Filter in place (output saturated to Q15)
+void dsp_svf_q15(Svf* f, int16_t* buf, int len);
+void dsp_svf_float(Svf* f, float* buf, int len);
+
+#endif
@@ -0,0 +1,98 @@
+#include "envelope.h"
+#include "dsp.h"
+#include <math.h>
+
+// Decays are advanced as y -= y * d with d = 1 - exp(x) in Q31. Built from expm1f so d
+// keeps its precision - a float expf() result near 1.0 only has ~24 bits, and that error
+// compounds over tens of thousands of samples. d = 0 (no decay) is exact.
+static inline int32_t decay_to_q31(float x) {
+    return (int32_t) lrintf(-expm1f(x) * 2147483648.0f);
+}
+
+void envelope_init(Envelope* e, int attack, int hold, float rate) {
+    e->attack = (attack > 0) ? attack : 0;
+    e->hold = (hold > 0) ? hold : 0;
+    e->rate = rate;
+    e->pos = 0;
+    e->step = expf(rate);
+    e->decay_q31 = decay_to_q31(rate);
+}
+
+// Exact decay value at the current position - the per-chunk re-anchor
+static inline float decay_anchor(const Envelope* e) {
+    if (e->rate == 0.0f)
+        return 1.0f;
+    return expf(e->rate * (float) (e->pos - e->attack - e->hold));
+}
+
+float envelope_level(const Envelope* e) {
+    if (e->pos < e->attack)
+        return (float) e->pos / e->attack;
+    if (e->pos < e->attack + e->hold)
+        return 1.0f;
+    return decay_anchor(e);
+}
+
+void envelope_render_float(Envelope* e, float* out, int len) {
+    int i = 0;
+
+    for (; i < len && e->pos < e->attack; i++, e->pos++) {
+        out[i] = (float) e->pos / e->attack;
+    }
+    for (; i < len && e->pos < e->attack + e->hold; i++, e->pos++) {
+        out[i] = 1.0f;
+    }
+    if (i == len)
+        return;
+
+    float value = decay_anchor(e);
+    float step = e->step;
+    e->pos += len - i;
+    for (; i < len; i++) {
+        out[i] = value;
+        value *= step;
+    }
+}
+
+void envelope_render_q31(Envelope* e, int32_t* out, int len) {
+    int i = 0;
+
+    for (; i < len && e->pos < e->attack; i++, e->pos++) {
+        out[i] = (int32_t) (((int64_t) e->pos << 31) / e->attack);
+    }
+    for (; i < len && e->pos < e->attack + e->hold; i++, e->pos++) {
+        out[i] = Q31_ONE;
+    }
+    if (i == len)
+        return;
+
+    int32_t value = (int32_t) lrintf(decay_anchor(e) * 2147483648.0f);
+    if (value < 0) // 1.0f rounds to 2^31
+        value = Q31_ONE;
+    int32_t d = e->decay_q31;
+    e->pos += len - i;
+    for (; i < len; i++) {
+        out[i] = value;
+        value -= q31_mul(value, d);
+    }
+}
+
+bool envelope_is_full(const Envelope* e, int len) {
+    return e->pos >= e->attack && (e->rate == 0.0f || e->pos + len <= e->attack + e->hold);
+}
+
+void envelope_skip(Envelope* e, int len) {
+    e->pos += len;
+}
+
+void envelope_set_rate(Envelope* e, float rate) {
+    int start = e->attack + e->hold;
+    if (e->pos > start && rate != 0.0f) {
+        // exp(rate * n') = exp(old_rate * n): same level, new distance into the decay
+        float n = (float) (e->pos - start) * (e->rate / rate);
+        e->pos = start + (int) lrintf(fminf(n, 1e9f));
+    }
+    e->rate = rate;
+    e->step = expf(rate);
+    e->decay_q31 = decay_to_q31(rate);
+}
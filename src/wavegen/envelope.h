@@ -0,0 +1,38 @@
+#ifndef ENVELOPE_H
+#define ENVELOPE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Incremental attack/hold/decay envelope generator, also used for the pitch glide
+// (attack = hold = 0). The decay advances by one multiply per sample and is re-anchored
+// to the exact exp() value at the start of every rendered chunk, so multiply drift can
+// never build up past one chunk (~1e-5 relative) and there is no transcendental math
+// in the per-sample loop.
+typedef struct {
+    int attack;        // Linear 0 -> 1 ramp, in samples
+    int hold;          // Samples held at 1
+    float rate;        // Decay exponent per sample: value = exp(rate * n) n samples into decay
+    int pos;           // Samples since trigger
+    float step;        // exp(rate) - float generator multiplier
+    int32_t decay_q31; // 1 - exp(rate) in Q31 - fixed-point generator decrement
+} Envelope;
+
+void envelope_init(Envelope* e, int attack, int hold, float rate);
+
+// Current value (one expf - for occasional queries such as voice stealing, not per sample)
+float envelope_level(const Envelope* e);
+
+// Render the next len values. Float output in [0, 1]; Q31 output in [0, Q31_ONE].
+void envelope_render_float(Envelope* e, float* out, int len);
+void envelope_render_q31(Envelope* e, int32_t* out, int len);
+// Change the decay rate mid-sound without a jump: the decay continues from the current
+// value (to within one sample's step) at the new rate
+void envelope_set_rate(Envelope* e, float rate);
+// True when the next len values are all exactly 1.0 (hold segment, or no decay), so a
+// kernel can apply unity gain instead of rendering the envelope
+bool envelope_is_full(const Envelope* e, int len);
+// Advance len samples without rendering (envelopes read once per chunk via envelope_level)
+void envelope_skip(Envelope* e, int len);
+
+#endif
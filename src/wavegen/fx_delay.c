@@ -0,0 +1,126 @@
+#include "fx_delay.h"
+#include "dsp.h"
+#include "pwm_audio.h"
+#include <math.h>
+
+_Static_assert((FX_RAM_BYTES & (FX_RAM_BYTES - 1)) == 0, "FX_RAM_BYTES must be a power of two");
+
+#if FX_SAMPLE_BITS == 8
+typedef int8_t fx_sample_t;
+#define FX_PACK(x) ((int8_t) (sat((x), -Q15_ONE, Q15_ONE - 1) >> 8))
+#define FX_UNPACK(s) ((int32_t) (s) * 256)
+#elif FX_SAMPLE_BITS == 16
+typedef int16_t fx_sample_t;
+#define FX_PACK(x) ((int16_t) sat((x), -Q15_ONE, Q15_ONE - 1))
+#define FX_UNPACK(s) ((int32_t) (s))
+#else
+#error "FX_SAMPLE_BITS must be 8 or 16"
+#endif
+
+#define LINE_LEN (FX_RAM_BYTES / (int) sizeof(fx_sample_t))
+#define LINE_MASK (LINE_LEN - 1)
+#define DIFF_MASK (FX_DIFFUSER_SIZE - 1)
+
+// Mutually prime all-pass lengths (~5.1 and 1.9 ms) so their ripples don't line up
+#define DIFF_LEN_A 113
+#define DIFF_LEN_B 41
+
+static fx_sample_t line[LINE_LEN];
+static int16_t diff_a[FX_DIFFUSER_SIZE];
+static int16_t diff_b[FX_DIFFUSER_SIZE];
+static uint32_t write_pos;
+
+// Set from main, read once per block by the IRQ
+static volatile int32_t delay_samples = 1;
+static volatile int32_t feedback_q15;
+static volatile int32_t send_q15;
+static volatile int32_t level_q15;
+static volatile int32_t diffusion_q15;
+static volatile int tail_samples;
+
+static inline int32_t q15(float x, float lo, float hi) {
+    return (int32_t) lrintf(fminf(fmaxf(x, lo), hi) * Q15_ONE);
+}
+
+static void clear(void) {
+    for (int i = 0; i < LINE_LEN; i++) {
+        line[i] = 0;
+    }
+    for (int i = 0; i < FX_DIFFUSER_SIZE; i++) {
+        diff_a[i] = 0;
+        diff_b[i] = 0;
+    }
+}
+
+void fx_delay_init(void) {
+    send_q15 = 0;
+    level_q15 = 0;
+    clear();
+    write_pos = 0;
+}
+
+float fx_delay_max_time(void) {
+    return (LINE_LEN - 1) / SAMPLE_RATE;
+}
+
+void fx_delay_set(const FxDelayParams* p) {
+    // While off, the IRQ skips the line and it keeps its last echoes. Clear it before
+    // turning on - send and level are written last, so the IRQ doesn't touch it meanwhile.
+    if (!fx_delay_active() && p->send > 0.0f && p->level > 0.0f)
+        clear();
+
+    int32_t delay = (int32_t) (p->time * SAMPLE_RATE);
+    delay_samples = (delay < 1) ? 1 : (delay > LINE_LEN - 1) ? LINE_LEN - 1 : delay;
+    feedback_q15 = q15(p->feedback, 0.0f, 0.95f);
+    diffusion_q15 = q15(p->diffusion, 0.0f, 0.7f);
+    send_q15 = q15(p->send, 0.0f, 1.0f);
+    level_q15 = q15(p->level, 0.0f, 1.0f);
+
+    // Repeats until the feedback has taken them down 48 dB, plus the diffuser smear
+    float fb = fminf(fmaxf(p->feedback, 0.0f), 0.95f);
+    int repeats = (fb > 0.004f) ? (int) ceilf(logf(1.0f / 256) / logf(fb)) : 1;
+    tail_samples = repeats * (delay_samples + DIFF_LEN_A + DIFF_LEN_B);
+}
+
+bool fx_delay_active(void) {
+    return send_q15 > 0 && level_q15 > 0;
+}
+
+int fx_delay_tail(void) {
+    return tail_samples;
+}
+
+// Schroeder all-pass: flat magnitude, smears each echo over the buffer length
+static inline int32_t allpass(int16_t* buf, uint32_t pos, int len, int32_t g, int32_t x) {
+    int32_t z = buf[(pos - len) & DIFF_MASK];
+    int32_t v = x - ((g * z) >> 15);
+    buf[pos & DIFF_MASK] = (int16_t) sat(v, -Q15_ONE, Q15_ONE - 1);
+    return z + ((g * v) >> 15);
+}
+
+void fx_delay_process(int32_t* bus, int len) {
+    uint32_t w = write_pos;
+    uint32_t delay = (uint32_t) delay_samples;
+    int32_t fb = feedback_q15, send = send_q15, level = level_q15, g = diffusion_q15;
+
+    if (g > 0) {
+        for (int i = 0; i < len; i++) {
+            int32_t d = FX_UNPACK(line[(w - delay) & LINE_MASK]);
+            d = allpass(diff_a, w, DIFF_LEN_A, g, d);
+            d = allpass(diff_b, w, DIFF_LEN_B, g, d);
+            int32_t in = sat(bus[i], -Q15_ONE, Q15_ONE); // The bus can exceed full scale
+            line[w & LINE_MASK] = FX_PACK(((in * send) >> 15) + ((d * fb) >> 15));
+            bus[i] += (d * level) >> 15;
+            w++;
+        }
+    } else {
+        for (int i = 0; i < len; i++) {
+            int32_t d = FX_UNPACK(line[(w - delay) & LINE_MASK]);
+            int32_t in = sat(bus[i], -Q15_ONE, Q15_ONE); // The bus can exceed full scale
+            line[w & LINE_MASK] = FX_PACK(((in * send) >> 15) + ((d * fb) >> 15));
+            bus[i] += (d * level) >> 15;
+            w++;
+        }
+    }
+    write_pos = w;
+}
@@ -0,0 +1,44 @@
+#ifndef FX_DELAY_H
+#define FX_DELAY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Send effect on the mix bus: a feedback delay whose repeats can be smeared by two
+// all-pass diffusers in the loop, from slapback echo to a small room. The delay line is
+// a power-of-two circular buffer (index wrap is one AND), so its cost per sample is
+// fixed: the inner loops have no branches, and the diffused/plain choice is made once
+// per block.
+
+#ifndef FX_RAM_BYTES // Delay line budget, a power of two: 32KB = 0.74 s at 16 bits
+#define FX_RAM_BYTES (32 * 1024)
+#endif
+
+#ifndef FX_SAMPLE_BITS // 16, or 8 to double the delay time in the same RAM
+#define FX_SAMPLE_BITS 16
+#endif
+
+#define FX_DIFFUSER_SIZE 128 // Samples per all-pass buffer (power of two)
+
+typedef struct {
+    float time;      // Echo time (s), clamped to fx_delay_max_time()
+    float feedback;  // 0.0-0.95
+    float send;      // Mix bus level into the delay, 0.0-1.0
+    float level;     // Delay return level in the mix, 0.0-1.0
+    float diffusion; // All-pass coefficient 0.0-0.7; 0 = plain echoes
+} FxDelayParams;
+
+void fx_delay_init(void); // Clears the line; the effect starts off
+// Takes effect at the next block. send = 0 or level = 0 turns the effect off; turning it
+// back on starts from an empty line, with no echoes left over from before.
+void fx_delay_set(const FxDelayParams* p);
+float fx_delay_max_time(void);
+
+bool fx_delay_active(void);
+// Samples the repeats take to fall 48 dB once the input goes quiet
+int fx_delay_tail(void);
+
+// Feeds bus into the delay and adds the return to it (Q15, IRQ context)
+void fx_delay_process(int32_t* bus, int len);
+
+#endif
@@ -0,0 +1,60 @@
+#include "kernel_bench.h"
+#include "hardware/clocks.h"
+#include "pico/stdlib.h"
+#include "waveform_gen.h"
+#include <stdio.h>
+
+static int32_t bench_out[2][KERNEL_BENCH_SAMPLES];
+
+static const char* const wave_names[] = {"sine", "square", "tri", "saw", "noise", "silent"};
+
+// Best-of render time of one variant, in cycles per sample; the last run is left in out
+static float bench_variant(const WaveParams* p, WaveKernel kernel, int32_t* out) {
+    uint32_t sys_hz = clock_get_hz(clk_sys);
+    uint32_t best = UINT32_MAX;
+
+    waveform_set_kernel(kernel);
+    for (int run = 0; run < KERNEL_BENCH_RUNS; run++) {
+        WaveVoice v;
+        waveform_voice_start(&v, p);
+
+        uint32_t start = time_us_32();
+        waveform_voice_render_q15(&v, out, KERNEL_BENCH_SAMPLES);
+        uint32_t us = time_us_32() - start;
+        if (us < best)
+            best = us;
+    }
+    return (float) best * (sys_hz / 1000000) / KERNEL_BENCH_SAMPLES;
+}
+
+void kernel_bench_run(void) {
+    // Bare oscillator into the envelope: no filter, noise mix or compressor, so the table
+    // shows the stages the variants differ in
+    WaveParams p = {.frequency = 220.0f, .amplitude = 1.0f, .decay = 1.0f, .env_curve = 5.0f};
+
+    printf("Kernel bench: cycles/sample over %d samples\n", KERNEL_BENCH_SAMPLES);
+    printf("wave    glide  env     generic  special  speedup\n");
+
+    for (int wave = 0; wave < 6; wave++) {
+        for (int glide = 0; glide < 2; glide++) {
+            for (int env = 0; env < 2; env++) {
+                p.waveform_id = wave;
+                p.pitch_decay = glide ? 3.0f : 0.0f;
+                p.env_hold = env ? 0.0f : 1.0f; // Unity: the whole render sits in the hold
+
+                float generic = bench_variant(&p, WAVE_KERNEL_FIXED_GENERIC, bench_out[0]);
+                float special = bench_variant(&p, WAVE_KERNEL_FIXED, bench_out[1]);
+
+                bool match = true;
+                for (int i = 0; i < KERNEL_BENCH_SAMPLES; i++) {
+                    match &= (bench_out[0][i] == bench_out[1][i]);
+                }
+                printf("%-7s %-6s %-7s %7.1f  %7.1f  %6.2fx%s\n", wave_names[wave],
+                       glide ? "on" : "off", env ? "curve" : "unity", generic, special,
+                       generic / special, match ? "" : "  MISMATCH");
+            }
+        }
+    }
+
+    waveform_set_kernel(WAVEGEN_KERNEL_DEFAULT);
+}
@@ -0,0 +1,14 @@
+#ifndef KERNEL_BENCH_H
+#define KERNEL_BENCH_H
+
+// On-target benchmark of the fixed-point render kernels: cycles per sample for every
+// oscillator x glide x envelope variant, generic (WAVE_KERNEL_FIXED_GENERIC) against
+// specialized (WAVE_KERNEL_FIXED). Prints a table over stdio and checks the two agree
+// sample for sample. Run it before the audio side starts, so no IRQ lands in a timing.
+
+#define KERNEL_BENCH_SAMPLES 4096 // Per timed render (~0.19 s of sound)
+#define KERNEL_BENCH_RUNS 5       // Best of
+
+void kernel_bench_run(void);
+
+#endif
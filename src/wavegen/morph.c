@@ -0,0 +1,147 @@
+#include "morph.h"
+#include "dsp.h"
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+
+#define LOG_FLOOR 0.001f // Log fields clamp here (decay 0, cutoff 0 while the filter is off)
+
+_Static_assert(sizeof(WaveParams) == MORPH_FIELDS * 4, "morph_fields must cover WaveParams");
+
+typedef enum { MORPH_LINEAR, MORPH_LOG, MORPH_SWITCH } MorphScale;
+
+#define MORPH_FIELD(field, scale) {offsetof(WaveParams, field), scale}
+
+static const struct {
+    size_t offset;
+    MorphScale scale;
+} morph_fields[MORPH_FIELDS] = {
+    MORPH_FIELD(frequency, MORPH_LOG),        MORPH_FIELD(amplitude, MORPH_LINEAR),
+    MORPH_FIELD(decay, MORPH_LOG),            MORPH_FIELD(waveform_id, MORPH_SWITCH),
+    MORPH_FIELD(offset_dc, MORPH_LINEAR),     MORPH_FIELD(pitch_decay, MORPH_LINEAR),
+    MORPH_FIELD(noise_mix, MORPH_LINEAR),     MORPH_FIELD(env_curve, MORPH_LINEAR),
+    MORPH_FIELD(comp_amount, MORPH_LINEAR),   MORPH_FIELD(env_attack, MORPH_LINEAR),
+    MORPH_FIELD(env_hold, MORPH_LINEAR),      MORPH_FIELD(filter_type, MORPH_SWITCH),
+    MORPH_FIELD(filter_cutoff, MORPH_LOG),    MORPH_FIELD(filter_res, MORPH_LINEAR),
+    MORPH_FIELD(filter_env, MORPH_LINEAR),    MORPH_FIELD(filter_decay, MORPH_LINEAR),
+};
+
+static float field_coord(const WaveParams* p, int k) {
+    const char* src = (const char*) p + morph_fields[k].offset;
+    float v;
+    if (morph_fields[k].scale == MORPH_SWITCH) {
+        int i;
+        memcpy(&i, src, sizeof(i));
+        return (float) i;
+    }
+    memcpy(&v, src, sizeof(v));
+    return (morph_fields[k].scale == MORPH_LOG) ? log2f(fmaxf(v, LOG_FLOOR)) : v;
+}
+
+// An unfiltered end takes the other end's filter settings (it ignores them), so the
+// cutoff doesn't sweep up from 0 Hz once the filter switches in
+static void fill_filter(WaveParams* off, const WaveParams* on) {
+    if (off->filter_type == FILTER_OFF && on->filter_type != FILTER_OFF) {
+        off->filter_cutoff = on->filter_cutoff;
+        off->filter_res = on->filter_res;
+        off->filter_env = on->filter_env;
+        off->filter_decay = on->filter_decay;
+    }
+}
+
+bool morph_init(MorphPath* m, const WaveParams* points, int count) {
+    if (count < 2 || count > MORPH_MAX_POINTS)
+        return false;
+
+    m->count = count - 1;
+    for (int s = 0; s < m->count; s++) {
+        MorphSegment* seg = &m->segments[s];
+        seg->from = points[s];
+        seg->to = points[s + 1];
+        fill_filter(&seg->from, &seg->to);
+        fill_filter(&seg->to, &seg->from);
+
+        seg->varying = 0;
+        for (int k = 0; k < MORPH_FIELDS; k++) {
+            const char* a = (const char*) &seg->from + morph_fields[k].offset;
+            const char* b = (const char*) &seg->to + morph_fields[k].offset;
+            seg->from_c[k] = field_coord(&seg->from, k);
+            seg->to_c[k] = field_coord(&seg->to, k);
+            if (memcmp(a, b, 4) != 0) // Every field is 4 bytes (see the assert)
+                seg->varying |= 1u << k;
+        }
+    }
+    m->position = -1;
+    m->engaged = true;
+    return true;
+}
+
+// Params at fraction f (0..1) of segment s; the ends are exact copies
+static void morph_segment(const MorphPath* m, int s, float f, WaveParams* out) {
+    const MorphSegment* seg = &m->segments[s];
+    if (f <= 0.0f) {
+        *out = seg->from;
+        return;
+    }
+    if (f >= 1.0f) {
+        *out = seg->to;
+        return;
+    }
+
+    *out = seg->from; // Fields outside the varying mask stay bit-exact
+    for (uint32_t bits = seg->varying; bits; bits &= bits - 1) {
+        int k = __builtin_ctz(bits);
+        char* dst = (char*) out + morph_fields[k].offset;
+        float c = seg->from_c[k] + (seg->to_c[k] - seg->from_c[k]) * f;
+        if (morph_fields[k].scale == MORPH_SWITCH) {
+            int i = (int) ((f < 0.5f) ? seg->from_c[k] : seg->to_c[k]);
+            memcpy(dst, &i, sizeof(i));
+        } else {
+            float v = (morph_fields[k].scale == MORPH_LOG) ? exp2f(c) : c;
+            memcpy(dst, &v, sizeof(v));
+        }
+    }
+}
+
+void morph_at(const MorphPath* m, float t, WaveParams* out) {
+    float x = fminf(fmaxf(t, 0.0f), 1.0f) * m->count;
+    int s = (int) x;
+    if (s >= m->count)
+        s = m->count - 1;
+    morph_segment(m, s, x - s, out);
+}
+
+// Positions map onto segments in integers, so keyframes that fall on a position are hit
+// exactly (all of them on paths of 3, 5 or 15 segments - the 6 drum presets make 5)
+static void morph_position(const MorphPath* m, int position, WaveParams* out) {
+    int span = MORPH_POSITIONS - 1;
+    int num = position * m->count;
+    int s = num / span;
+    if (s >= m->count) {
+        morph_segment(m, m->count - 1, 1.0f, out);
+        return;
+    }
+    morph_segment(m, s, (float) (num % span) / span, out);
+}
+
+bool morph_update(MorphPath* m, float control, WaveParams* out) {
+    if (!m->engaged) {
+        if (fabsf(control - m->anchor) < MORPH_ENGAGE)
+            return false;
+        m->engaged = true;
+    }
+
+    float pos = fminf(fmaxf(control, 0.0f), 1.0f) * (MORPH_POSITIONS - 1);
+    if (m->position >= 0 && fabsf(pos - (float) m->position) < MORPH_HYSTERESIS)
+        return false;
+
+    m->position = (int) lroundf(pos);
+    morph_position(m, m->position, out);
+    return true;
+}
+
+void morph_rearm(MorphPath* m, float control) {
+    m->anchor = control;
+    m->engaged = false;
+    m->position = -1;
+}
@@ -0,0 +1,54 @@
+#ifndef MORPH_H
+#define MORPH_H
+
+#include "waveform_gen.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Preset morphing: one control position (0..1) moves along a path through two or more
+// WaveParams, one segment per neighbouring pair. Interpolation is in perceptual space:
+// frequency, decay and filter cutoff move on a log scale, so equal pot travel is an equal
+// musical interval (or time ratio) anywhere on the path. The rest of the continuous params
+// are linear; waveform_id and filter_type switch at the middle of a segment.
+//
+// Each segment is worked out once, up front (morph_init), into log-space endpoints plus a
+// mask of the fields that actually change along it. Fields outside the mask are copied
+// bit for bit, so a sweep that only moves, say, decay and amplitude leaves the oscillator
+// params untouched and waveform_stages_update() keeps the cached oscillator (and filter)
+// output - the preview then re-runs only the envelope and post stages.
+
+#define MORPH_MAX_POINTS 8
+#define MORPH_POSITIONS 256   // Control resolution over the whole path
+#define MORPH_HYSTERESIS 0.6f // Positions the control must move to step (ADC noise)
+#define MORPH_ENGAGE 0.02f    // Control travel that takes over from the current sound
+
+#define MORPH_FIELDS 16 // WaveParams fields, all of them
+
+typedef struct {
+    WaveParams from, to;        // Endpoints, with the filter of an unfiltered end filled in
+    float from_c[MORPH_FIELDS]; // Field values in interpolation space (log2 where log)
+    float to_c[MORPH_FIELDS];
+    uint32_t varying; // Bit per field that differs between the endpoints
+} MorphSegment;
+
+typedef struct {
+    MorphSegment segments[MORPH_MAX_POINTS - 1];
+    int count;    // Segments
+    int position; // Current position (0..MORPH_POSITIONS - 1), -1 before the first
+    float anchor; // Control value when (re)armed
+    bool engaged;
+} MorphPath;
+
+// Path through count (2..MORPH_MAX_POINTS) params, in order; false if count is out of range
+bool morph_init(MorphPath* m, const WaveParams* points, int count);
+
+// Params at t (0..1) along the path
+void morph_at(const MorphPath* m, float t, WaveParams* out);
+
+// Control input (0..1, e.g. a pot): true (and out set) when it moved to a new position.
+// After morph_rearm() the control must first travel MORPH_ENGAGE, so entering morph mode
+// doesn't replace the current sound until the pot is turned.
+bool morph_update(MorphPath* m, float control, WaveParams* out);
+void morph_rearm(MorphPath* m, float control);
+
+#endif
@@ -0,0 +1,30 @@
+#include "noise.h"
+
+void noise_seed(NoiseGen* g, uint32_t seed) {
+    // Scramble so nearby seeds (voice 0, 1, 2...) start far apart in the sequence
+    seed = (seed ^ NOISE_DEFAULT_SEED) * 0x9E3779B1u;
+    seed ^= seed >> 16;
+    g->state = seed ? seed : NOISE_DEFAULT_SEED;
+}
+
+void noise_fill_q15(NoiseGen* g, int16_t* out, int len) {
+    uint32_t x = g->state;
+    for (int i = 0; i < len; i++) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        out[i] = (int16_t) (x >> 16);
+    }
+    g->state = x;
+}
+
+void noise_fill_float(NoiseGen* g, float* out, int len) {
+    uint32_t x = g->state;
+    for (int i = 0; i < len; i++) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        out[i] = (int32_t) x * (1.0f / 2147483648.0f);
+    }
+    g->state = x;
+}
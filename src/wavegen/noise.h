@@ -0,0 +1,34 @@
+#ifndef NOISE_H
+#define NOISE_H
+
+#include <stdint.h>
+
+// Small-state xorshift32 noise generator. Each voice owns one, so it is reentrant
+// across ISRs/cores, and a fixed seed makes every render bit-exact.
+
+#define NOISE_DEFAULT_SEED 0x2545F491u
+
+typedef struct {
+    uint32_t state; // Never 0
+} NoiseGen;
+
+void noise_seed(NoiseGen* g, uint32_t seed);
+void noise_fill_q15(NoiseGen* g, int16_t* out, int len); // Uniform [-1, 1) in Q15
+void noise_fill_float(NoiseGen* g, float* out, int len); // Uniform [-1, 1)
+
+// Next raw 32-bit value (period 2^32 - 1)
+static inline uint32_t noise_next(NoiseGen* g) {
+    uint32_t x = g->state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    g->state = x;
+    return x;
+}
+
+// Single sample in [-1, 1)
+static inline float noise_next_float(NoiseGen* g) {
+    return (int32_t) noise_next(g) * (1.0f / 2147483648.0f);
+}
+
+#endif
@@ -0,0 +1,402 @@
+#include "preset_store.h"
+#include "dsp.h"
+#include "hardware/flash.h"
+#include "pico/flash.h"
+#include "pico/stdlib.h"
+#include "sample_bank.h"
+#include <stddef.h>
+#include <string.h>
+
+// Region offsets are from the start of the store; half h spans [h * HALF, (h + 1) * HALF)
+// and its first page is the half header. Offset 0 is never a record, so it marks an empty
+// slot in the index.
+#define STORE_OFFSET PRESET_STORE_OFFSET
+#define HALF (PRESET_STORE_BYTES / 2)
+#define PAGE FLASH_PAGE_SIZE
+#define SECTOR FLASH_SECTOR_SIZE
+#define PAGE_SAMPLES (PAGE / sizeof(int16_t))
+#define FLASH_TIMEOUT_MS 100 // For core 1 to park
+
+// Headers go through the cached window; samples (and bulk scans) through the no-allocate
+// alias, as the sample bank does, so they don't evict the code the audio IRQ runs from
+#define STORE_CACHED ((const uint8_t*) (XIP_BASE + STORE_OFFSET))
+#define STORE_STREAM ((const uint8_t*) (XIP_NOCACHE_NOALLOC_BASE + STORE_OFFSET))
+
+_Static_assert(PRESET_STORE_BYTES % (2 * SECTOR) == 0, "store must be whole sectors per half");
+_Static_assert(sizeof(PresetRecord) <= PAGE, "record header must fit a page");
+_Static_assert(SAMPLE_BANK_FLASH_OFFSET < STORE_OFFSET, "sample bank starts inside the store");
+
+typedef struct {
+    uint32_t magic;
+    uint32_t generation;
+    uint32_t crc; // Of the two fields above
+} HalfHeader;
+
+static uint32_t slot_offset[PRESET_STORE_SLOTS]; // Newest record per slot; 0 = empty
+static int active;                               // Half the log is appending to
+static uint32_t generation;                      // Of the active half
+static uint32_t head;                            // Next append; pages from here are erased
+static uint32_t next_seq;
+static bool unsealed; // Active half compacted, its header not yet written (see compact())
+
+static uint8_t page_buf[PAGE]; // Flash is only ever programmed from RAM
+
+// ==================================================
+// CRC-32 (IEEE, reflected), a nibble at a time
+// ==================================================
+static uint32_t crc32_update(uint32_t crc, const uint8_t* data, size_t len) {
+    static const uint32_t table[16] = {
+        0x00000000u, 0x1DB71064u, 0x3B6E20C8u, 0x26D930ACu, 0x76DC4190u, 0x6B6B51F4u,
+        0x4DB26158u, 0x5005713Cu, 0xEDB88320u, 0xF00F9344u, 0xD6D6A3E8u, 0xCB61B38Cu,
+        0x9B64C2B0u, 0x86D3D2D4u, 0xA00AE278u, 0xBDBDF21Cu,
+    };
+    crc = ~crc;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        crc = (crc >> 4) ^ table[crc & 15];
+        crc = (crc >> 4) ^ table[crc & 15];
+    }
+    return ~crc;
+}
+
+// ==================================================
+// FLASH ACCESS
+// ==================================================
+typedef struct {
+    uint32_t offset;     // Region offset
+    const uint8_t* data; // One page to program, or NULL to erase the sector
+} FlashOp;
+
+// Runs with core 1 parked and interrupts off; nothing here may touch XIP
+static void flash_op(void* arg) {
+    const FlashOp* op = arg;
+    if (op->data) {
+        flash_range_program(STORE_OFFSET + op->offset, op->data, PAGE);
+    } else {
+        flash_range_erase(STORE_OFFSET + op->offset, SECTOR);
+    }
+}
+
+static bool program_page(uint32_t offset, const uint8_t* data) {
+    FlashOp op = {offset, data};
+    return flash_safe_execute(flash_op, &op, FLASH_TIMEOUT_MS) == PICO_OK;
+}
+
+static bool erased(uint32_t offset, uint32_t len) {
+    const uint32_t* w = (const uint32_t*) (STORE_STREAM + offset);
+    for (uint32_t i = 0; i < len / 4; i++) {
+        if (w[i] != 0xFFFFFFFFu)
+            return false;
+    }
+    return true;
+}
+
+// Erase on entry: a sector is erased when the log first reaches it (and not at all if it
+// still reads erased, e.g. after a compaction that never got this far). Done for a whole
+// record before any of it is programmed, so a record starting a sector can't erase its
+// own samples.
+static bool erase_range(uint32_t offset, uint32_t len) {
+    for (uint32_t s = (offset + SECTOR - 1) / SECTOR * SECTOR; s < offset + len; s += SECTOR) {
+        if (erased(s, SECTOR))
+            continue;
+        FlashOp op = {s, NULL};
+        if (flash_safe_execute(flash_op, &op, FLASH_TIMEOUT_MS) != PICO_OK)
+            return false;
+    }
+    return true;
+}
+
+// ==================================================
+// RECORDS
+// ==================================================
+static uint32_t record_span(uint32_t length) {
+    return PAGE + (length * sizeof(int16_t) + PAGE - 1) / PAGE * PAGE;
+}
+
+static uint32_t half_end(uint32_t offset) {
+    return (offset / HALF + 1) * HALF;
+}
+
+static uint32_t active_end(void) {
+    return (uint32_t) (active + 1) * HALF;
+}
+
+static uint32_t header_crc(const PresetRecord* r) {
+    return crc32_update(0, (const uint8_t*) r, offsetof(PresetRecord, crc));
+}
+
+// The record at offset if it is whole and of generation gen or later, else NULL
+static const PresetRecord* record_since(uint32_t offset, uint32_t gen) {
+    const PresetRecord* r = (const PresetRecord*) (STORE_CACHED + offset);
+    if (r->magic != PRESET_RECORD_MAGIC || r->generation < gen ||
+        r->slot >= PRESET_STORE_SLOTS || r->length > HALF / sizeof(int16_t) ||
+        record_span(r->length) > half_end(offset) - offset) {
+        return NULL;
+    }
+    uint32_t crc = crc32_update(header_crc(r), STORE_STREAM + offset + PAGE,
+                                r->length * sizeof(int16_t));
+    return (crc == r->crc) ? r : NULL;
+}
+
+// The record at offset if it is whole and of the active generation, else NULL
+static const PresetRecord* record_at(uint32_t offset) {
+    const PresetRecord* r = record_since(offset, generation);
+    return (r && r->generation == generation) ? r : NULL;
+}
+
+// Programs the header page of a record whose samples are already in place; this is the
+// write that makes it valid
+static bool program_header(uint32_t offset, const PresetRecord* r) {
+    memset(page_buf, 0xFF, PAGE);
+    memcpy(page_buf, r, sizeof(*r));
+    return program_page(offset, page_buf);
+}
+
+// ==================================================
+// MOUNT
+// ==================================================
+static const HalfHeader* half_header(int half) {
+    const HalfHeader* h = (const HalfHeader*) (STORE_CACHED + half * HALF);
+    if (h->magic != PRESET_HALF_MAGIC ||
+        h->crc != crc32_update(0, (const uint8_t*) h, offsetof(HalfHeader, crc))) {
+        return NULL;
+    }
+    return h;
+}
+
+static bool write_half_header(int half, uint32_t gen) {
+    HalfHeader h = {PRESET_HALF_MAGIC, gen, 0};
+    h.crc = crc32_update(0, (const uint8_t*) &h, offsetof(HalfHeader, crc));
+    memset(page_buf, 0xFF, PAGE);
+    memcpy(page_buf, &h, sizeof(h));
+    return program_page(half * HALF, page_buf);
+}
+
+bool preset_store_init(void) {
+    memset(slot_offset, 0, sizeof(slot_offset));
+    next_seq = 0;
+    unsealed = false;
+
+    const HalfHeader* h[2] = {half_header(0), half_header(1)};
+    if (!h[0] && !h[1]) {
+        // First boot: half 0 gets generation 1; the rest is erased as the log reaches it
+        active = 0;
+        generation = 1;
+        head = PAGE;
+        return erase_range(0, SECTOR) && write_half_header(0, generation);
+    }
+    active = (!h[0] || (h[1] && h[1]->generation > h[0]->generation)) ? 1 : 0;
+    generation = h[active]->generation;
+
+    // Records are appended in order, so the later of two records for a slot is the newer.
+    // Anything that doesn't check out (a write cut short, stale data) is stepped over a
+    // page at a time.
+    uint32_t start = active * HALF;
+    uint32_t end = start + HALF;
+    head = start + PAGE;
+    for (uint32_t offset = head; offset < end;) {
+        const PresetRecord* r = record_at(offset);
+        if (!r) {
+            offset += PAGE;
+            continue;
+        }
+        slot_offset[r->slot] = (r->flags & PRESET_FLAG_DELETED) ? 0 : offset;
+        if (r->seq >= next_seq)
+            next_seq = r->seq + 1;
+        offset += record_span(r->length);
+        head = offset;
+    }
+
+    // A cut-short write may have left programmed pages past the last record; the log
+    // resumes at the next sector so the erase on entry clears them
+    uint32_t sector_end = (head + SECTOR - 1) / SECTOR * SECTOR;
+    if (!erased(head, sector_end - head))
+        head = sector_end;
+    return true;
+}
+
+// ==================================================
+// APPEND / COMPACTION
+// ==================================================
+// A generation no record in the target half has yet. A compaction that didn't finish
+// leaves whole records of the generation it was writing there, and a retry under the same
+// one would pass them for its own wherever it doesn't write over them (it copies a
+// different live set, or lays it out differently).
+static uint32_t next_generation(int target) {
+    uint32_t gen = generation + 1;
+    for (uint32_t offset = target * HALF + PAGE; offset < (target + 1) * HALF;) {
+        const PresetRecord* r = record_since(offset, gen);
+        if (!r) {
+            offset += PAGE;
+            continue;
+        }
+        gen = r->generation + 1;
+        offset += record_span(r->length);
+    }
+    return gen;
+}
+
+// Copies the live records (except skip_slot, about to be replaced) into the other half
+// under a new generation and makes it active. Its header is left for append() to write
+// after skip_slot's new record: until then a reboot still mounts the old half, where
+// skip_slot has its old record.
+static bool compact(int skip_slot) {
+    int target = !active;
+    uint32_t gen = next_generation(target);
+    uint32_t out = target * HALF + PAGE;
+    uint32_t moved[PRESET_STORE_SLOTS] = {0};
+
+    if (!erase_range(target * HALF, SECTOR))
+        return false;
+    for (int slot = 0; slot < PRESET_STORE_SLOTS; slot++) {
+        if (!slot_offset[slot] || slot == skip_slot)
+            continue;
+        PresetRecord r = *(const PresetRecord*) (STORE_CACHED + slot_offset[slot]);
+        r.generation = gen;
+        r.crc = header_crc(&r);
+
+        uint32_t bytes = r.length * sizeof(int16_t);
+        if (!erase_range(out, record_span(r.length)))
+            return false;
+        const uint8_t* src = STORE_STREAM + slot_offset[slot] + PAGE;
+        for (uint32_t done = 0; done < bytes; done += PAGE) {
+            uint32_t n = (bytes - done < PAGE) ? bytes - done : PAGE;
+            memset(page_buf, 0xFF, PAGE);
+            memcpy(page_buf, src + done, n);
+            r.crc = crc32_update(r.crc, page_buf, n);
+            if (!program_page(out + PAGE + done, page_buf))
+                return false;
+        }
+        if (!program_header(out, &r))
+            return false;
+        moved[slot] = out;
+        out += record_span(r.length);
+    }
+
+    unsealed = true;
+    active = target;
+    generation = gen;
+    head = out;
+    memcpy(slot_offset, moved, sizeof(slot_offset));
+    return true;
+}
+
+// Makes room for span bytes at head, compacting if the active half is out of it. Fails
+// before touching flash if the live records would still leave too little, so a save that
+// can't fit doesn't cost the slot its old record.
+static bool reserve(uint32_t span, int slot) {
+    if (head + span <= active_end())
+        return true;
+
+    uint32_t live = PAGE + span;
+    for (int s = 0; s < PRESET_STORE_SLOTS; s++) {
+        if (slot_offset[s] && s != slot)
+            live += record_span(((const PresetRecord*) (STORE_CACHED + slot_offset[s]))->length);
+    }
+    return live <= HALF && compact(slot);
+}
+
+// Renders p a page at a time and programs it after offset's header page; returns the
+// CRC of the samples chained onto crc
+static bool program_render(uint32_t offset, const WaveParams* p, uint32_t length,
+                           uint32_t* crc) {
+    static int32_t block[PAGE_SAMPLES];
+    WaveVoice v;
+    waveform_voice_start(&v, p);
+
+    int16_t* samples = (int16_t*) page_buf;
+    for (uint32_t done = 0; done < length; done += PAGE_SAMPLES) {
+        uint32_t n = (length - done < PAGE_SAMPLES) ? length - done : PAGE_SAMPLES;
+        waveform_voice_render_q15(&v, block, (int) PAGE_SAMPLES);
+        memset(page_buf, 0xFF, PAGE);
+        for (uint32_t i = 0; i < n; i++) {
+            samples[i] = (int16_t) sat(block[i], -32768, 32767);
+        }
+        *crc = crc32_update(*crc, page_buf, n * sizeof(int16_t));
+        if (!program_page(offset + PAGE + done * sizeof(int16_t), page_buf))
+            return false;
+    }
+    return true;
+}
+
+static bool append(int slot, const char* name, const WaveParams* p, uint16_t flags,
+                   bool render) {
+    uint32_t length = 0;
+    if (render) {
+        WaveVoice v;
+        waveform_voice_start(&v, p);
+        length = (uint32_t) v.total_samples;
+    }
+    if (!reserve(record_span(length), slot))
+        return false;
+
+    PresetRecord r = {.magic = PRESET_RECORD_MAGIC,
+                      .generation = generation,
+                      .seq = next_seq,
+                      .slot = (uint16_t) slot,
+                      .flags = flags,
+                      .length = length};
+    if (name)
+        strncpy(r.name, name, PRESET_NAME_LEN - 1);
+    if (p)
+        r.params = *p;
+    r.crc = header_crc(&r);
+
+    // On failure the log moves on to the next sector, past whatever was half programmed -
+    // or, mid-compaction, back to the old half, the one flash still mounts
+    uint32_t offset = head;
+    if (!erase_range(offset, record_span(length)) ||
+        (length && !program_render(offset, p, length, &r.crc)) || !program_header(offset, &r) ||
+        (unsealed && !write_half_header(active, generation))) {
+        if (unsealed)
+            preset_store_init();
+        else
+            head = (offset / SECTOR + 1) * SECTOR;
+        return false;
+    }
+    unsealed = false;
+
+    slot_offset[slot] = (flags & PRESET_FLAG_DELETED) ? 0 : offset;
+    head = offset + record_span(length);
+    next_seq++;
+    return true;
+}
+
+// ==================================================
+// API
+// ==================================================
+bool preset_store_save(int slot, const char* name, const WaveParams* p, bool render) {
+    if (slot < 0 || slot >= PRESET_STORE_SLOTS)
+        return false;
+    return append(slot, name, p, 0, render);
+}
+
+bool preset_store_delete(int slot) {
+    if (slot < 0 || slot >= PRESET_STORE_SLOTS)
+        return false;
+    if (!slot_offset[slot])
+        return true;
+    return append(slot, NULL, NULL, PRESET_FLAG_DELETED, false);
+}
+
+const PresetRecord* preset_store_get(int slot) {
+    if (slot < 0 || slot >= PRESET_STORE_SLOTS || !slot_offset[slot])
+        return NULL;
+    return (const PresetRecord*) (STORE_CACHED + slot_offset[slot]);
+}
+
+const int16_t* preset_store_samples(const PresetRecord* r) {
+    if (!r || !r->length)
+        return NULL;
+    return (const int16_t*) (STORE_STREAM + ((const uint8_t*) r - STORE_CACHED) + PAGE);
+}
+
+void preset_store_get_stats(PresetStoreStats* stats) {
+    stats->records = 0;
+    for (int slot = 0; slot < PRESET_STORE_SLOTS; slot++) {
+        stats->records += slot_offset[slot] != 0;
+    }
+    stats->bytes_used = (int) (head - active * HALF);
+    stats->bytes_free = (int) (active_end() - head);
+    stats->generation = generation;
+}
@@ -0,0 +1,79 @@
+#ifndef PRESET_STORE_H
+#define PRESET_STORE_H
+
+#include "waveform_gen.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// User presets in a reserved region at the top of flash (PICO_FLASH_SIZE_BYTES -
+// PRESET_STORE_BYTES, clear of the firmware and the sample bank), optionally with the
+// sound's render stored next to the params so recalling it needs no synthesis.
+//
+// The region is two halves used alternately as an append-only log. Saving a slot appends
+// a new record and the newest record of a slot wins; nothing is rewritten in place. When
+// the active half is full, the live records are copied into the other half, which then
+// becomes active. Sectors are erased only as the log reaches them, so every sector sees
+// one erase per pass over its half - writes wear the whole region evenly.
+//
+// Each record starts on a page with a header page (PresetRecord, CRC-32 over it and the
+// samples), followed by the samples (Q15, 16-bit). The header is programmed last, so a
+// record cut short by power loss is never valid. Records are read in place through XIP -
+// the store keeps only a slot -> offset index in RAM.
+//
+// Flash writes run from core 0 through flash_safe_execute(), which parks core 1 (see
+// audio_core.c) for each page program or sector erase. Audio stalls while it is parked:
+// about a millisecond per page, tens of milliseconds per erase.
+//
+// Not thread safe: save, delete and init from core 0 only. Records stay readable (e.g. by
+// a voice still playing a stored sample) until their half is reused, one compaction later.
+
+#ifndef PRESET_STORE_BYTES
+#define PRESET_STORE_BYTES (512 * 1024) // Both halves; a multiple of 2 sectors
+#endif
+#define PRESET_STORE_OFFSET (PICO_FLASH_SIZE_BYTES - PRESET_STORE_BYTES) // Sample bank ends below
+
+#define PRESET_STORE_SLOTS 64
+#define PRESET_NAME_LEN 16
+#define PRESET_RECORD_MAGIC 0x54455250u // "PRET"
+#define PRESET_HALF_MAGIC 0x464C4148u   // "HALF"
+
+#define PRESET_FLAG_DELETED (1u << 0) // Tombstone: the slot is empty from this record on
+
+typedef struct {
+    uint32_t magic;
+    uint32_t generation; // Pass over the half it was written in (older passes are stale)
+    uint32_t seq;        // Write order: the newest record of a slot wins
+    uint16_t slot;
+    uint16_t flags;
+    uint32_t length;            // Samples in the pages after the header (0: params only)
+    char name[PRESET_NAME_LEN]; // NUL padded
+    WaveParams params;
+    uint32_t crc; // CRC-32 of everything above and the samples
+} PresetRecord;
+
+typedef struct {
+    int records;         // Live slots
+    int bytes_used;      // Log bytes in the active half, stale records included
+    int bytes_free;      // Left to append before the next compaction
+    uint32_t generation; // Of the active half; rises by at least one per compaction
+} PresetStoreStats;
+
+// Finds the active half and indexes the newest record of every slot; formats the region
+// if it holds no valid half (first boot). False only if flash writes fail.
+bool preset_store_init(void);
+
+// Saves p to slot (replacing what was there). With render set the sound is also rendered
+// (as the engine would, up to its end) and stored, page by page, with no sample buffer in
+// RAM. False if slot is out of range, the flash write fails, or the record can't fit even
+// after compaction.
+bool preset_store_save(int slot, const char* name, const WaveParams* p, bool render);
+bool preset_store_delete(int slot);
+
+// Newest record of slot, read in place (XIP); NULL if the slot is empty
+const PresetRecord* preset_store_get(int slot);
+// Its stored render through the streaming XIP alias; NULL if it was saved without one
+const int16_t* preset_store_samples(const PresetRecord* r);
+
+void preset_store_get_stats(PresetStoreStats* stats);
+
+#endif
@@ -1,27 +1,71 @@
 #include "pwm_audio.h"
+#include "hardware/clocks.h"
 #include "hardware/dma.h"
 #include "hardware/irq.h"
 #include "hardware/pwm.h"
+#include "hardware/sync.h"
 #include "pico/stdlib.h"
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 
-// Global PWM buffer (made global for debugging access)
-// Memory optimized: 16384 samples * 2 bytes = 32KB
-// This is the ONLY audio buffer needed - we generate PWM values directly!
-uint16_t pwm_buf[MAX_SAMPLES];
+// Streaming block buffers: 2 blocks * 256 samples * AUDIO_OVERSAMPLE * 2 bytes = 4KB at 4x
+// (replaces the old 32KB whole-sound pwm_buf)
+static uint16_t stream_blocks[AUDIO_NUM_BLOCKS][AUDIO_BLOCK_SLOTS];
 
-// DMA channel for audio playback
-static int dma_chan = -1;
+// One DMA channel per block, chained in a ring so the next block starts with no gap
+static int dma_chans[AUDIO_NUM_BLOCKS];
 static int pwm_slice;
 static int pwm_channel;
 static volatile bool is_playing = false;
 
-// DMA interrupt handler - called when playback completes
+// Current stream source
+static pwm_fill_fn stream_fill;
+static void* stream_ctx;
+static volatile int final_block = -1; // Block holding the last samples of the source
+
+// Refill one block from the source. The source is asked again after it has ended,
+// so a sound triggered during the tail keeps the stream running.
+static bool refill_block(int k) {
+    if (stream_fill(stream_blocks[k], AUDIO_BLOCK_SLOTS, stream_ctx)) {
+        final_block = -1;
+        return true;
+    }
+    if (final_block < 0) {
+        final_block = k;
+    }
+    return false;
+}
+
+static void stop_channels(void) {
+    for (int k = 0; k < AUDIO_NUM_BLOCKS; k++) {
+        dma_channel_abort(dma_chans[k]);
+        dma_channel_acknowledge_irq0(dma_chans[k]);
+    }
+    pwm_set_chan_level(pwm_slice, pwm_channel, PWM_SILENCE);
+    final_block = -1;
+    is_playing = false;
+}
+
+// DMA interrupt handler - called each time a block has been drained.
+// The chained channel is already playing the next block, so we have a full
+// block period to rewind this channel and render into its buffer.
 void dma_irq_handler() {
-    if (dma_channel_get_irq0_status(dma_chan)) {
-        dma_channel_acknowledge_irq0(dma_chan);
-        is_playing = false;
+    for (int k = 0; k < AUDIO_NUM_BLOCKS; k++) {
+        int chan = dma_chans[k];
+        if (!dma_channel_get_irq0_status(chan)) {
+            continue;
+        }
+        dma_channel_acknowledge_irq0(chan);
+
+        bool was_final = (k == final_block);
+
+        dma_channel_set_read_addr(chan, stream_blocks[k], false);
+        if (!refill_block(k) && was_final) {
+            // Last samples played and the source is still empty
+            stop_channels();
+            return;
+        }
     }
 }
 
@@ -34,144 +78,166 @@ void pwm_audio_init() {
     pwm_slice = pwm_gpio_to_slice_num(AUDIO_PIN);
     pwm_channel = pwm_gpio_to_channel(AUDIO_PIN);
 
+    // PWM wraps AUDIO_OVERSAMPLE times per sample: the wrap DREQ paces the DMA at PWM_RATE
+    float cycles_per_wrap = (float) clock_get_hz(clk_sys) / PWM_RATE;
+
     pwm_config cfg = pwm_get_default_config();
-    pwm_config_set_clkdiv(&cfg, PWM_DIV);
+    pwm_config_set_clkdiv(&cfg, cycles_per_wrap / (PWM_WRAP + 1));
     pwm_config_set_wrap(&cfg, PWM_WRAP);
 
     pwm_init(pwm_slice, &cfg, true);
-    pwm_set_chan_level(pwm_slice, pwm_channel, 0);
+    pwm_set_chan_level(pwm_slice, pwm_channel, PWM_SILENCE);
 
-    dma_chan = dma_claim_unused_channel(true);
+    // Get the address of the PWM counter compare register
+    volatile void* pwm_cc_reg = &pwm_hw->slice[pwm_slice].cc;
+    // Offset to the correct channel (A=0, B=2 bytes)
+    volatile uint16_t* pwm_output_reg = (volatile uint16_t*) pwm_cc_reg + pwm_channel;
+
+    for (int k = 0; k < AUDIO_NUM_BLOCKS; k++) {
+        dma_chans[k] = dma_claim_unused_channel(true);
+    }
+
+    for (int k = 0; k < AUDIO_NUM_BLOCKS; k++) {
+        dma_channel_config dcfg = dma_channel_get_default_config(dma_chans[k]);
+
+        // Transfer uint16_t values from memory to PWM
+        channel_config_set_transfer_data_size(&dcfg, DMA_SIZE_16);
+        channel_config_set_read_increment(&dcfg, true);   // Read from block
+        channel_config_set_write_increment(&dcfg, false); // Always write to same PWM register
+        channel_config_set_dreq(&dcfg, pwm_get_dreq(pwm_slice));
+        channel_config_set_chain_to(&dcfg, dma_chans[(k + 1) % AUDIO_NUM_BLOCKS]);
+
+        dma_channel_configure(dma_chans[k], &dcfg, pwm_output_reg, // Write to PWM
+                              stream_blocks[k],                    // Read from block
+                              AUDIO_BLOCK_SLOTS,                   // Number of transfers
+                              false                                // Don't start yet
+        );
+        dma_channel_set_irq0_enabled(dma_chans[k], true);
+    }
 
     // Set up DMA IRQ
-    dma_channel_set_irq0_enabled(dma_chan, true);
     irq_set_exclusive_handler(DMA_IRQ_0, dma_irq_handler);
     irq_set_enabled(DMA_IRQ_0, true);
 }
 
+// Start streaming from a fill callback. Only the first block is rendered before
+// the DMA starts, so time-to-first-sample is one block render.
+void pwm_stream_start(pwm_fill_fn fill, void* ctx) {
+    // Don't start new playback if already playing
+    if (is_playing) {
+        return;
+    }
+
+    stream_fill = fill;
+    stream_ctx = ctx;
+    final_block = -1;
+
+    for (int k = 0; k < AUDIO_NUM_BLOCKS; k++) {
+        dma_channel_set_read_addr(dma_chans[k], stream_blocks[k], false);
+    }
+
+    is_playing = true;
+    refill_block(0);
+    dma_channel_start(dma_chans[0]);
+
+    // Remaining blocks are not needed for at least one block period
+    for (int k = 1; k < AUDIO_NUM_BLOCKS; k++) {
+        refill_block(k);
+    }
+}
+
+void pwm_stream_stop(void) {
+    // Keep the DMA IRQ from refilling a block halfway through the abort
+    uint32_t irq_state = save_and_disable_interrupts();
+    if (is_playing) {
+        stop_channels();
+    }
+    restore_interrupts(irq_state);
+}
+
+static inline uint16_t float_to_pwm(float x) {
+    // clamp
+    if (x < -1.0f)
+        x = -1.0f;
+    if (x > 1.0f)
+        x = 1.0f;
+
+    float normalized = (x + 1.0f) * 0.5f; // now 0..1
+    return (uint16_t) (normalized * PWM_WRAP);
+}
+
 void convert_float_to_pwm(const float* float_buf, uint16_t* pwm_buf, int len) {
     for (int i = 0; i < len; i++) {
-        float x = float_buf[i];
-
-        // clamp
-        if (x < -1.0f)
-            x = -1.0f;
-        if (x > 1.0f)
-            x = 1.0f;
+        pwm_buf[i] = float_to_pwm(float_buf[i]);
+    }
+}
 
-        float normalized = (x + 1.0f) * 0.5f; // now 0..1
-        pwm_buf[i] = (uint16_t) (normalized * PWM_WRAP);
+// Source for the legacy whole-buffer players (buffer must outlive playback)
+static struct {
+    const float* float_buf;
+    const uint16_t* pwm_buf;
+    int len;
+    int pos;
+} buffer_src;
+
+static bool fill_from_buffer(uint16_t* block, int len, void* ctx) {
+    int n = buffer_src.len - buffer_src.pos;
+    if (n > len / AUDIO_OVERSAMPLE)
+        n = len / AUDIO_OVERSAMPLE;
+
+    // Converted into the back of the block, then each level held for AUDIO_OVERSAMPLE slots.
+    // Expanding front to back never overwrites a level before its last read.
+    uint16_t* levels = block + len - n;
+    if (buffer_src.float_buf) {
+        convert_float_to_pwm(buffer_src.float_buf + buffer_src.pos, levels, n);
+    } else {
+        memcpy(levels, buffer_src.pwm_buf + buffer_src.pos, n * sizeof(uint16_t));
+    }
+    for (int i = 0; i < n * AUDIO_OVERSAMPLE; i++) {
+        block[i] = levels[i / AUDIO_OVERSAMPLE];
     }
+    for (int i = n * AUDIO_OVERSAMPLE; i < len; i++) {
+        block[i] = PWM_SILENCE;
+    }
+
+    buffer_src.pos += n;
+    return buffer_src.pos < buffer_src.len;
 }
 
 // Blocking version (original implementation - kept for compatibility)
 void pwm_play_buffer(const float* buffer, int len) {
-    convert_float_to_pwm(buffer, pwm_buf, len);
-
     const uint32_t sample_delay_us = (uint32_t) (1e6f / SAMPLE_RATE);
 
     for (int i = 0; i < len; i++) {
-        pwm_set_chan_level(pwm_slice, pwm_channel, pwm_buf[i]);
+        pwm_set_chan_level(pwm_slice, pwm_channel, float_to_pwm(buffer[i]));
         sleep_us(sample_delay_us);
     }
 }
 
-// Non-blocking version using DMA and hardware timer
+// Non-blocking version - float samples are converted block by block as they stream
 void pwm_play_buffer_nonblocking(const float* buffer, int len) {
-    // Don't start new playback if already playing
     if (is_playing) {
         return;
     }
 
-    // Convert float samples to PWM values
-    convert_float_to_pwm(buffer, pwm_buf, len);
-
-    is_playing = true;
-
-    // Configure DMA channel
-    dma_channel_config cfg = dma_channel_get_default_config(dma_chan);
-
-    // Transfer uint16_t values from memory to PWM
-    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_16);
-    channel_config_set_read_increment(&cfg, true);  // Read from array
-    channel_config_set_write_increment(&cfg, false); // Always write to same PWM register
-
-    // Set up pacing based on PWM slice
-    channel_config_set_dreq(&cfg, pwm_get_dreq(pwm_slice));
-
-    // Get the address of the PWM counter compare register
-    volatile void* pwm_cc_reg = &pwm_hw->slice[pwm_slice].cc;
-    // Offset to the correct channel (A=0, B=2 bytes)
-    volatile uint16_t* pwm_output_reg = (volatile uint16_t*) pwm_cc_reg + pwm_channel;
-
-    // Configure the DMA transfer
-    dma_channel_configure(dma_chan, &cfg, pwm_output_reg, // Write to PWM
-                          pwm_buf,                        // Read from buffer
-                          len,                            // Number of transfers
-                          false                           // Don't start yet
-    );
-
-    // Set PWM frequency to match sample rate
-    // PWM runs at system clock / (div * (wrap+1))
-    // We want PWM to wrap at sample_rate Hz
-    float sys_clk = 125000000.0f; // 125 MHz system clock
-    float pwm_freq = SAMPLE_RATE;
-    float cycles_per_sample = sys_clk / pwm_freq;
-
-    pwm_config cfg_pwm = pwm_get_default_config();
-    pwm_config_set_clkdiv(&cfg_pwm, cycles_per_sample / (PWM_WRAP + 1));
-    pwm_config_set_wrap(&cfg_pwm, PWM_WRAP);
-    pwm_init(pwm_slice, &cfg_pwm, true);
-
-    // Start the DMA transfer
-    dma_channel_start(dma_chan);
+    buffer_src.float_buf = buffer;
+    buffer_src.pwm_buf = NULL;
+    buffer_src.len = len;
+    buffer_src.pos = 0;
+    pwm_stream_start(fill_from_buffer, NULL);
 }
 
-// Memory-optimized version: plays PWM buffer directly without conversion
-// Saves CPU time and eliminates redundant float->PWM conversion
+// Plays a prerendered PWM buffer (buffer must stay valid until playback ends)
 void pwm_play_pwm_nonblocking(const uint16_t* pwm_buffer, int len) {
-    // Don't start new playback if already playing
     if (is_playing) {
         return;
     }
 
-    is_playing = true;
-
-    // Configure DMA channel
-    dma_channel_config cfg = dma_channel_get_default_config(dma_chan);
-
-    // Transfer uint16_t values from memory to PWM
-    channel_config_set_transfer_data_size(&cfg, DMA_SIZE_16);
-    channel_config_set_read_increment(&cfg, true);  // Read from array
-    channel_config_set_write_increment(&cfg, false); // Always write to same PWM register
-
-    // Set up pacing based on PWM slice
-    channel_config_set_dreq(&cfg, pwm_get_dreq(pwm_slice));
-
-    // Get the address of the PWM counter compare register
-    volatile void* pwm_cc_reg = &pwm_hw->slice[pwm_slice].cc;
-    // Offset to the correct channel (A=0, B=2 bytes)
-    volatile uint16_t* pwm_output_reg = (volatile uint16_t*) pwm_cc_reg + pwm_channel;
-
-    // Configure the DMA transfer - use pwm_buffer directly (no conversion needed!)
-    dma_channel_configure(dma_chan, &cfg, pwm_output_reg, // Write to PWM
-                          pwm_buffer,                     // Read directly from PWM buffer
-                          len,                            // Number of transfers
-                          false                           // Don't start yet
-    );
-
-    // Set PWM frequency to match sample rate
-    float sys_clk = 125000000.0f; // 125 MHz system clock
-    float pwm_freq = SAMPLE_RATE;
-    float cycles_per_sample = sys_clk / pwm_freq;
-
-    pwm_config cfg_pwm = pwm_get_default_config();
-    pwm_config_set_clkdiv(&cfg_pwm, cycles_per_sample / (PWM_WRAP + 1));
-    pwm_config_set_wrap(&cfg_pwm, PWM_WRAP);
-    pwm_init(pwm_slice, &cfg_pwm, true);
-
-    // Start the DMA transfer
-    dma_channel_start(dma_chan);
+    buffer_src.float_buf = NULL;
+    buffer_src.pwm_buf = pwm_buffer;
+    buffer_src.len = len;
+    buffer_src.pos = 0;
+    pwm_stream_start(fill_from_buffer, NULL);
 }
 
 // Check if audio is currently playing
@@ -7,16 +7,42 @@
 #define AUDIO_PIN 36
 #define PWM_WRAP 255
 #define PWM_DIV 1.0f
+#define PWM_SILENCE (PWM_WRAP / 2) // PWM level for 0V
 
 #define SAMPLE_RATE 22050.0f
-#define MAX_SAMPLES 16384
+#define MAX_SAMPLES 16384 // Only bounds the legacy whole-buffer API
+
+// PWM periods per sample (1, 2, 4 or 8). Oversampling moves the carrier out of the audio
+// band and gives the output quantizer room to push its noise above it (see dither.h).
+#ifndef AUDIO_OVERSAMPLE
+#define AUDIO_OVERSAMPLE 4
+#endif
+#define PWM_RATE (SAMPLE_RATE * AUDIO_OVERSAMPLE) // PWM wraps (DMA transfers) per second
+
+// Streaming playback: DMA drains one block while the other is refilled from the DMA IRQ
+#define AUDIO_BLOCK_SIZE 256 // Samples per block (~11.6 ms at 22.05 kHz)
+#define AUDIO_BLOCK_SLOTS (AUDIO_BLOCK_SIZE * AUDIO_OVERSAMPLE) // PWM levels per block
+#define AUDIO_NUM_BLOCKS 2                                      // Ping-pong
+
+// Block fill callback - runs in the DMA IRQ, must write all len PWM levels
+// (AUDIO_BLOCK_SLOTS: AUDIO_OVERSAMPLE per sample).
+// Return false once the source is exhausted (pad the last block with PWM_SILENCE).
+// It keeps being called until the final block has played; returning true again
+// (e.g. a new hit arrived) keeps the stream running.
+typedef bool (*pwm_fill_fn)(uint16_t* block, int len, void* ctx);
+
+// Q15 sample in [-1.0, 1.0] (+-32768) -> PWM level
+static inline uint16_t pwm_level_q15(int32_t x) {
+    return (uint16_t) (((x + 32768) * PWM_WRAP) >> 16);
+}
 
 void pwm_audio_init(void);
-void pwm_play_buffer(const float* buffer, int len);  // Legacy - kept for compatibility
-void pwm_play_buffer_nonblocking(const float* buffer, int len);  // Legacy
-void pwm_play_pwm_nonblocking(const uint16_t* pwm_buffer, int len);  // RECOMMENDED: Direct PWM playback
+void pwm_stream_start(pwm_fill_fn fill, void* ctx); // Start streaming (ignored if playing)
+void pwm_stream_stop(void);                         // Abort immediately (safe from main)
+void pwm_play_buffer(const float* buffer, int len);             // Legacy - kept for compatibility
+void pwm_play_buffer_nonblocking(const float* buffer, int len); // Legacy
+void pwm_play_pwm_nonblocking(const uint16_t* pwm_buffer, int len); // Direct PWM playback
 bool pwm_is_playing(void);
+void convert_float_to_pwm(const float* float_buf, uint16_t* pwm_buf, int len); // [-1, 1] -> level
 
-extern uint16_t pwm_buf[MAX_SAMPLES];  // Main audio buffer (32KB)
-
-#endif
\ No newline at end of file
+#endif
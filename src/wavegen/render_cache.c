@@ -0,0 +1,312 @@
+#include "render_cache.h"
+#include "dsp.h"
+#include <math.h>
+#include <stddef.h>
+
+#define CACHE_CHUNKS (RENDER_CACHE_BYTES / (RENDER_CACHE_CHUNK * (int) sizeof(int16_t)))
+#define KEY_WORDS 16 // One per WaveParams field
+
+struct RenderCacheEntry {
+    bool used;
+    uint32_t hash;
+    int32_t key[KEY_WORDS];
+    int length; // Samples
+    uint32_t last_used;
+    volatile int pins;
+    int16_t chunks[CACHE_CHUNKS]; // Arena chunk for each RENDER_CACHE_CHUNK samples
+};
+
+static int16_t arena[CACHE_CHUNKS][RENDER_CACHE_CHUNK];
+static uint16_t chunk_peak[CACHE_CHUNKS];
+static int16_t free_list[CACHE_CHUNKS];
+static int free_count;
+
+static RenderCacheEntry entries[RENDER_CACHE_ENTRIES];
+static uint32_t use_clock;
+static RenderCacheStats stats;
+
+// ==================================================
+// KEYS
+// ==================================================
+// Quantization steps, finer than the pots resolve, so pot jitter below them
+// maps to the same render
+static const float key_steps[KEY_WORDS] = {
+    0.1f,          // frequency (Hz)
+    1.0f / 1024,   // amplitude
+    0.001f,        // decay (s)
+    1.0f,          // waveform_id
+    1.0f / 1024,   // offset_dc
+    1.0f / 256,    // pitch_decay
+    1.0f / 1024,   // noise_mix
+    1.0f / 256,    // env_curve
+    1.0f / 1024,   // comp_amount
+    0.001f,        // env_attack (s)
+    0.001f,        // env_hold (s)
+    1.0f,          // filter_type
+    1.0f,          // filter_cutoff (Hz)
+    1.0f / 1024,   // filter_res
+    1.0f / 256,    // filter_env (octaves)
+    0.001f,        // filter_decay (s)
+};
+
+static inline int32_t quantize(float x, int k) {
+    return (int32_t) lrintf(x / key_steps[k]);
+}
+
+static void make_key(const WaveParams* p, int32_t* key) {
+    key[0] = quantize(p->frequency, 0);
+    key[1] = quantize(p->amplitude, 1);
+    key[2] = quantize(p->decay, 2);
+    key[3] = p->waveform_id;
+    key[4] = quantize(p->offset_dc, 4);
+    key[5] = quantize(p->pitch_decay, 5);
+    key[6] = quantize(p->noise_mix, 6);
+    key[7] = quantize(p->env_curve, 7);
+    key[8] = quantize(p->comp_amount, 8);
+    key[9] = quantize(p->env_attack, 9);
+    key[10] = quantize(p->env_hold, 10);
+    key[11] = p->filter_type;
+    key[12] = quantize(p->filter_cutoff, 12);
+    key[13] = quantize(p->filter_res, 13);
+    key[14] = quantize(p->filter_env, 14);
+    key[15] = quantize(p->filter_decay, 15);
+}
+
+// The params a key stands for - renders always use these, so a key maps to one sound
+static void key_params(const int32_t* key, WaveParams* p) {
+    p->frequency = key[0] * key_steps[0];
+    p->amplitude = key[1] * key_steps[1];
+    p->decay = key[2] * key_steps[2];
+    p->waveform_id = key[3];
+    p->offset_dc = key[4] * key_steps[4];
+    p->pitch_decay = key[5] * key_steps[5];
+    p->noise_mix = key[6] * key_steps[6];
+    p->env_curve = key[7] * key_steps[7];
+    p->comp_amount = key[8] * key_steps[8];
+    p->env_attack = key[9] * key_steps[9];
+    p->env_hold = key[10] * key_steps[10];
+    p->filter_type = key[11];
+    p->filter_cutoff = key[12] * key_steps[12];
+    p->filter_res = key[13] * key_steps[13];
+    p->filter_env = key[14] * key_steps[14];
+    p->filter_decay = key[15] * key_steps[15];
+}
+
+// FNV-1a over the key words
+static uint32_t key_hash(const int32_t* key) {
+    uint32_t h = 2166136261u;
+    for (int k = 0; k < KEY_WORDS; k++) {
+        h = (h ^ (uint32_t) key[k]) * 16777619u;
+    }
+    return h;
+}
+
+static RenderCacheEntry* find(const int32_t* key, uint32_t hash) {
+    for (int i = 0; i < RENDER_CACHE_ENTRIES; i++) {
+        RenderCacheEntry* e = &entries[i];
+        if (!e->used || e->hash != hash)
+            continue;
+
+        bool same = true;
+        for (int k = 0; k < KEY_WORDS; k++) {
+            same = same && (e->key[k] == key[k]);
+        }
+        if (same)
+            return e;
+    }
+    return NULL;
+}
+
+// ==================================================
+// ARENA
+// ==================================================
+static int chunks_for(int length) {
+    return (length + RENDER_CACHE_CHUNK - 1) / RENDER_CACHE_CHUNK;
+}
+
+static void entry_free(RenderCacheEntry* e) {
+    for (int c = 0; c < chunks_for(e->length); c++) {
+        free_list[free_count++] = e->chunks[c];
+    }
+    e->used = false;
+    stats.entries--;
+    stats.bytes_used -= chunks_for(e->length) * RENDER_CACHE_CHUNK * (int) sizeof(int16_t);
+}
+
+static bool evict_lru(void) {
+    RenderCacheEntry* victim = NULL;
+    for (int i = 0; i < RENDER_CACHE_ENTRIES; i++) {
+        RenderCacheEntry* e = &entries[i];
+        if (e->used && __atomic_load_n(&e->pins, __ATOMIC_ACQUIRE) == 0 &&
+            (!victim || e->last_used < victim->last_used)) {
+            victim = e;
+        }
+    }
+    if (!victim)
+        return false;
+
+    entry_free(victim);
+    stats.evictions++;
+    return true;
+}
+
+static RenderCacheEntry* free_slot(void) {
+    for (int i = 0; i < RENDER_CACHE_ENTRIES; i++) {
+        if (!entries[i].used)
+            return &entries[i];
+    }
+    return NULL;
+}
+
+// Renders p into a new entry, evicting as needed. NULL if pinned entries leave no room.
+static RenderCacheEntry* render_entry(const int32_t* key, uint32_t hash) {
+    WaveParams p;
+    key_params(key, &p);
+
+    WaveVoice v;
+    waveform_voice_start(&v, &p);
+    int chunks = chunks_for(v.total_samples);
+    if (v.total_samples <= 0 || chunks > CACHE_CHUNKS)
+        return NULL;
+
+    // Make room: a free slot and enough chunks, evicting the oldest unpinned entries
+    RenderCacheEntry* e = free_slot();
+    while (!e) {
+        if (!evict_lru())
+            return NULL;
+        e = free_slot();
+    }
+    while (free_count < chunks) {
+        if (!evict_lru())
+            return NULL;
+    }
+
+    int32_t block[RENDER_CACHE_CHUNK / 4];
+    for (int c = 0; c < chunks; c++) {
+        int16_t chunk = free_list[--free_count];
+        int16_t* dst = arena[chunk];
+        int32_t peak = 0;
+
+        for (int done = 0; done < RENDER_CACHE_CHUNK; done += RENDER_CACHE_CHUNK / 4) {
+            waveform_voice_render_q15(&v, block, RENDER_CACHE_CHUNK / 4);
+            for (int i = 0; i < RENDER_CACHE_CHUNK / 4; i++) {
+                int32_t s = sat(block[i], -Q15_ONE, Q15_ONE - 1);
+                int32_t mag = (s < 0) ? -s : s;
+                peak = (mag > peak) ? mag : peak;
+                dst[done + i] = (int16_t) s;
+            }
+        }
+        e->chunks[c] = chunk;
+        chunk_peak[chunk] = (uint16_t) peak;
+    }
+
+    for (int k = 0; k < KEY_WORDS; k++) {
+        e->key[k] = key[k];
+    }
+    e->hash = hash;
+    e->length = v.total_samples;
+    e->pins = 0;
+    e->used = true;
+    stats.entries++;
+    stats.bytes_used += chunks * RENDER_CACHE_CHUNK * (int) sizeof(int16_t);
+    return e;
+}
+
+// ==================================================
+// API
+// ==================================================
+void render_cache_init(void) {
+    for (int i = 0; i < RENDER_CACHE_ENTRIES; i++) {
+        entries[i].used = false;
+    }
+    for (int c = 0; c < CACHE_CHUNKS; c++) {
+        free_list[c] = (int16_t) c;
+    }
+    free_count = CACHE_CHUNKS;
+    use_clock = 0;
+    stats = (RenderCacheStats) {0};
+}
+
+void render_cache_prerender(const WaveParams* sounds, int count) {
+    for (int i = 0; i < count; i++) {
+        const RenderCacheEntry* e = render_cache_acquire(&sounds[i]);
+        if (e)
+            render_cache_release(e);
+    }
+}
+
+// Only plays count (render_cache_lookup): an acquire is the follow-up render of a miss
+// already counted, or setup (prerender, sequencer tracks)
+static const RenderCacheEntry* lookup(const WaveParams* p, bool render, bool count) {
+    int32_t key[KEY_WORDS];
+    make_key(p, key);
+    uint32_t hash = key_hash(key);
+
+    RenderCacheEntry* e = find(key, hash);
+    if (count && e) {
+        stats.hits++;
+    } else if (count) {
+        stats.misses++;
+    }
+    if (!e) {
+        e = render ? render_entry(key, hash) : NULL;
+        if (!e)
+            return NULL;
+    }
+
+    e->last_used = ++use_clock;
+    __atomic_fetch_add(&e->pins, 1, __ATOMIC_ACQ_REL);
+    return e;
+}
+
+const RenderCacheEntry* render_cache_lookup(const WaveParams* p) {
+    return lookup(p, false, true);
+}
+
+const RenderCacheEntry* render_cache_acquire(const WaveParams* p) {
+    return lookup(p, true, false);
+}
+
+void render_cache_pin(const RenderCacheEntry* e) {
+    __atomic_fetch_add(&((RenderCacheEntry*) e)->pins, 1, __ATOMIC_ACQ_REL);
+}
+
+void render_cache_release(const RenderCacheEntry* e) {
+    __atomic_fetch_sub(&((RenderCacheEntry*) e)->pins, 1, __ATOMIC_ACQ_REL);
+}
+
+int render_cache_length(const RenderCacheEntry* e) {
+    return e->length;
+}
+
+int render_cache_read(const RenderCacheEntry* e, int pos, int32_t* out, int len) {
+    int n = e->length - pos;
+    if (n > len)
+        n = len;
+    if (n < 0)
+        n = 0;
+
+    for (int done = 0; done < n;) {
+        int offset = (pos + done) % RENDER_CACHE_CHUNK;
+        const int16_t* src = arena[e->chunks[(pos + done) / RENDER_CACHE_CHUNK]] + offset;
+        int run = RENDER_CACHE_CHUNK - offset;
+        if (run > n - done)
+            run = n - done;
+
+        for (int i = 0; i < run; i++) {
+            out[done + i] = src[i];
+        }
+        done += run;
+    }
+    return n;
+}
+
+int32_t render_cache_level(const RenderCacheEntry* e, int pos) {
+    if (pos >= e->length)
+        return 0;
+    return chunk_peak[e->chunks[pos / RENDER_CACHE_CHUNK]];
+}
+
+void render_cache_get_stats(RenderCacheStats* out) {
+    *out = stats;
+}
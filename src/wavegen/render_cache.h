@@ -0,0 +1,51 @@
+#ifndef RENDER_CACHE_H
+#define RENDER_CACHE_H
+
+#include "waveform_gen.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Finished renders of whole sounds (Q15), keyed by a hash of the quantized WaveParams.
+// Storage is a fixed arena of equal-size chunks, so entries of any length come and go
+// without fragmenting it; least-recently-used entries are evicted when it runs out.
+//
+// Entries are looked up, rendered and evicted from the main thread only. A pinned
+// entry is never evicted: the engine holds a pin for every voice playing from the
+// cache and drops it from the IRQ when the voice ends.
+
+#define RENDER_CACHE_BYTES (160 * 1024) // Sample arena - all six presets take ~106KB
+#define RENDER_CACHE_CHUNK 1024         // Samples per arena chunk
+#define RENDER_CACHE_ENTRIES 16
+
+typedef struct RenderCacheEntry RenderCacheEntry;
+
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+    int entries;
+    int bytes_used;
+} RenderCacheStats;
+
+void render_cache_init(void);
+
+// Renders each sound into the cache ahead of time (e.g. the presets at boot)
+void render_cache_prerender(const WaveParams* sounds, int count);
+
+// Returns the pinned entry for p, or NULL if it isn't cached; counted as a hit or a miss
+const RenderCacheEntry* render_cache_lookup(const WaveParams* p);
+// Same, but renders p on a miss, and not counted in the stats. NULL if the sound doesn't
+// fit next to the pinned entries.
+const RenderCacheEntry* render_cache_acquire(const WaveParams* p);
+void render_cache_pin(const RenderCacheEntry* e);     // Extra pin on an already pinned entry
+void render_cache_release(const RenderCacheEntry* e); // Safe from the IRQ
+
+int render_cache_length(const RenderCacheEntry* e); // Samples
+// Copies up to len samples from pos; returns the number copied (IRQ safe while pinned)
+int render_cache_read(const RenderCacheEntry* e, int pos, int32_t* out, int len);
+// Peak magnitude (Q15) of the chunk holding pos - a cheap loudness estimate
+int32_t render_cache_level(const RenderCacheEntry* e, int pos);
+
+void render_cache_get_stats(RenderCacheStats* stats);
+
+#endif
@@ -0,0 +1,137 @@
+#include "sample_bank.h"
+#include "dsp.h"
+#include "pico/stdlib.h"
+#include "preset_store.h"
+#include "pwm_audio.h"
+#include <math.h>
+#include <string.h>
+
+// Header and table go through the cached window. Sample data is read through the
+// no-allocate alias: reads that hit still come from the XIP cache, but streaming a long
+// sample never evicts the code the audio IRQ is running from.
+#define BANK_CACHED ((const uint8_t*) (XIP_BASE + SAMPLE_BANK_FLASH_OFFSET))
+#define BANK_STREAM ((const uint8_t*) (XIP_NOCACHE_NOALLOC_BASE + SAMPLE_BANK_FLASH_OFFSET))
+
+static const SampleBankEntry* table;
+static int count;
+
+bool sample_bank_init(void) {
+    const SampleBankHeader* h = (const SampleBankHeader*) BANK_CACHED;
+    table = NULL;
+    count = 0;
+
+    if (h->magic != SAMPLE_BANK_MAGIC || h->version != SAMPLE_BANK_VERSION ||
+        h->count > SAMPLE_BANK_MAX || h->size > PRESET_STORE_OFFSET - SAMPLE_BANK_FLASH_OFFSET ||
+        h->size < sizeof(SampleBankHeader) + h->count * sizeof(SampleBankEntry)) {
+        return false;
+    }
+
+    // Every entry must lie inside the image, or a bad bank could read past it. The length
+    // is checked by division: length * bytes per sample can wrap in 32 bits.
+    const SampleBankEntry* e = (const SampleBankEntry*) (h + 1);
+    for (int i = 0; i < h->count; i++) {
+        if ((e[i].bits != 8 && e[i].bits != 16) || e[i].rate == 0 || e[i].offset > h->size ||
+            e[i].length > (h->size - e[i].offset) / (e[i].bits / 8)) {
+            return false;
+        }
+    }
+
+    table = e;
+    count = h->count;
+    return true;
+}
+
+int sample_bank_count(void) {
+    return count;
+}
+
+const SampleBankEntry* sample_bank_entry(int index) {
+    if (index < 0 || index >= count)
+        return NULL;
+    return &table[index];
+}
+
+int sample_bank_find(const char* name) {
+    for (int i = 0; i < count; i++) {
+        if (strncmp(table[i].name, name, SAMPLE_NAME_LEN) == 0)
+            return i;
+    }
+    return -1;
+}
+
+bool sample_player_start(SamplePlayer* s, int index, float gain, float pitch) {
+    const SampleBankEntry* e = sample_bank_entry(index);
+    if (!e)
+        return false;
+    return sample_player_start_pcm(s, BANK_STREAM + e->offset, e->length, e->rate, e->bits, gain,
+                                   pitch);
+}
+
+bool sample_player_start_pcm(SamplePlayer* s, const void* data, uint32_t length, uint32_t rate,
+                             uint8_t bits, float gain, float pitch) {
+    // !(pitch > 0) also rejects NaN. A zero step would never advance (a voice stuck on DC),
+    // and the cast below is undefined out of range, so the step is clamped in float first.
+    if (!data || length < 2 || !(pitch > 0.0f))
+        return false;
+    float step = rate * pitch / SAMPLE_RATE * 65536.0f;
+    step = fminf(fmaxf(step, 1.0f), (float) SAMPLE_STEP_MAX);
+
+    s->data = data;
+    s->length = length;
+    s->bits = bits;
+    s->pos = 0;
+    s->frac = 0;
+    s->step = (uint32_t) step;
+    s->gain = sat((int32_t) (gain * Q15_ONE), 0, Q15_ONE);
+    return true;
+}
+
+static inline int32_t sample_at(const SamplePlayer* s, uint32_t i) {
+    if (s->bits == 16)
+        return ((const int16_t*) s->data)[i];
+    return ((const int8_t*) s->data)[i] * 256;
+}
+
+int sample_player_render(SamplePlayer* s, int32_t* out, int len) {
+    uint32_t pos = s->pos;
+    uint32_t frac = s->frac;
+    int32_t gain = s->gain;
+    int n = 0;
+
+    if (s->step == 65536) {
+        // Recorded at the engine rate: straight reads, no interpolation
+        for (; n < len && pos < s->length; n++, pos++) {
+            out[n] = (sample_at(s, pos) * gain) >> 15;
+        }
+    } else {
+        // Linear interpolation; the last sample only serves as the right-hand neighbour
+        for (; n < len && pos + 1 < s->length; n++) {
+            int32_t a = sample_at(s, pos);
+            int32_t b = sample_at(s, pos + 1);
+            out[n] = ((a + (((b - a) * (int32_t) (frac >> 1)) >> 15)) * gain) >> 15;
+            frac += s->step;
+            pos += frac >> 16;
+            frac &= 0xFFFF;
+        }
+        if (pos + 1 >= s->length)
+            pos = s->length;
+    }
+
+    s->pos = pos;
+    s->frac = frac;
+    for (int i = n; i < len; i++) {
+        out[i] = 0;
+    }
+    return n;
+}
+
+bool sample_player_done(const SamplePlayer* s) {
+    return s->pos >= s->length;
+}
+
+float sample_player_level(const SamplePlayer* s) {
+    // Drums decay, so the remaining fraction is a fair stand-in for the current level
+    if (s->pos >= s->length)
+        return 0.0f;
+    return (float) s->gain / Q15_ONE * (float) (s->length - s->pos) / (float) s->length;
+}
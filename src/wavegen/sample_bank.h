@@ -0,0 +1,72 @@
+#ifndef SAMPLE_BANK_H
+#define SAMPLE_BANK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Factory samples in a bank image in flash, played in place through XIP: no sample data
+// is ever copied to RAM, so a bank of many seconds costs only the player state per voice.
+// Image layout (little endian, built by scripts/build_sample_bank.py):
+//   SampleBankHeader
+//   SampleBankEntry[count]
+//   signed 8- or 16-bit mono PCM per entry, each 4-byte aligned
+
+#ifndef SAMPLE_BANK_FLASH_OFFSET // Where the bank is loaded, past the firmware
+#define SAMPLE_BANK_FLASH_OFFSET (1024 * 1024)
+#endif
+
+#define SAMPLE_BANK_MAGIC 0x4B4E4253u // "SBNK"
+#define SAMPLE_BANK_VERSION 1
+#define SAMPLE_BANK_MAX 256 // Entries
+#define SAMPLE_NAME_LEN 16
+#define SAMPLE_STEP_MAX (16u << 16) // Fastest playback, source samples per output (Q16)
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;
+    uint32_t size; // Whole image, bytes
+    uint32_t reserved;
+} SampleBankHeader;
+
+typedef struct {
+    char name[SAMPLE_NAME_LEN]; // NUL padded
+    uint32_t offset;            // Sample data, bytes from the start of the image
+    uint32_t length;            // Samples
+    uint32_t rate;              // Hz
+    uint8_t bits;               // 8 or 16
+    uint8_t reserved[3];
+} SampleBankEntry;
+
+// Playback state for one bank sample: position in Q16 steps, resampled to SAMPLE_RATE
+typedef struct {
+    const void* data; // XIP address of the PCM
+    uint32_t length;  // Samples
+    uint32_t pos;     // Integer sample position
+    uint32_t frac;    // Fraction of a sample (Q16)
+    uint32_t step;    // Source samples per output sample (Q16)
+    int32_t gain;     // Q15
+    uint8_t bits;
+} SamplePlayer;
+
+// Validates the image at SAMPLE_BANK_FLASH_OFFSET, which must end below the preset store
+// (PRESET_STORE_OFFSET). False (and count 0) if there is none - erased flash reads back
+// as 0xFF.
+bool sample_bank_init(void);
+int sample_bank_count(void);
+const SampleBankEntry* sample_bank_entry(int index); // NULL if out of range
+int sample_bank_find(const char* name);              // Index, or -1
+
+// pitch multiplies the playback rate (1.0 = as recorded). False if index or pitch is invalid.
+bool sample_player_start(SamplePlayer* s, int index, float gain, float pitch);
+// Same for PCM anywhere else that stays readable while it plays (e.g. a stored render in
+// preset_store.h). False if there are fewer than 2 samples or pitch isn't positive; the
+// rate is clamped to SAMPLE_STEP_MAX.
+bool sample_player_start_pcm(SamplePlayer* s, const void* data, uint32_t length, uint32_t rate,
+                             uint8_t bits, float gain, float pitch);
+// Renders up to len Q15 samples and zeroes the rest; returns the number rendered (IRQ safe)
+int sample_player_render(SamplePlayer* s, int32_t* out, int len);
+bool sample_player_done(const SamplePlayer* s);
+float sample_player_level(const SamplePlayer* s); // Rough loudness for voice stealing
+
+#endif
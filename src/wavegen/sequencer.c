@@ -0,0 +1,159 @@
+#include "sequencer.h"
+#include "audio_engine.h"
+#include "pwm_audio.h"
+#include "render_cache.h"
+#include <stddef.h>
+
+// Times are in Q16 samples so odd tempos don't drift: the fractional part of
+// each step carries into the next one
+#define Q16_SHIFT 16
+
+typedef struct {
+    const WaveParams* volatile sound;
+    const RenderCacheEntry* cached; // Pinned render of sound, if it fit in the cache
+    int choke_group;
+    volatile uint32_t steps; // Bit n = step n
+} SeqTrack;
+
+static SeqTrack tracks[SEQ_TRACKS];
+static volatile int length = 16;
+static volatile int32_t step_q16;  // Samples per 16th note
+static volatile int32_t swing_q16; // Odd step delay as a fraction of a step
+static volatile bool running;
+static volatile bool restart;
+static volatile int current_step;
+
+// Clock state - owned by the block hook
+static int next_step;
+static int32_t until_next_q16; // From the start of the current block to next_step
+
+// Straight steps are step_q16 apart; swing moves every odd step later,
+// so even->odd grows and odd->even shrinks by the same amount
+static int32_t step_interval(int step) {
+    int32_t swing = (int32_t) (((int64_t) step_q16 * swing_q16) >> Q16_SHIFT);
+    return (step & 1) ? step_q16 - swing : step_q16 + swing;
+}
+
+// Engine block hook (DMA IRQ): fire every step that falls inside this block
+static void sequencer_clock(int len, void* ctx) {
+    if (restart) {
+        restart = false;
+        next_step = 0;
+        until_next_q16 = 0;
+    }
+    if (next_step >= length) {
+        next_step = 0; // Pattern was shortened
+    }
+
+    int32_t block_q16 = (int32_t) len << Q16_SHIFT;
+    while (until_next_q16 < block_q16) {
+        int step = next_step;
+        int offset = until_next_q16 >> Q16_SHIFT;
+
+        for (int t = 0; t < SEQ_TRACKS; t++) {
+            const WaveParams* sound = tracks[t].sound;
+            if (sound && (tracks[t].steps >> step) & 1) {
+                audio_engine_trigger_at(sound, tracks[t].cached, tracks[t].choke_group, offset);
+            }
+        }
+
+        current_step = step;
+        until_next_q16 += step_interval(step);
+        next_step = (step + 1 < length) ? step + 1 : 0;
+    }
+    until_next_q16 -= block_q16;
+}
+
+void sequencer_init(void) {
+    for (int t = 0; t < SEQ_TRACKS; t++) {
+        tracks[t].sound = NULL;
+        tracks[t].cached = NULL;
+        tracks[t].choke_group = 0;
+        tracks[t].steps = 0;
+    }
+    length = 16;
+    sequencer_set_tempo(SEQ_DEFAULT_BPM);
+    sequencer_set_swing(0.0f);
+}
+
+void sequencer_set_track(int track, const WaveParams* sound, int choke_group) {
+    if (track < 0 || track >= SEQ_TRACKS)
+        return;
+    const RenderCacheEntry* old = tracks[track].cached;
+
+    tracks[track].sound = NULL; // Never fire with a half-updated track
+    tracks[track].cached = sound ? render_cache_acquire(sound) : NULL;
+    tracks[track].choke_group = choke_group;
+    tracks[track].sound = sound;
+
+    if (old) {
+        render_cache_release(old);
+    }
+}
+
+void sequencer_set_step(int track, int step, bool on) {
+    if (track < 0 || track >= SEQ_TRACKS || step < 0 || step >= SEQ_MAX_STEPS)
+        return;
+    uint32_t bit = 1u << step;
+    if (on) {
+        __atomic_fetch_or(&tracks[track].steps, bit, __ATOMIC_RELAXED);
+    } else {
+        __atomic_fetch_and(&tracks[track].steps, ~bit, __ATOMIC_RELAXED);
+    }
+}
+
+bool sequencer_get_step(int track, int step) {
+    if (track < 0 || track >= SEQ_TRACKS || step < 0 || step >= SEQ_MAX_STEPS)
+        return false;
+    return (tracks[track].steps >> step) & 1;
+}
+
+void sequencer_set_pattern(int track, uint32_t steps) {
+    if (track < 0 || track >= SEQ_TRACKS)
+        return;
+    tracks[track].steps = steps;
+}
+
+void sequencer_set_length(int steps) {
+    if (steps < 1)
+        steps = 1;
+    if (steps > SEQ_MAX_STEPS)
+        steps = SEQ_MAX_STEPS;
+    length = steps;
+}
+
+void sequencer_set_tempo(float bpm) {
+    if (bpm < 30.0f)
+        bpm = 30.0f;
+    if (bpm > 300.0f)
+        bpm = 300.0f;
+    // 4 steps per beat; at 30 BPM a step is 11025 samples, well inside Q16 range
+    step_q16 = (int32_t) (SAMPLE_RATE * 60.0f / (bpm * 4.0f) * (1 << Q16_SHIFT));
+}
+
+void sequencer_set_swing(float swing) {
+    if (swing < 0.0f)
+        swing = 0.0f;
+    if (swing > 0.75f)
+        swing = 0.75f;
+    swing_q16 = (int32_t) (swing * (1 << Q16_SHIFT));
+}
+
+void sequencer_start(void) {
+    restart = true;
+    running = true;
+    audio_engine_set_block_hook(sequencer_clock, NULL);
+}
+
+void sequencer_stop(void) {
+    running = false;
+    audio_engine_set_block_hook(NULL, NULL);
+}
+
+bool sequencer_is_running(void) {
+    return running;
+}
+
+int sequencer_current_step(void) {
+    return current_step;
+}
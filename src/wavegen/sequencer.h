@@ -0,0 +1,37 @@
+#ifndef SEQUENCER_H
+#define SEQUENCER_H
+
+#include "waveform_gen.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Pattern step sequencer clocked by the audio stream: steps are scheduled in samples
+// and fired from the engine's block hook at their exact offset inside the block, so
+// timing doesn't depend on the main loop at all.
+
+#define SEQ_TRACKS 6     // One per drum preset
+#define SEQ_MAX_STEPS 32 // Pattern bits per track
+#define SEQ_DEFAULT_BPM 120.0f
+
+void sequencer_init(void);
+
+// Track sound - rendered into the render cache and pinned there while assigned, so steps
+// fire with no synthesis. Falls back to synthesizing from the params (read when a step
+// fires) if it doesn't fit, so only point at sounds that aren't being edited (e.g.
+// drum_presets). NULL mutes the track.
+void sequencer_set_track(int track, const WaveParams* sound, int choke_group);
+
+void sequencer_set_step(int track, int step, bool on);
+bool sequencer_get_step(int track, int step);
+void sequencer_set_pattern(int track, uint32_t steps); // Bit n = step n
+void sequencer_set_length(int steps);                  // 1..SEQ_MAX_STEPS, default 16
+
+void sequencer_set_tempo(float bpm);   // Steps are 16th notes
+void sequencer_set_swing(float swing); // Delay of odd steps, 0.0 (straight) - 0.75 of a step
+
+void sequencer_start(void); // Restarts from step 0 on the next audio block
+void sequencer_stop(void);  // Stops triggering; ringing voices play out
+bool sequencer_is_running(void);
+int sequencer_current_step(void); // Last step fired (for the UI)
+
+#endif
@@ -1,58 +1,54 @@
 #include "waveform_gen.h"
+#include "dsp.h"
+#include "noise.h"
 #include "pwm_audio.h"
+#include "wavetables.h"
 #include <math.h>
-#include <stdlib.h>
-
-#define PI 3.14159265f
-
-#ifndef M_PI
-#define M_PI 3.14159265358979323846
-#endif
-
-// PWM configuration (must match pwm_audio.h)
-#define PWM_WRAP_LOCAL 255
-
-
-#define SINE_TABLE_SIZE 256
-static float sine_table[SINE_TABLE_SIZE];
-static bool sine_table_initialized = false;
-
-// Initialize sine lookup table (called once at startup)
-static void init_sine_table(void) {
-    if (!sine_table_initialized) {
-        for (int i = 0; i < SINE_TABLE_SIZE; i++) {
-            sine_table[i] = sinf(2.0f * M_PI * i / SINE_TABLE_SIZE);
-        }
-        sine_table_initialized = true;
-    }
+#include <stddef.h>
+#include <string.h>
+
+// DDS phase: uint32 fraction of a cycle, so wraparound is free and the tuning step is
+// SAMPLE_RATE / 2^32 (~5 uHz). The top WT_BITS index a wavetable, the next 15 bits
+// interpolate between neighbouring entries.
+#define WT_FRAC_SHIFT (32 - WT_BITS - 15)
+
+// Kernels work on at most this many samples at a time. This sizes their stack scratch,
+// which lives on the (small) IRQ stack when rendering from the DMA handler.
+#define RENDER_CHUNK 64
+
+static WaveKernel wave_kernel = WAVEGEN_KERNEL_DEFAULT;
+
+// Band-limited table for the oscillator at phase increment inc (NULL for noise).
+// Octave k holds only harmonics below Nyquist for increments under 2^(WT_OCTAVE_SHIFT + k).
+static inline const int16_t* wavetable_select(int waveform, uint32_t inc) {
+    if (waveform == 0)
+        return wt_sine;
+    if (waveform < 1 || waveform > 3)
+        return NULL;
+
+    int octave = (inc >> WT_OCTAVE_SHIFT) ? 32 - __builtin_clz(inc >> WT_OCTAVE_SHIFT) : 0;
+    if (octave >= WT_OCTAVES)
+        octave = WT_OCTAVES - 1;
+    return wt_bank[waveform - 1][octave];
 }
 
-// Fast sine lookup - replaces slow sinf() calls
-static inline float fast_sin(float phase) {
-    // Ensure phase is in [0, 1)
-    phase = phase - (int)phase;
-    if (phase < 0.0f) phase += 1.0f;
-
-    // Lookup from table
-    int index = (int)(phase * SINE_TABLE_SIZE) & (SINE_TABLE_SIZE - 1);
-    return sine_table[index];
+// Linearly interpolated table read, Q15 result
+static inline int32_t table_q15(const int16_t* table, uint32_t phase) {
+    uint32_t index = phase >> (32 - WT_BITS);
+    int32_t frac = (int32_t) ((phase >> WT_FRAC_SHIFT) & 0x7FFF);
+    int32_t a = table[index];
+    return a + (((table[index + 1] - a) * frac) >> 15);
 }
 
-// --- Waveform functions ---
-static inline float wave_sine(float phase) {
-    return sinf(2 * PI * phase);
+static inline float table_float(const int16_t* table, uint32_t phase) {
+    uint32_t index = phase >> (32 - WT_BITS);
+    float frac = (float) ((phase >> WT_FRAC_SHIFT) & 0x7FFF) * (1.0f / 32768.0f);
+    float a = table[index];
+    return (a + (table[index + 1] - a) * frac) * (1.0f / 32768.0f);
 }
-static inline float wave_square(float phase) {
-    return (phase < 0.5f) ? 1.0f : -1.0f;
-}
-static inline float wave_triangle(float phase) {
-    return 4.0f * fabsf(phase - 0.5f) - 1.0f;
-}
-static inline float wave_saw(float phase) {
-    return 2.0f * phase - 1.0f;
-}
-static inline float wave_noise() {
-    return (rand() / (float) RAND_MAX) * 2.0f - 1.0f;
+
+static inline uint32_t freq_to_inc(float freq) {
+    return (uint32_t) (freq * (4294967296.0f / SAMPLE_RATE));
 }
 
 int waveform_generate(float* buffer, int max_samples, WaveParams* p) {
@@ -61,38 +57,27 @@ int waveform_generate(float* buffer, int max_samples, WaveParams* p) {
     if (total_samples > max_samples)
         total_samples = max_samples;
 
-    float phase = 0.0f;
+    uint32_t phase_acc = 0;
+    NoiseGen noise;
+    noise_seed(&noise, NOISE_DEFAULT_SEED);
 
     for (int i = 0; i < total_samples; i++) {
         float t = i * dt;
 
         float freq = p->frequency * expf(-p->pitch_decay * t) *
-                     (1.0f + ((rand() / (float) RAND_MAX) - 0.5f) * 0.004f);
+                     (1.0f + noise_next_float(&noise) * 0.002f);
 
-        phase += freq * dt;
-        if (phase >= 1.0f)
-            phase -= 1.0f;
+        uint32_t inc = freq_to_inc(freq);
+        phase_acc += inc;
 
         float val;
-        switch (p->waveform_id) {
-        case 0:
-            val = sinf(2 * M_PI * phase);
-            break;
-        case 1:
-            val = (phase < 0.5f) ? 1.0f : -1.0f;
-            break;
-        case 2:
-            val = 4.0f * fabsf(phase - 0.5f) - 1.0f;
-            break;
-        case 3:
-            val = 2.0f * phase - 1.0f;
-            break;
-        case 4:
-            val = (rand() / (float) RAND_MAX) * 2.0f - 1.0f;
-            break;
-        default:
+        const int16_t* table = wavetable_select(p->waveform_id, inc);
+        if (table) {
+            val = table_float(table, phase_acc);
+        } else if (p->waveform_id == 4) {
+            val = noise_next_float(&noise);
+        } else {
             val = 0;
-            break;
         }
 
         float env = expf(-p->env_curve * t / p->decay);
@@ -115,93 +100,567 @@ int waveform_generate(float* buffer, int max_samples, WaveParams* p) {
     return max_samples;
 }
 
-//eliminate float buffer - OPTIMIZED VERSION WITH ENVELOPE PRECOMPUTATION
-int waveform_generate_pwm(uint16_t* pwm_buffer, int max_samples, WaveParams* p) {
-    // Initialize sine table if needed
-    init_sine_table();
-
+// Envelope stage setup: segment lengths, sound length and the amplitude envelope
+static void voice_setup_env(WaveVoice* v, const WaveParams* p) {
     float dt = 1.0f / SAMPLE_RATE;
-    int total_samples = (int) (p->decay * SAMPLE_RATE);
-    if (total_samples > max_samples)
-        total_samples = max_samples;
 
-    float phase = 0.0f;
+    int attack = (int) (p->env_attack * SAMPLE_RATE);
+    int hold = (int) (p->env_hold * SAMPLE_RATE);
+    int decay = (int) (p->decay * SAMPLE_RATE);
+    if (attack < 0)
+        attack = 0;
+    if (hold < 0)
+        hold = 0;
+    if (decay < 0)
+        decay = 0;
+    v->total_samples = (decay > 0) ? attack + hold + decay : 0;
+
+    // Advances by a per-sample multiplier, re-anchored every chunk - no precomputed
+    // table and no expf() per sample
+    envelope_init(&v->env, attack, hold, (decay > 0) ? -p->env_curve / p->decay * dt : 0.0f);
+}
 
-    // Precompute constants outside the loop
-    float pitch_decay_factor = -p->pitch_decay * dt;
-    float env_decay_factor = -p->env_curve / p->decay * dt;
-    float freq_base = p->frequency * dt;
+// Oscillator stage setup: phase, pitch glide and noise from the start of the sound
+static void voice_setup_osc(WaveVoice* v, const WaveParams* p) {
+    v->phase = 0;
+    v->inc = freq_to_inc(p->frequency);
+    noise_seed(&v->noise, NOISE_DEFAULT_SEED);
+    envelope_init(&v->glide, 0, 0, -p->pitch_decay / SAMPLE_RATE);
+}
 
-    // Cache waveform type to avoid repeated switch statements in hot path
-    int waveform = p->waveform_id;
+static inline float sweep_rate(const WaveParams* p) {
+    return (p->filter_decay > 0.0f) ? -1.0f / (p->filter_decay * SAMPLE_RATE) : 0.0f;
+}
 
-    // Precompute amplitude and offset scaling
-    float amp = p->amplitude;
-    float dc_offset = p->offset_dc;
+// Filter stage setup: response, resonance and the cutoff sweep
+static void voice_setup_filter(WaveVoice* v, const WaveParams* p) {
+    svf_init(&v->filter, (FilterType) p->filter_type, p->filter_res);
+    envelope_init(&v->sweep, 0, 0, sweep_rate(p));
+}
 
-    // ========================================================================
-    // MEGA OPTIMIZATION: Precompute ALL envelope values to eliminate expf() in loop!
-    // This trades ~32KB memory (8K samples max × 4 bytes) for 50-100x speed boost
-    // ========================================================================
-    static float envelope_cache[16384];  // Reusable buffer
-    bool use_env_cache = (env_decay_factor != 0.0f);
+// Streaming voice setup - precompute constants once per sound
+void waveform_voice_start(WaveVoice* v, const WaveParams* p) {
+    v->params = *p;
+    v->pos = 0;
 
-    if (use_env_cache) {
-        // Precompute envelope once, outside the hot loop
-        for (int i = 0; i < total_samples; i++) {
-            envelope_cache[i] = expf(env_decay_factor * i);
+    voice_setup_osc(v, p);
+    voice_setup_filter(v, p);
+    voice_setup_env(v, p);
+    compressor_init(&v->comp, p->comp_amount, p->waveform_id == 0);
+    v->retarget = false;
+}
+
+void waveform_voice_seed(WaveVoice* v, uint32_t seed) {
+    noise_seed(&v->noise, seed);
+}
+
+void waveform_set_kernel(WaveKernel kernel) {
+    wave_kernel = kernel;
+}
+
+// ==================================================
+// LIVE EDITS
+// ==================================================
+// Continuous params take a one-pole step toward their target every chunk (the control
+// rate), then the oscillator, envelopes and filter are re-derived from them
+#define PARAM_SMOOTH 0.15f // Per 64-sample chunk: ~20 ms time constant
+
+static const size_t smoothed_params[] = {
+    offsetof(WaveParams, frequency),     offsetof(WaveParams, amplitude),
+    offsetof(WaveParams, decay),         offsetof(WaveParams, offset_dc),
+    offsetof(WaveParams, pitch_decay),   offsetof(WaveParams, noise_mix),
+    offsetof(WaveParams, env_curve),     offsetof(WaveParams, filter_cutoff),
+    offsetof(WaveParams, filter_res),    offsetof(WaveParams, filter_env),
+    offsetof(WaveParams, filter_decay),
+};
+
+void waveform_voice_retarget(WaveVoice* v, const WaveParams* p) {
+    v->target = *p;
+    v->retarget = true;
+}
+
+static void voice_smooth(WaveVoice* v) {
+    WaveParams* p = &v->params;
+    bool settled = true;
+
+    for (size_t k = 0; k < sizeof(smoothed_params) / sizeof(smoothed_params[0]); k++) {
+        float* cur = (float*) ((char*) p + smoothed_params[k]);
+        float target = *(const float*) ((const char*) &v->target + smoothed_params[k]);
+        float d = target - *cur;
+        if (fabsf(d) <= 1e-4f * fabsf(target) + 1e-6f) {
+            *cur = target;
+        } else {
+            *cur += d * PARAM_SMOOTH;
+            settled = false;
         }
     }
+    p->waveform_id = v->target.waveform_id;
+    p->filter_type = v->target.filter_type;
+
+    v->inc = freq_to_inc(p->frequency);
+    envelope_set_rate(&v->glide, -p->pitch_decay / SAMPLE_RATE);
+    envelope_set_rate(&v->sweep, sweep_rate(p));
+    v->filter.type = (FilterType) p->filter_type;
+    svf_set_resonance(&v->filter, p->filter_res);
+
+    // The decay is re-anchored at the current level, so the sound ends where the new decay
+    // would: the remaining length follows the envelope position, not the sample count
+    int decay = (int) (p->decay * SAMPLE_RATE);
+    float rate = (decay > 0) ? -p->env_curve / p->decay * (1.0f / SAMPLE_RATE) : 0.0f;
+    envelope_set_rate(&v->env, rate);
+    int left = v->env.attack + v->env.hold + decay - v->env.pos;
+    v->total_samples = v->pos + ((left > 0) ? left : 0);
+
+    v->retarget = !settled;
+}
 
-    for (int i = 0; i < total_samples; i++) {
-        // Optimized frequency calculation - still needs expf for pitch decay
-        float freq_mult = (pitch_decay_factor != 0.0f) ? expf(pitch_decay_factor * i) : 1.0f;
-        float phase_inc = freq_base * freq_mult;
-
-        phase += phase_inc;
-        if (phase >= 1.0f)
-            phase -= 1.0f;
+// Filter coefficients for the next n samples: the sweep is sampled once per chunk, so the
+// per-sample loop has no transcendental math (one exp2f + tanf per chunk)
+static void filter_update(WaveVoice* v, int n) {
+    const WaveParams* p = &v->params;
+    float octaves = (p->filter_decay > 0.0f) ? p->filter_env * envelope_level(&v->sweep) : 0.0f;
+    envelope_skip(&v->sweep, n);
+    svf_set_cutoff(&v->filter, p->filter_cutoff * exp2f(octaves) / SAMPLE_RATE);
+}
 
-        float val;
-        switch (waveform) {
-        case 0:
-            // Use lookup table instead of sinf() - FAST!
-            val = fast_sin(phase);
-            break;
-        case 1:
-            val = (phase < 0.5f) ? 1.0f : -1.0f;
-            break;
-        case 2:
-            val = 4.0f * fabsf(phase - 0.5f) - 1.0f;
-            break;
-        case 3:
-            val = 2.0f * phase - 1.0f;
-            break;
-        case 4:
-            val = (rand() / (float) RAND_MAX) * 2.0f - 1.0f;
-            break;
-        default:
-            val = 0;
-            break;
+// Float kernel - reference implementation
+static void render_float(WaveVoice* v, int32_t* out, int n) {
+    float osc[RENDER_CHUNK];
+    float ctrl[RENDER_CHUNK]; // Glide, then envelope, for this chunk
+
+    // Pull state into locals for the hot loop
+    uint32_t phase_acc = v->phase;
+    uint32_t inc = v->inc;
+    int waveform = v->params.waveform_id;
+    float amp = v->params.amplitude;
+    float dc_offset = v->params.offset_dc;
+    float noise_mix = v->params.noise_mix;
+
+    envelope_render_float(&v->glide, ctrl, n);
+
+    // Glide only lowers the pitch, so the table picked at the block start stays alias-free
+    const int16_t* table = wavetable_select(waveform, (uint32_t) (inc * ctrl[0]));
+
+    // Oscillator pass - one interpolated band-limited table read per sample
+    if (table) {
+        for (int i = 0; i < n; i++) {
+            phase_acc += (ctrl[i] < 1.0f) ? (uint32_t) (inc * ctrl[i]) : inc;
+            osc[i] = table_float(table, phase_acc);
+        }
+    } else if (waveform == 4) {
+        noise_fill_float(&v->noise, osc, n);
+    } else {
+        for (int i = 0; i < n; i++) {
+            osc[i] = 0.0f;
         }
+    }
 
-        // Use precomputed envelope - NO expf() call here!
-        float env = use_env_cache ? envelope_cache[i] : 1.0f;
-        val = amp * env * val + dc_offset;
+    if (noise_mix > 0.0f) {
+        float noise[RENDER_CHUNK];
+        noise_fill_float(&v->noise, noise, n);
+        dsp_noise_mix_float(osc, noise, n, noise_mix);
+    }
 
+    if (v->filter.type != FILTER_OFF) {
+        filter_update(v, n);
+        dsp_svf_float(&v->filter, osc, n);
+    }
+
+    // Envelope and amplitude
+    envelope_render_float(&v->env, ctrl, n);
+    for (int i = 0; i < n; i++) {
+        osc[i] = amp * ctrl[i] * osc[i] + dc_offset;
+    }
+
+    if (v->comp.active) {
+        dsp_compress_float(&v->comp, osc, n);
+    }
+
+    // Clamp and Q15 conversion
+    for (int i = 0; i < n; i++) {
+        float val = osc[i];
         if (val > 1.0f)
             val = 1.0f;
         else if (val < -1.0f)
             val = -1.0f;
 
-        pwm_buffer[i] = (uint16_t)((val + 1.0f) * 127.5f);
+        out[i] = (int32_t) (val * Q15_ONE);
     }
 
-    // Fill rest with silence (PWM value for 0V = 127)
-    uint16_t silence = PWM_WRAP_LOCAL / 2;
-    for (int i = total_samples; i < max_samples; i++) {
-        pwm_buffer[i] = silence;
+    v->phase = phase_acc;
+}
+
+// Fixed-point kernel - phase in Q32 (wraps for free), envelope and pitch glide in Q31,
+// oscillator and amplitude in Q15. No float or transcendental math per sample.
+// Runs as four stages (oscillator, filter, envelope, post) so the stage cache below can
+// re-run them separately.
+
+// Oscillator stage kernels, one per source (table, noise, silence) and glide on/off,
+// generated from one body and picked once per chunk from osc_kernels[][], so each loop
+// carries only its own work and the compiler can unroll and pipeline it.
+typedef void (*OscKernel)(WaveVoice* v, const int16_t* table, uint32_t inc, const int32_t* glide,
+                          int16_t* osc, int n);
+
+#define OSC_TABLE_KERNEL(name, GLIDE)                                                              \
+    static void name(WaveVoice* v, const int16_t* table, uint32_t inc, const int32_t* glide,       \
+                     int16_t* osc, int n) {                                                        \
+        uint32_t phase = v->phase;                                                                 \
+        for (int i = 0; i < n; i++) {                                                              \
+            phase += GLIDE ? (uint32_t) (((uint64_t) inc * (uint32_t) glide[i]) >> 31) : inc;      \
+            osc[i] = (int16_t) table_q15(table, phase);                                            \
+        }                                                                                          \
+        v->phase = phase;                                                                          \
+    }
+
+OSC_TABLE_KERNEL(osc_table, 0)
+OSC_TABLE_KERNEL(osc_table_glide, 1)
+
+static void osc_noise(WaveVoice* v, const int16_t* table, uint32_t inc, const int32_t* glide,
+                      int16_t* osc, int n) {
+    noise_fill_q15(&v->noise, osc, n);
+}
+
+static void osc_silent(WaveVoice* v, const int16_t* table, uint32_t inc, const int32_t* glide,
+                       int16_t* osc, int n) {
+    memset(osc, 0, (size_t) n * sizeof(osc[0]));
+}
+
+enum { OSC_TABLE, OSC_NOISE, OSC_SILENT };
+
+static const OscKernel osc_kernels[3][2] = {
+    [OSC_TABLE] = {osc_table, osc_table_glide},
+    [OSC_NOISE] = {osc_noise, osc_noise},
+    [OSC_SILENT] = {osc_silent, osc_silent},
+};
+
+static void osc_noise_mix(WaveVoice* v, int16_t* osc, int n) {
+    int32_t noise_mix = (int32_t) (v->params.noise_mix * Q15_ONE);
+    if (noise_mix > 0) {
+        int16_t noise[RENDER_CHUNK];
+        noise_fill_q15(&v->noise, noise, n);
+        dsp_noise_mix_q15(osc, noise, n, noise_mix);
     }
+}
+
+// Oscillator stage: band-limited oscillator with pitch glide, plus the noise mix (Q15)
+static void stage_osc_fixed(WaveVoice* v, int16_t* osc, int n) {
+    int32_t glide[RENDER_CHUNK];
+    int waveform = v->params.waveform_id;
+
+    // With no pitch decay the glide sits at Q31_ONE: fold it into the increment once (the
+    // same product the generic loop forms every sample, so the output is bit-exact)
+    bool gliding = !envelope_is_full(&v->glide, n);
+    if (gliding) {
+        envelope_render_q31(&v->glide, glide, n);
+    } else {
+        envelope_skip(&v->glide, n);
+        glide[0] = Q31_ONE;
+    }
+    uint32_t inc = (uint32_t) (((uint64_t) v->inc * (uint32_t) glide[0]) >> 31);
+
+    // Glide only lowers the pitch, so the table picked at the block start stays alias-free
+    const int16_t* table = wavetable_select(waveform, inc);
+    int source = table ? OSC_TABLE : (waveform == 4) ? OSC_NOISE : OSC_SILENT;
+    osc_kernels[source][gliding](v, table, gliding ? v->inc : inc, glide, osc, n);
 
+    osc_noise_mix(v, osc, n);
+}
+
+// Generic oscillator stage - renders the glide and multiplies it in on every sample whether
+// or not the pitch moves; kept as the reference the specialized kernels are benchmarked
+// and checked against (WAVE_KERNEL_FIXED_GENERIC)
+static void stage_osc_generic(WaveVoice* v, int16_t* osc, int n) {
+    int32_t glide[RENDER_CHUNK];
+
+    uint32_t phase = v->phase;
+    uint32_t inc_base = v->inc;
+    int waveform = v->params.waveform_id;
+
+    envelope_render_q31(&v->glide, glide, n);
+
+    const int16_t* table =
+        wavetable_select(waveform, (uint32_t) (((uint64_t) inc_base * (uint32_t) glide[0]) >> 31));
+
+    if (table) {
+        for (int i = 0; i < n; i++) {
+            phase += (uint32_t) (((uint64_t) inc_base * (uint32_t) glide[i]) >> 31);
+            osc[i] = (int16_t) table_q15(table, phase);
+        }
+    } else if (waveform == 4) {
+        noise_fill_q15(&v->noise, osc, n);
+    } else {
+        for (int i = 0; i < n; i++) {
+            osc[i] = 0;
+        }
+    }
+
+    osc_noise_mix(v, osc, n);
+    v->phase = phase;
+}
+
+// Filter stage: resonant SVF with per-chunk coefficients (Q15 in place or out of place)
+static void stage_filter_fixed(WaveVoice* v, const int16_t* in, int16_t* out, int n) {
+    for (int i = 0; i < n && in != out; i++) {
+        out[i] = in[i];
+    }
+    filter_update(v, n);
+    dsp_svf_q15(&v->filter, out, n);
+}
+
+// Envelope stage kernels: a full (unity) span multiplies by a constant Q31_ONE instead of
+// rendering the envelope - hold segments, and every sound with no decay
+#define ENV_KERNEL(name, FULL)                                                                     \
+    static void name(WaveVoice* v, const int16_t* osc, int16_t* shaped, int n) {                   \
+        int32_t env[RENDER_CHUNK];                                                                 \
+        if (FULL) {                                                                                \
+            envelope_skip(&v->env, n);                                                             \
+        } else {                                                                                   \
+            envelope_render_q31(&v->env, env, n);                                                  \
+        }                                                                                          \
+        for (int i = 0; i < n; i++) {                                                              \
+            shaped[i] = (int16_t) (((int64_t) (FULL ? Q31_ONE : env[i]) * osc[i]) >> 31);          \
+        }                                                                                          \
+    }
+
+ENV_KERNEL(env_curve, 0)
+ENV_KERNEL(env_full, 1)
+
+// Envelope stage: shaped = osc * env (Q15)
+static void stage_env_fixed(WaveVoice* v, const int16_t* osc, int16_t* shaped, int n) {
+    if (envelope_is_full(&v->env, n)) {
+        env_full(v, osc, shaped, n);
+    } else {
+        env_curve(v, osc, shaped, n);
+    }
+}
+
+// Post stage: amplitude, DC offset, compressor and saturation (Q15)
+static void stage_post_fixed(const WaveVoice* v, const int16_t* shaped, int32_t* out, int n) {
+    int32_t amp = (int32_t) (v->params.amplitude * Q15_ONE);
+    int32_t dc_offset = (int32_t) (v->params.offset_dc * Q15_ONE);
+
+    for (int i = 0; i < n; i++) {
+        out[i] = ((amp * shaped[i]) >> 15) + dc_offset;
+    }
+
+    if (v->comp.active) {
+        dsp_compress_q15(&v->comp, out, n);
+    }
+
+    for (int i = 0; i < n; i++) {
+        out[i] = sat(out[i], -Q15_ONE, Q15_ONE);
+    }
+}
+
+// Error bound vs render_float (same DDS phase, wavetables and noise sequence, host-checked
+// over the presets and a parameter grid): within +-1 PWM level (1/255 of full scale) for
+// the first 8192 samples (+-3 under heavy compression, whose steep curve magnifies Q15
+// rounding) and +-5 over a 2 s glide, where the float glide rounds differently (square/saw
+// up to +-30 in a block where the two pick neighbouring octave tables).
+static void render_fixed(WaveVoice* v, int32_t* out, int n, bool generic) {
+    int16_t buf[RENDER_CHUNK];
+
+    if (generic) {
+        stage_osc_generic(v, buf, n);
+    } else {
+        stage_osc_fixed(v, buf, n);
+    }
+    if (v->filter.type != FILTER_OFF) {
+        stage_filter_fixed(v, buf, buf, n);
+    }
+    if (generic) {
+        env_curve(v, buf, buf, n);
+    } else {
+        stage_env_fixed(v, buf, buf, n);
+    }
+    stage_post_fixed(v, buf, out, n);
+}
+
+int waveform_voice_render_q15(WaveVoice* v, int32_t* out, int len) {
+    int n = v->total_samples - v->pos;
+    if (n > len)
+        n = len;
+    if (n < 0)
+        n = 0;
+
+    for (int done = 0; done < n;) {
+        if (v->retarget) {
+            voice_smooth(v); // Can move the end of the sound either way
+            n = done + v->total_samples - v->pos;
+            n = (n > len) ? len : (n < done) ? done : n;
+            if (n == done)
+                break;
+        }
+        int chunk = (n - done < RENDER_CHUNK) ? n - done : RENDER_CHUNK;
+        if (wave_kernel == WAVE_KERNEL_FLOAT) {
+            render_float(v, out + done, chunk);
+        } else {
+            render_fixed(v, out + done, chunk, wave_kernel == WAVE_KERNEL_FIXED_GENERIC);
+        }
+        v->pos += chunk;
+        done += chunk;
+    }
+
+    for (int i = n; i < len; i++) {
+        out[i] = 0;
+    }
+
+    return n;
+}
+
+int waveform_voice_render(WaveVoice* v, uint16_t* pwm_block, int len) {
+    int32_t q15[RENDER_CHUNK];
+    int total = 0;
+
+    for (int done = 0; done < len;) {
+        int chunk = (len - done < RENDER_CHUNK) ? len - done : RENDER_CHUNK;
+        total += waveform_voice_render_q15(v, q15, chunk);
+        for (int i = 0; i < chunk; i++) {
+            pwm_block[done + i] = pwm_level_q15(q15[i]);
+        }
+        done += chunk;
+    }
+
+    return total;
+}
+
+// Whole-buffer render, kept for callers that want the full sound at once
+int waveform_generate_pwm(uint16_t* pwm_buffer, int max_samples, WaveParams* p) {
+    WaveVoice v;
+    waveform_voice_start(&v, p);
+    waveform_voice_render(&v, pwm_buffer, max_samples);
     return max_samples;
 }
+
+// ==================================================
+// STAGE CACHE
+// ==================================================
+// Which stage each WaveParams field feeds
+#define PARAM_STAGE(field, stage)                                                                  \
+    {offsetof(WaveParams, field), sizeof(((WaveParams*) 0)->field), stage}
+
+static const struct {
+    size_t offset;
+    size_t size;
+    unsigned stage;
+} param_stages[] = {
+    PARAM_STAGE(frequency, WAVE_STAGE_OSC),       PARAM_STAGE(waveform_id, WAVE_STAGE_OSC),
+    PARAM_STAGE(pitch_decay, WAVE_STAGE_OSC),     PARAM_STAGE(noise_mix, WAVE_STAGE_OSC),
+    PARAM_STAGE(filter_type, WAVE_STAGE_FILTER),  PARAM_STAGE(filter_cutoff, WAVE_STAGE_FILTER),
+    PARAM_STAGE(filter_res, WAVE_STAGE_FILTER),   PARAM_STAGE(filter_env, WAVE_STAGE_FILTER),
+    PARAM_STAGE(filter_decay, WAVE_STAGE_FILTER), PARAM_STAGE(decay, WAVE_STAGE_ENV),
+    PARAM_STAGE(env_curve, WAVE_STAGE_ENV),       PARAM_STAGE(env_attack, WAVE_STAGE_ENV),
+    PARAM_STAGE(env_hold, WAVE_STAGE_ENV),        PARAM_STAGE(amplitude, WAVE_STAGE_POST),
+    PARAM_STAGE(offset_dc, WAVE_STAGE_POST),      PARAM_STAGE(comp_amount, WAVE_STAGE_POST),
+};
+
+unsigned waveform_dirty_stages(const WaveParams* a, const WaveParams* b) {
+    unsigned dirty = 0;
+    for (size_t k = 0; k < sizeof(param_stages) / sizeof(param_stages[0]); k++) {
+        size_t off = param_stages[k].offset;
+        if (memcmp((const char*) a + off, (const char*) b + off, param_stages[k].size) != 0) {
+            dirty |= param_stages[k].stage;
+        }
+    }
+    // Everything after the first dirty stage consumes its output
+    if (dirty) {
+        dirty |= WAVE_STAGE_ALL & ~((dirty & -dirty) - 1);
+    }
+    return dirty;
+}
+
+void waveform_stages_init(WaveStageCache* c, int16_t* osc_buf, int16_t* filtered_buf,
+                          int16_t* shaped_buf, int len) {
+    c->valid = false;
+    c->len = len;
+    c->osc = osc_buf;
+    c->filtered = filtered_buf;
+    c->shaped = shaped_buf;
+}
+
+unsigned waveform_stages_update(WaveStageCache* c, const WaveParams* p) {
+    unsigned stages = c->valid ? waveform_dirty_stages(&c->voice.params, p) : WAVE_STAGE_ALL;
+    WaveVoice* v = &c->voice;
+    v->params = *p;
+
+    // A dirty stage starts over; a clean one keeps its output and its state where it stopped
+    if (stages & WAVE_STAGE_OSC) {
+        voice_setup_osc(v, p);
+        c->done[0] = 0;
+    }
+    bool filtered = (p->filter_type != FILTER_OFF);
+    if (stages & WAVE_STAGE_FILTER) {
+        voice_setup_filter(v, p);
+        c->done[1] = 0;
+    }
+    if (stages & WAVE_STAGE_ENV) {
+        voice_setup_env(v, p);
+        c->done[2] = 0;
+    }
+    if (stages & WAVE_STAGE_POST) {
+        compressor_init(&v->comp, p->comp_amount, p->waveform_id == 0);
+    }
+
+    // Only up to the end of the sound (in whole chunks, so the output doesn't depend on the
+    // edit history); a later edit that lengthens it picks each stage up from there
+    int end = (v->total_samples + RENDER_CHUNK - 1) / RENDER_CHUNK * RENDER_CHUNK;
+    if (end > c->len)
+        end = c->len;
+
+    for (; c->done[0] < end; c->done[0] += RENDER_CHUNK) {
+        int chunk = (end - c->done[0] < RENDER_CHUNK) ? end - c->done[0] : RENDER_CHUNK;
+        stage_osc_fixed(v, c->osc + c->done[0], chunk);
+    }
+    // With the filter off the envelope reads the oscillator output directly
+    for (; filtered && c->done[1] < end; c->done[1] += RENDER_CHUNK) {
+        int chunk = (end - c->done[1] < RENDER_CHUNK) ? end - c->done[1] : RENDER_CHUNK;
+        stage_filter_fixed(v, c->osc + c->done[1], c->filtered + c->done[1], chunk);
+    }
+    const int16_t* src = filtered ? c->filtered : c->osc;
+    for (; c->done[2] < end; c->done[2] += RENDER_CHUNK) {
+        int chunk = (end - c->done[2] < RENDER_CHUNK) ? end - c->done[2] : RENDER_CHUNK;
+        stage_env_fixed(v, src + c->done[2], c->shaped + c->done[2], chunk);
+    }
+
+    c->valid = true;
+    return stages;
+}
+
+void waveform_stages_post(const WaveStageCache* c, int pos, int32_t* out, int n) {
+    int end = (c->voice.total_samples < c->len) ? c->voice.total_samples : c->len;
+    int m = end - pos;
+    if (m > n)
+        m = n;
+    if (m < 0)
+        m = 0;
+
+    stage_post_fixed(&c->voice, c->shaped + pos, out, m);
+    for (int i = m; i < n; i++) {
+        out[i] = 0;
+    }
+}
+
+void waveform_render_preview(WaveStageCache* c, uint16_t* out, int points, const WaveParams* p) {
+    int32_t block[RENDER_CHUNK];
+    int per_point = c->len / points;
+    if (per_point < 1)
+        per_point = 1;
+
+    // Only the stages downstream of the edit re-run; the post pass is always cheap
+    waveform_stages_update(c, p);
+
+    int pos = 0;
+    for (int j = 0; j < points; j++) {
+        uint32_t sum = 0;
+        for (int left = per_point; left > 0;) {
+            int n = (left < RENDER_CHUNK) ? left : RENDER_CHUNK;
+            waveform_stages_post(c, pos, block, n);
+            for (int i = 0; i < n; i++) {
+                sum += pwm_level_q15(block[i]);
+            }
+            pos += n;
+            left -= n;
+        }
+        out[j] = (uint16_t) (sum / per_point);
+    }
+}
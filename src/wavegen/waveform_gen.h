@@ -1,6 +1,10 @@
 #ifndef WAVEFORM_GEN_H
 #define WAVEFORM_GEN_H
 
+#include "dsp.h"
+#include "envelope.h"
+#include "noise.h"
+#include <stdbool.h>
 #include <stdint.h>
 
 typedef struct {
@@ -14,12 +18,104 @@ typedef struct {
     float noise_mix;   // Pot 5            0.0-1.0
     float env_curve;   // Pot 6            0.0-10.0
     float comp_amount; // Pot 7            0.0-1.0
+
+    // Envelope segments ahead of the decay, in seconds (not on a pot - 0 in the presets)
+    float env_attack; // Linear rise to full level
+    float env_hold;   // Time held at full level
+
+    // Resonant filter after the oscillator (not on a pot)
+    int filter_type;     // 0=off, 1=low-pass, 2=high-pass, 3=band-pass (FilterType)
+    float filter_cutoff; // Hz, where the sweep settles
+    float filter_res;    // 0.0-1.0
+    float filter_env;    // Sweep start in octaves above the cutoff (negative sweeps up)
+    float filter_decay;  // Sweep time constant (s); 0 = no sweep
 } WaveParams;
 
+// Synthesis kernel used by the streaming renderer. The fixed-point kernel (Q15/Q31,
+// no float math per sample) matches the float one within +-1 PWM level on the
+// envelope path; see render_fixed() for the oscillator phase bound. The fixed kernel runs
+// per-variant loops (oscillator source x glide on/off x envelope curve/unity) picked once
+// per chunk; WAVE_KERNEL_FIXED_GENERIC is the same math without the specialization, for
+// benchmarking (bit-exact with WAVE_KERNEL_FIXED).
+typedef enum { WAVE_KERNEL_FLOAT, WAVE_KERNEL_FIXED, WAVE_KERNEL_FIXED_GENERIC } WaveKernel;
+
+#ifndef WAVEGEN_KERNEL_DEFAULT // Override with -DWAVEGEN_KERNEL_DEFAULT=WAVE_KERNEL_FLOAT
+#define WAVEGEN_KERNEL_DEFAULT WAVE_KERNEL_FIXED
+#endif
+
+// Streaming render state for one sound - rendered a block at a time, so
+// sound length is not bounded by any buffer size
+typedef struct {
+    WaveParams params;
+    int pos;           // Samples rendered so far
+    int total_samples; // Sound length in samples
+    uint32_t phase;    // DDS phase accumulator (fraction of a cycle, wraps naturally)
+    uint32_t inc;      // Phase increment per sample before pitch glide
+    Envelope env;      // Amplitude envelope (attack/hold/decay)
+    Envelope glide;    // Pitch glide multiplier (1.0 -> 0)
+    Envelope sweep;    // Filter envelope (1.0 -> 0), read once per chunk
+    Svf filter;        // Coefficients updated every chunk from the sweep
+    NoiseGen noise;    // Per-voice noise source
+    Compressor comp;   // comp_amount transfer curve, built once per sound
+    WaveParams target; // Live edit the params are gliding toward
+    bool retarget;     // params still moving toward target
+} WaveVoice;
+
 // Legacy function - generates float samples
 int waveform_generate(float* buffer, int max_samples, WaveParams* p);
 
 // New memory-optimized function - generates PWM values directly
 int waveform_generate_pwm(uint16_t* pwm_buffer, int max_samples, WaveParams* p);
 
-#endif
\ No newline at end of file
+// Streaming API - start a voice, then render it block by block.
+// waveform_voice_render returns the number of sound samples written; the rest of
+// the block is padded with silence, and 0 means the sound has ended.
+void waveform_voice_start(WaveVoice* v, const WaveParams* p);
+int waveform_voice_render(WaveVoice* v, uint16_t* pwm_block, int len);
+// Same, as Q15 samples in [-32768, 32768] for mixing; the rest of the block is zeroed
+int waveform_voice_render_q15(WaveVoice* v, int32_t* out, int len);
+void waveform_voice_seed(WaveVoice* v, uint32_t seed); // Call after start; default is fixed
+// Live edit of a sounding voice: continuous params glide to p over ~20 ms, one step per
+// 64-sample chunk, with the envelopes continuing from their current level. waveform_id
+// and filter_type switch at the next chunk; comp_amount, env_attack and env_hold wait
+// for the next start.
+void waveform_voice_retarget(WaveVoice* v, const WaveParams* p);
+void waveform_set_kernel(WaveKernel kernel); // Run-time kernel selection
+
+// Synthesis pipeline stages, in order. Each WaveParams field feeds one stage, and editing
+// it invalidates that stage and every stage after it.
+typedef enum {
+    WAVE_STAGE_OSC = 1 << 0,    // frequency, waveform_id, pitch_decay, noise_mix
+    WAVE_STAGE_FILTER = 1 << 1, // filter_type, _cutoff, _res, _env, _decay
+    WAVE_STAGE_ENV = 1 << 2,    // decay, env_curve, env_attack, env_hold
+    WAVE_STAGE_POST = 1 << 3,   // amplitude, offset_dc, comp_amount
+    WAVE_STAGE_ALL = 0xF
+} WaveStage;
+
+// Stages that must re-run when a sound changes from a to b (downstream stages included)
+unsigned waveform_dirty_stages(const WaveParams* a, const WaveParams* b);
+
+// Stage cache: the oscillator, filter and envelope stage outputs for the first len samples
+// of a sound, so an edit re-runs only the stages downstream of it. Amplitude, DC and
+// compressor edits cost just the post pass. Stages render only up to the end of the sound
+// and resume from there if an edit lengthens it. Always uses the fixed-point kernel.
+typedef struct {
+    WaveVoice voice; // Params and stage state the buffers hold
+    bool valid;
+    int len;
+    int done[3];       // Samples rendered by the oscillator, filter and envelope stages
+    int16_t* osc;      // Oscillator stage output (Q15)
+    int16_t* filtered; // Filter stage output (Q15) - unused while the filter is off
+    int16_t* shaped;   // Envelope stage output, before amplitude (Q15)
+} WaveStageCache;
+
+void waveform_stages_init(WaveStageCache* c, int16_t* osc_buf, int16_t* filtered_buf,
+                          int16_t* shaped_buf, int len);
+unsigned waveform_stages_update(WaveStageCache* c, const WaveParams* p); // Returns stages run
+// Post stage output for samples [pos, pos + n) as Q15; silence past the end of the sound
+void waveform_stages_post(const WaveStageCache* c, int pos, int32_t* out, int n);
+
+// Renders the cached span of a sound averaged down to points PWM values (for the LCD)
+void waveform_render_preview(WaveStageCache* c, uint16_t* out, int points, const WaveParams* p);
+
+#endif
@@ -0,0 +1,2954 @@
+// Generated by scripts/gen_wavetables.py - do not edit
+#include "wavetables.h"
+
+// clang-format off
+const int16_t wt_sine[WT_SIZE + 1] = {
+    0, 201, 402, 603, 804, 1005, 1206, 1407, 1608, 1809,
+    2009, 2210, 2410, 2611, 2811, 3012, 3212, 3412, 3612, 3811,
+    4011, 4210, 4410, 4609, 4808, 5007, 5205, 5404, 5602, 5800,
+    5998, 6195, 6393, 6590, 6786, 6983, 7179, 7375, 7571, 7767,
+    7962, 8157, 8351, 8545, 8739, 8933, 9126, 9319, 9512, 9704,
+    9896, 10087, 10278, 10469, 10659, 10849, 11039, 11228, 11417, 11605,
+    11793, 11980, 12167, 12353, 12539, 12725, 12910, 13094, 13279, 13462,
+    13645, 13828, 14010, 14191, 14372, 14553, 14732, 14912, 15090, 15269,
+    15446, 15623, 15800, 15976, 16151, 16325, 16499, 16673, 16846, 17018,
+    17189, 17360, 17530, 17700, 17869, 18037, 18204, 18371, 18537, 18703,
+    18868, 19032, 19195, 19357, 19519, 19680, 19841, 20000, 20159, 20317,
+    20475, 20631, 20787, 20942, 21096, 21250, 21403, 21554, 21705, 21856,
+    22005, 22154, 22301, 22448, 22594, 22739, 22884, 23027, 23170, 23311,
+    23452, 23592, 23731, 23870, 24007, 24143, 24279, 24413, 24547, 24680,
+    24811, 24942, 25072, 25201, 25329, 25456, 25582, 25708, 25832, 25955,
+    26077, 26198, 26319, 26438, 26556, 26674, 26790, 26905, 27019, 27133,
+    27245, 27356, 27466, 27575, 27683, 27790, 27896, 28001, 28105, 28208,
+    28310, 28411, 28510, 28609, 28706, 28803, 28898, 28992, 29085, 29177,
+    29268, 29358, 29447, 29534, 29621, 29706, 29791, 29874, 29956, 30037,
+    30117, 30195, 30273, 30349, 30424, 30498, 30571, 30643, 30714, 30783,
+    30852, 30919, 30985, 31050, 31113, 31176, 31237, 31297, 31356, 31414,
+    31470, 31526, 31580, 31633, 31685, 31736, 31785, 31833, 31880, 31926,
+    31971, 32014, 32057, 32098, 32137, 32176, 32213, 32250, 32285, 32318,
+    32351, 32382, 32412, 32441, 32469, 32495, 32521, 32545, 32567, 32589,
+    32609, 32628, 32646, 32663, 32678, 32692, 32705, 32717, 32728, 32737,
+    32745, 32752, 32757, 32761, 32765, 32766, 32767, 32766, 32765, 32761,
+    32757, 32752, 32745, 32737, 32728, 32717, 32705, 32692, 32678, 32663,
+    32646, 32628, 32609, 32589, 32567, 32545, 32521, 32495, 32469, 32441,
+    32412, 32382, 32351, 32318, 32285, 32250, 32213, 32176, 32137, 32098,
+    32057, 32014, 31971, 31926, 31880, 31833, 31785, 31736, 31685, 31633,
+    31580, 31526, 31470, 31414, 31356, 31297, 31237, 31176, 31113, 31050,
+    30985, 30919, 30852, 30783, 30714, 30643, 30571, 30498, 30424, 30349,
+    30273, 30195, 30117, 30037, 29956, 29874, 29791, 29706, 29621, 29534,
+    29447, 29358, 29268, 29177, 29085, 28992, 28898, 28803, 28706, 28609,
+    28510, 28411, 28310, 28208, 28105, 28001, 27896, 27790, 27683, 27575,
+    27466, 27356, 27245, 27133, 27019, 26905, 26790, 26674, 26556, 26438,
+    26319, 26198, 26077, 25955, 25832, 25708, 25582, 25456, 25329, 25201,
+    25072, 24942, 24811, 24680, 24547, 24413, 24279, 24143, 24007, 23870,
+    23731, 23592, 23452, 23311, 23170, 23027, 22884, 22739, 22594, 22448,
+    22301, 22154, 22005, 21856, 21705, 21554, 21403, 21250, 21096, 20942,
+    20787, 20631, 20475, 20317, 20159, 20000, 19841, 19680, 19519, 19357,
+    19195, 19032, 18868, 18703, 18537, 18371, 18204, 18037, 17869, 17700,
+    17530, 17360, 17189, 17018, 16846, 16673, 16499, 16325, 16151, 15976,
+    15800, 15623, 15446, 15269, 15090, 14912, 14732, 14553, 14372, 14191,
+    14010, 13828, 13645, 13462, 13279, 13094, 12910, 12725, 12539, 12353,
+    12167, 11980, 11793, 11605, 11417, 11228, 11039, 10849, 10659, 10469,
+    10278, 10087, 9896, 9704, 9512, 9319, 9126, 8933, 8739, 8545,
+    8351, 8157, 7962, 7767, 7571, 7375, 7179, 6983, 6786, 6590,
+    6393, 6195, 5998, 5800, 5602, 5404, 5205, 5007, 4808, 4609,
+    4410, 4210, 4011, 3811, 3612, 3412, 3212, 3012, 2811, 2611,
+    2410, 2210, 2009, 1809, 1608, 1407, 1206, 1005, 804, 603,
+    402, 201, 0, -201, -402, -603, -804, -1005, -1206, -1407,
+    -1608, -1809, -2009, -2210, -2410, -2611, -2811, -3012, -3212, -3412,
+    -3612, -3811, -4011, -4210, -4410, -4609, -4808, -5007, -5205, -5404,
+    -5602, -5800, -5998, -6195, -6393, -6590, -6786, -6983, -7179, -7375,
+    -7571, -7767, -7962, -8157, -8351, -8545, -8739, -8933, -9126, -9319,
+    -9512, -9704, -9896, -10087, -10278, -10469, -10659, -10849, -11039, -11228,
+    -11417, -11605, -11793, -11980, -12167, -12353, -12539, -12725, -12910, -13094,
+    -13279, -13462, -13645, -13828, -14010, -14191, -14372, -14553, -14732, -14912,
+    -15090, -15269, -15446, -15623, -15800, -15976, -16151, -16325, -16499, -16673,
+    -16846, -17018, -17189, -17360, -17530, -17700, -17869, -18037, -18204, -18371,
+    -18537, -18703, -18868, -19032, -19195, -19357, -19519, -19680, -19841, -20000,
+    -20159, -20317, -20475, -20631, -20787, -20942, -21096, -21250, -21403, -21554,
+    -21705, -21856, -22005, -22154, -22301, -22448, -22594, -22739, -22884, -23027,
+    -23170, -23311, -23452, -23592, -23731, -23870, -24007, -24143, -24279, -24413,
+    -24547, -24680, -24811, -24942, -25072, -25201, -25329, -25456, -25582, -25708,
+    -25832, -25955, -26077, -26198, -26319, -26438, -26556, -26674, -26790, -26905,
+    -27019, -27133, -27245, -27356, -27466, -27575, -27683, -27790, -27896, -28001,
+    -28105, -28208, -28310, -28411, -28510, -28609, -28706, -28803, -28898, -28992,
+    -29085, -29177, -29268, -29358, -29447, -29534, -29621, -29706, -29791, -29874,
+    -29956, -30037, -30117, -30195, -30273, -30349, -30424, -30498, -30571, -30643,
+    -30714, -30783, -30852, -30919, -30985, -31050, -31113, -31176, -31237, -31297,
+    -31356, -31414, -31470, -31526, -31580, -31633, -31685, -31736, -31785, -31833,
+    -31880, -31926, -31971, -32014, -32057, -32098, -32137, -32176, -32213, -32250,
+    -32285, -32318, -32351, -32382, -32412, -32441, -32469, -32495, -32521, -32545,
+    -32567, -32589, -32609, -32628, -32646, -32663, -32678, -32692, -32705, -32717,
+    -32728, -32737, -32745, -32752, -32757, -32761, -32765, -32766, -32767, -32766,
+    -32765, -32761, -32757, -32752, -32745, -32737, -32728, -32717, -32705, -32692,
+    -32678, -32663, -32646, -32628, -32609, -32589, -32567, -32545, -32521, -32495,
+    -32469, -32441, -32412, -32382, -32351, -32318, -32285, -32250, -32213, -32176,
+    -32137, -32098, -32057, -32014, -31971, -31926, -31880, -31833, -31785, -31736,
+    -31685, -31633, -31580, -31526, -31470, -31414, -31356, -31297, -31237, -31176,
+    -31113, -31050, -30985, -30919, -30852, -30783, -30714, -30643, -30571, -30498,
+    -30424, -30349, -30273, -30195, -30117, -30037, -29956, -29874, -29791, -29706,
+    -29621, -29534, -29447, -29358, -29268, -29177, -29085, -28992, -28898, -28803,
+    -28706, -28609, -28510, -28411, -28310, -28208, -28105, -28001, -27896, -27790,
+    -27683, -27575, -27466, -27356, -27245, -27133, -27019, -26905, -26790, -26674,
+    -26556, -26438, -26319, -26198, -26077, -25955, -25832, -25708, -25582, -25456,
+    -25329, -25201, -25072, -24942, -24811, -24680, -24547, -24413, -24279, -24143,
+    -24007, -23870, -23731, -23592, -23452, -23311, -23170, -23027, -22884, -22739,
+    -22594, -22448, -22301, -22154, -22005, -21856, -21705, -21554, -21403, -21250,
+    -21096, -20942, -20787, -20631, -20475, -20317, -20159, -20000, -19841, -19680,
+    -19519, -19357, -19195, -19032, -18868, -18703, -18537, -18371, -18204, -18037,
+    -17869, -17700, -17530, -17360, -17189, -17018, -16846, -16673, -16499, -16325,
+    -16151, -15976, -15800, -15623, -15446, -15269, -15090, -14912, -14732, -14553,
+    -14372, -14191, -14010, -13828, -13645, -13462, -13279, -13094, -12910, -12725,
+    -12539, -12353, -12167, -11980, -11793, -11605, -11417, -11228, -11039, -10849,
+    -10659, -10469, -10278, -10087, -9896, -9704, -9512, -9319, -9126, -8933,
+    -8739, -8545, -8351, -8157, -7962, -7767, -7571, -7375, -7179, -6983,
+    -6786, -6590, -6393, -6195, -5998, -5800, -5602, -5404, -5205, -5007,
+    -4808, -4609, -4410, -4210, -4011, -3811, -3612, -3412, -3212, -3012,
+    -2811, -2611, -2410, -2210, -2009, -1809, -1608, -1407, -1206, -1005,
+    -804, -603, -402, -201, 0,
+};
+
+const int16_t wt_bank[WT_WAVES][WT_OCTAVES][WT_SIZE + 1] = {
+    { // square
+        { // octave 0: 256 harmonics
+            0, 17716, 29052, 32767, 32416, 31820, 32030, 32276, 32150, 32017,
+            32100, 32183, 32124, 32068, 32112, 32153, 32118, 32088, 32115, 32139,
+            32116, 32097, 32116, 32132, 32115, 32103, 32117, 32127, 32115, 32106,
+            32117, 32125, 32115, 32109, 32117, 32123, 32115, 32110, 32117, 32122,
+            32115, 32111, 32117, 32121, 32115, 32112, 32117, 32120, 32115, 32113,
+            32117, 32119, 32115, 32113, 32117, 32119, 32115, 32114, 32117, 32118,
+            32115, 32114, 32117, 32118, 32115, 32114, 32117, 32118, 32115, 32114,
+            32117, 32118, 32115, 32115, 32117, 32118, 32115, 32115, 32117, 32117,
+            32115, 32115, 32117, 32117, 32116, 32115, 32117, 32117, 32116, 32115,
+            32117, 32117, 32116, 32115, 32117, 32117, 32116, 32115, 32117, 32117,
+            32116, 32115, 32117, 32117, 32116, 32115, 32117, 32117, 32116, 32115,
+            32117, 32117, 32116, 32116, 32117, 32117, 32116, 32116, 32117, 32117,
+            32116, 32116, 32117, 32117, 32116, 32116, 32117, 32117, 32116, 32116,
+            32117, 32117, 32116, 32116, 32117, 32116, 32116, 32116, 32117, 32116,
+            32116, 32116, 32117, 32116, 32116, 32116, 32116, 32116, 32116, 32116,
+            32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116,
+            32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116,
+            32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116,
+            32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116,
+            32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116,
+            32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116,
+            32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116,
+            32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116,
+            32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116,
+            32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116,
+            32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116,
+            32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116,
+            32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116,
+            32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116,
+            32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116,
+            32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116,
+            32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116,
+            32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116,
+            32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116,
+            32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116,
+            32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116,
+            32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116, 32116,
+            32117, 32116, 32116, 32116, 32117, 32116, 32116, 32116, 32117, 32116,
+            32116, 32117, 32117, 32116, 32116, 32117, 32117, 32116, 32116, 32117,
+            32117, 32116, 32116, 32117, 32117, 32116, 32116, 32117, 32117, 32116,
+            32116, 32117, 32117, 32115, 32116, 32117, 32117, 32115, 32116, 32117,
+            32117, 32115, 32116, 32117, 32117, 32115, 32116, 32117, 32117, 32115,
+            32116, 32117, 32117, 32115, 32116, 32117, 32117, 32115, 32116, 32117,
+            32117, 32115, 32115, 32117, 32117, 32115, 32115, 32118, 32117, 32115,
+            32115, 32118, 32117, 32114, 32115, 32118, 32117, 32114, 32115, 32118,
+            32117, 32114, 32115, 32118, 32117, 32114, 32115, 32119, 32117, 32113,
+            32115, 32119, 32117, 32113, 32115, 32120, 32117, 32112, 32115, 32121,
+            32117, 32111, 32115, 32122, 32117, 32110, 32115, 32123, 32117, 32109,
+            32115, 32125, 32117, 32106, 32115, 32127, 32117, 32103, 32115, 32132,
+            32116, 32097, 32116, 32139, 32115, 32088, 32118, 32153, 32112, 32068,
+            32124, 32183, 32100, 32017, 32150, 32276, 32030, 31820, 32416, 32767,
+            29052, 17716, 0, -17716, -29052, -32767, -32416, -31820, -32030, -32276,
+            -32150, -32017, -32100, -32183, -32124, -32068, -32112, -32153, -32118, -32088,
+            -32115, -32139, -32116, -32097, -32116, -32132, -32115, -32103, -32117, -32127,
+            -32115, -32106, -32117, -32125, -32115, -32109, -32117, -32123, -32115, -32110,
+            -32117, -32122, -32115, -32111, -32117, -32121, -32115, -32112, -32117, -32120,
+            -32115, -32113, -32117, -32119, -32115, -32113, -32117, -32119, -32115, -32114,
+            -32117, -32118, -32115, -32114, -32117, -32118, -32115, -32114, -32117, -32118,
+            -32115, -32114, -32117, -32118, -32115, -32115, -32117, -32118, -32115, -32115,
+            -32117, -32117, -32115, -32115, -32117, -32117, -32116, -32115, -32117, -32117,
+            -32116, -32115, -32117, -32117, -32116, -32115, -32117, -32117, -32116, -32115,
+            -32117, -32117, -32116, -32115, -32117, -32117, -32116, -32115, -32117, -32117,
+            -32116, -32115, -32117, -32117, -32116, -32116, -32117, -32117, -32116, -32116,
+            -32117, -32117, -32116, -32116, -32117, -32117, -32116, -32116, -32117, -32117,
+            -32116, -32116, -32117, -32117, -32116, -32116, -32117, -32116, -32116, -32116,
+            -32117, -32116, -32116, -32116, -32117, -32116, -32116, -32116, -32116, -32116,
+            -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116,
+            -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116,
+            -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116,
+            -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116,
+            -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116,
+            -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116,
+            -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116,
+            -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116,
+            -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116,
+            -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116,
+            -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116,
+            -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116,
+            -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116,
+            -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116,
+            -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116,
+            -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116,
+            -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116,
+            -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116,
+            -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116,
+            -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116,
+            -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116,
+            -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116, -32116,
+            -32116, -32116, -32117, -32116, -32116, -32116, -32117, -32116, -32116, -32116,
+            -32117, -32116, -32116, -32117, -32117, -32116, -32116, -32117, -32117, -32116,
+            -32116, -32117, -32117, -32116, -32116, -32117, -32117, -32116, -32116, -32117,
+            -32117, -32116, -32116, -32117, -32117, -32115, -32116, -32117, -32117, -32115,
+            -32116, -32117, -32117, -32115, -32116, -32117, -32117, -32115, -32116, -32117,
+            -32117, -32115, -32116, -32117, -32117, -32115, -32116, -32117, -32117, -32115,
+            -32116, -32117, -32117, -32115, -32115, -32117, -32117, -32115, -32115, -32118,
+            -32117, -32115, -32115, -32118, -32117, -32114, -32115, -32118, -32117, -32114,
+            -32115, -32118, -32117, -32114, -32115, -32118, -32117, -32114, -32115, -32119,
+            -32117, -32113, -32115, -32119, -32117, -32113, -32115, -32120, -32117, -32112,
+            -32115, -32121, -32117, -32111, -32115, -32122, -32117, -32110, -32115, -32123,
+            -32117, -32109, -32115, -32125, -32117, -32106, -32115, -32127, -32117, -32103,
+            -32115, -32132, -32116, -32097, -32116, -32139, -32115, -32088, -32118, -32153,
+            -32112, -32068, -32124, -32183, -32100, -32017, -32150, -32276, -32030, -31820,
+            -32416, -32767, -29052, -17716, 0,
+        },
+        { // octave 1: 128 harmonics
+            0, 9360, 17755, 24445, 29074, 31704, 32740, 32767, 32365, 31965,
+            31781, 31829, 32003, 32169, 32240, 32204, 32107, 32016, 31980, 32006,
+            32069, 32126, 32147, 32126, 32083, 32044, 32031, 32047, 32079, 32107,
+            32116, 32103, 32078, 32057, 32051, 32062, 32081, 32098, 32102, 32093,
+            32077, 32064, 32061, 32069, 32082, 32093, 32095, 32088, 32077, 32068,
+            32066, 32072, 32082, 32090, 32091, 32085, 32077, 32070, 32070, 32075,
+            32082, 32087, 32088, 32083, 32077, 32072, 32072, 32076, 32082, 32086,
+            32086, 32082, 32077, 32073, 32073, 32077, 32082, 32085, 32085, 32081,
+            32077, 32074, 32075, 32078, 32082, 32084, 32084, 32081, 32077, 32075,
+            32075, 32078, 32081, 32083, 32083, 32080, 32077, 32076, 32076, 32078,
+            32081, 32083, 32082, 32080, 32077, 32076, 32077, 32079, 32081, 32082,
+            32082, 32080, 32077, 32076, 32077, 32079, 32081, 32082, 32081, 32080,
+            32078, 32077, 32077, 32079, 32081, 32082, 32081, 32079, 32078, 32077,
+            32078, 32079, 32081, 32082, 32081, 32079, 32078, 32077, 32078, 32079,
+            32081, 32081, 32081, 32079, 32078, 32077, 32078, 32080, 32081, 32081,
+            32081, 32079, 32078, 32077, 32078, 32080, 32081, 32081, 32080, 32079,
+            32078, 32078, 32078, 32080, 32081, 32081, 32080, 32079, 32078, 32078,
+            32078, 32080, 32081, 32081, 32080, 32079, 32078, 32078, 32079, 32080,
+            32081, 32081, 32080, 32079, 32078, 32078, 32079, 32080, 32081, 32081,
+            32080, 32079, 32078, 32078, 32079, 32080, 32081, 32081, 32080, 32079,
+            32078, 32078, 32079, 32080, 32081, 32081, 32080, 32079, 32078, 32078,
+            32079, 32080, 32081, 32080, 32080, 32079, 32078, 32078, 32079, 32080,
+            32081, 32080, 32080, 32079, 32078, 32078, 32079, 32080, 32081, 32080,
+            32080, 32079, 32078, 32078, 32079, 32080, 32081, 32080, 32079, 32079,
+            32078, 32078, 32079, 32080, 32081, 32080, 32079, 32079, 32078, 32078,
+            32079, 32080, 32081, 32080, 32079, 32078, 32078, 32078, 32079, 32080,
+            32081, 32080, 32079, 32078, 32078, 32079, 32079, 32080, 32081, 32080,
+            32079, 32078, 32078, 32079, 32079, 32080, 32081, 32080, 32079, 32078,
+            32078, 32079, 32080, 32080, 32081, 32080, 32079, 32078, 32078, 32079,
+            32080, 32080, 32081, 32080, 32079, 32078, 32078, 32079, 32080, 32080,
+            32081, 32080, 32079, 32078, 32078, 32079, 32080, 32081, 32081, 32080,
+            32079, 32078, 32078, 32079, 32080, 32081, 32081, 32080, 32079, 32078,
+            32078, 32079, 32080, 32081, 32081, 32080, 32079, 32078, 32078, 32079,
+            32080, 32081, 32081, 32080, 32079, 32078, 32078, 32079, 32080, 32081,
+            32081, 32080, 32078, 32078, 32078, 32079, 32080, 32081, 32081, 32080,
+            32078, 32078, 32078, 32079, 32080, 32081, 32081, 32080, 32078, 32077,
+            32078, 32079, 32081, 32081, 32081, 32080, 32078, 32077, 32078, 32079,
+            32081, 32081, 32081, 32079, 32078, 32077, 32078, 32079, 32081, 32082,
+            32081, 32079, 32078, 32077, 32078, 32079, 32081, 32082, 32081, 32079,
+            32077, 32077, 32078, 32080, 32081, 32082, 32081, 32079, 32077, 32076,
+            32077, 32080, 32082, 32082, 32081, 32079, 32077, 32076, 32077, 32080,
+            32082, 32083, 32081, 32078, 32076, 32076, 32077, 32080, 32083, 32083,
+            32081, 32078, 32075, 32075, 32077, 32081, 32084, 32084, 32082, 32078,
+            32075, 32074, 32077, 32081, 32085, 32085, 32082, 32077, 32073, 32073,
+            32077, 32082, 32086, 32086, 32082, 32076, 32072, 32072, 32077, 32083,
+            32088, 32087, 32082, 32075, 32070, 32070, 32077, 32085, 32091, 32090,
+            32082, 32072, 32066, 32068, 32077, 32088, 32095, 32093, 32082, 32069,
+            32061, 32064, 32077, 32093, 32102, 32098, 32081, 32062, 32051, 32057,
+            32078, 32103, 32116, 32107, 32079, 32047, 32031, 32044, 32083, 32126,
+            32147, 32126, 32069, 32006, 31980, 32016, 32107, 32204, 32240, 32169,
+            32003, 31829, 31781, 31965, 32365, 32767, 32740, 31704, 29074, 24445,
+            17755, 9360, 0, -9360, -17755, -24445, -29074, -31704, -32740, -32767,
+            -32365, -31965, -31781, -31829, -32003, -32169, -32240, -32204, -32107, -32016,
+            -31980, -32006, -32069, -32126, -32147, -32126, -32083, -32044, -32031, -32047,
+            -32079, -32107, -32116, -32103, -32078, -32057, -32051, -32062, -32081, -32098,
+            -32102, -32093, -32077, -32064, -32061, -32069, -32082, -32093, -32095, -32088,
+            -32077, -32068, -32066, -32072, -32082, -32090, -32091, -32085, -32077, -32070,
+            -32070, -32075, -32082, -32087, -32088, -32083, -32077, -32072, -32072, -32076,
+            -32082, -32086, -32086, -32082, -32077, -32073, -32073, -32077, -32082, -32085,
+            -32085, -32081, -32077, -32074, -32075, -32078, -32082, -32084, -32084, -32081,
+            -32077, -32075, -32075, -32078, -32081, -32083, -32083, -32080, -32077, -32076,
+            -32076, -32078, -32081, -32083, -32082, -32080, -32077, -32076, -32077, -32079,
+            -32081, -32082, -32082, -32080, -32077, -32076, -32077, -32079, -32081, -32082,
+            -32081, -32080, -32078, -32077, -32077, -32079, -32081, -32082, -32081, -32079,
+            -32078, -32077, -32078, -32079, -32081, -32082, -32081, -32079, -32078, -32077,
+            -32078, -32079, -32081, -32081, -32081, -32079, -32078, -32077, -32078, -32080,
+            -32081, -32081, -32081, -32079, -32078, -32077, -32078, -32080, -32081, -32081,
+            -32080, -32079, -32078, -32078, -32078, -32080, -32081, -32081, -32080, -32079,
+            -32078, -32078, -32078, -32080, -32081, -32081, -32080, -32079, -32078, -32078,
+            -32079, -32080, -32081, -32081, -32080, -32079, -32078, -32078, -32079, -32080,
+            -32081, -32081, -32080, -32079, -32078, -32078, -32079, -32080, -32081, -32081,
+            -32080, -32079, -32078, -32078, -32079, -32080, -32081, -32081, -32080, -32079,
+            -32078, -32078, -32079, -32080, -32081, -32080, -32080, -32079, -32078, -32078,
+            -32079, -32080, -32081, -32080, -32080, -32079, -32078, -32078, -32079, -32080,
+            -32081, -32080, -32080, -32079, -32078, -32078, -32079, -32080, -32081, -32080,
+            -32079, -32079, -32078, -32078, -32079, -32080, -32081, -32080, -32079, -32079,
+            -32078, -32078, -32079, -32080, -32081, -32080, -32079, -32078, -32078, -32078,
+            -32079, -32080, -32081, -32080, -32079, -32078, -32078, -32079, -32079, -32080,
+            -32081, -32080, -32079, -32078, -32078, -32079, -32079, -32080, -32081, -32080,
+            -32079, -32078, -32078, -32079, -32080, -32080, -32081, -32080, -32079, -32078,
+            -32078, -32079, -32080, -32080, -32081, -32080, -32079, -32078, -32078, -32079,
+            -32080, -32080, -32081, -32080, -32079, -32078, -32078, -32079, -32080, -32081,
+            -32081, -32080, -32079, -32078, -32078, -32079, -32080, -32081, -32081, -32080,
+            -32079, -32078, -32078, -32079, -32080, -32081, -32081, -32080, -32079, -32078,
+            -32078, -32079, -32080, -32081, -32081, -32080, -32079, -32078, -32078, -32079,
+            -32080, -32081, -32081, -32080, -32078, -32078, -32078, -32079, -32080, -32081,
+            -32081, -32080, -32078, -32078, -32078, -32079, -32080, -32081, -32081, -32080,
+            -32078, -32077, -32078, -32079, -32081, -32081, -32081, -32080, -32078, -32077,
+            -32078, -32079, -32081, -32081, -32081, -32079, -32078, -32077, -32078, -32079,
+            -32081, -32082, -32081, -32079, -32078, -32077, -32078, -32079, -32081, -32082,
+            -32081, -32079, -32077, -32077, -32078, -32080, -32081, -32082, -32081, -32079,
+            -32077, -32076, -32077, -32080, -32082, -32082, -32081, -32079, -32077, -32076,
+            -32077, -32080, -32082, -32083, -32081, -32078, -32076, -32076, -32077, -32080,
+            -32083, -32083, -32081, -32078, -32075, -32075, -32077, -32081, -32084, -32084,
+            -32082, -32078, -32075, -32074, -32077, -32081, -32085, -32085, -32082, -32077,
+            -32073, -32073, -32077, -32082, -32086, -32086, -32082, -32076, -32072, -32072,
+            -32077, -32083, -32088, -32087, -32082, -32075, -32070, -32070, -32077, -32085,
+            -32091, -32090, -32082, -32072, -32066, -32068, -32077, -32088, -32095, -32093,
+            -32082, -32069, -32061, -32064, -32077, -32093, -32102, -32098, -32081, -32062,
+            -32051, -32057, -32078, -32103, -32116, -32107, -32079, -32047, -32031, -32044,
+            -32083, -32126, -32147, -32126, -32069, -32006, -31980, -32016, -32107, -32204,
+            -32240, -32169, -32003, -31829, -31781, -31965, -32365, -32767, -32740, -31704,
+            -29074, -24445, -17755, -9360, 0,
+        },
+        { // octave 2: 64 harmonics
+            0, 4768, 9408, 13797, 17831, 21425, 24520, 27086, 29118, 30641,
+            31699, 32356, 32686, 32767, 32678, 32490, 32263, 32046, 31870, 31755,
+            31704, 31713, 31768, 31852, 31948, 32038, 32109, 32154, 32169, 32157,
+            32122, 32074, 32021, 31972, 31934, 31911, 31906, 31917, 31941, 31973,
+            32007, 32037, 32060, 32073, 32074, 32065, 32047, 32025, 32001, 31980,
+            31965, 31957, 31958, 31966, 31980, 31996, 32014, 32029, 32039, 32044,
+            32043, 32036, 32025, 32012, 31999, 31987, 31980, 31977, 31978, 31984,
+            31993, 32004, 32015, 32023, 32029, 32031, 32029, 32024, 32016, 32007,
+            31999, 31992, 31987, 31986, 31988, 31993, 32000, 32007, 32014, 32020,
+            32023, 32024, 32022, 32017, 32011, 32005, 31999, 31995, 31992, 31992,
+            31994, 31998, 32003, 32009, 32014, 32017, 32019, 32019, 32017, 32013,
+            32009, 32004, 32000, 31996, 31995, 31995, 31997, 32001, 32005, 32009,
+            32013, 32016, 32017, 32016, 32014, 32011, 32007, 32003, 32000, 31998,
+            31997, 31998, 32000, 32003, 32006, 32010, 32013, 32015, 32015, 32014,
+            32012, 32009, 32006, 32003, 32001, 31999, 31999, 31999, 32001, 32004,
+            32007, 32010, 32012, 32014, 32014, 32013, 32011, 32008, 32005, 32003,
+            32001, 32000, 32000, 32001, 32003, 32005, 32008, 32010, 32012, 32013,
+            32013, 32012, 32010, 32007, 32005, 32003, 32001, 32000, 32001, 32002,
+            32004, 32006, 32008, 32010, 32012, 32012, 32012, 32011, 32009, 32007,
+            32005, 32003, 32001, 32001, 32001, 32003, 32004, 32007, 32009, 32010,
+            32012, 32012, 32011, 32010, 32008, 32006, 32004, 32002, 32001, 32001,
+            32002, 32003, 32005, 32007, 32009, 32011, 32011, 32012, 32011, 32010,
+            32008, 32006, 32004, 32002, 32002, 32002, 32002, 32004, 32006, 32008,
+            32009, 32011, 32011, 32011, 32010, 32009, 32007, 32005, 32003, 32002,
+            32002, 32002, 32003, 32004, 32006, 32008, 32010, 32011, 32011, 32011,
+            32010, 32008, 32007, 32005, 32003, 32002, 32002, 32002, 32003, 32005,
+            32007, 32008, 32010, 32011, 32011, 32011, 32010, 32008, 32006, 32004,
+            32003, 32002, 32002, 32002, 32003, 32005, 32007, 32009, 32010, 32011,
+            32011, 32011, 32009, 32008, 32006, 32004, 32002, 32002, 32002, 32002,
+            32004, 32006, 32008, 32010, 32011, 32012, 32011, 32011, 32009, 32007,
+            32005, 32003, 32002, 32001, 32001, 32002, 32004, 32006, 32008, 32010,
+            32011, 32012, 32012, 32010, 32009, 32007, 32004, 32003, 32001, 32001,
+            32001, 32003, 32005, 32007, 32009, 32011, 32012, 32012, 32012, 32010,
+            32008, 32006, 32004, 32002, 32001, 32000, 32001, 32003, 32005, 32007,
+            32010, 32012, 32013, 32013, 32012, 32010, 32008, 32005, 32003, 32001,
+            32000, 32000, 32001, 32003, 32005, 32008, 32011, 32013, 32014, 32014,
+            32012, 32010, 32007, 32004, 32001, 31999, 31999, 31999, 32001, 32003,
+            32006, 32009, 32012, 32014, 32015, 32015, 32013, 32010, 32006, 32003,
+            32000, 31998, 31997, 31998, 32000, 32003, 32007, 32011, 32014, 32016,
+            32017, 32016, 32013, 32009, 32005, 32001, 31997, 31995, 31995, 31996,
+            32000, 32004, 32009, 32013, 32017, 32019, 32019, 32017, 32014, 32009,
+            32003, 31998, 31994, 31992, 31992, 31995, 31999, 32005, 32011, 32017,
+            32022, 32024, 32023, 32020, 32014, 32007, 32000, 31993, 31988, 31986,
+            31987, 31992, 31999, 32007, 32016, 32024, 32029, 32031, 32029, 32023,
+            32015, 32004, 31993, 31984, 31978, 31977, 31980, 31987, 31999, 32012,
+            32025, 32036, 32043, 32044, 32039, 32029, 32014, 31996, 31980, 31966,
+            31958, 31957, 31965, 31980, 32001, 32025, 32047, 32065, 32074, 32073,
+            32060, 32037, 32007, 31973, 31941, 31917, 31906, 31911, 31934, 31972,
+            32021, 32074, 32122, 32157, 32169, 32154, 32109, 32038, 31948, 31852,
+            31768, 31713, 31704, 31755, 31870, 32046, 32263, 32490, 32678, 32767,
+            32686, 32356, 31699, 30641, 29118, 27086, 24520, 21425, 17831, 13797,
+            9408, 4768, 0, -4768, -9408, -13797, -17831, -21425, -24520, -27086,
+            -29118, -30641, -31699, -32356, -32686, -32767, -32678, -32490, -32263, -32046,
+            -31870, -31755, -31704, -31713, -31768, -31852, -31948, -32038, -32109, -32154,
+            -32169, -32157, -32122, -32074, -32021, -31972, -31934, -31911, -31906, -31917,
+            -31941, -31973, -32007, -32037, -32060, -32073, -32074, -32065, -32047, -32025,
+            -32001, -31980, -31965, -31957, -31958, -31966, -31980, -31996, -32014, -32029,
+            -32039, -32044, -32043, -32036, -32025, -32012, -31999, -31987, -31980, -31977,
+            -31978, -31984, -31993, -32004, -32015, -32023, -32029, -32031, -32029, -32024,
+            -32016, -32007, -31999, -31992, -31987, -31986, -31988, -31993, -32000, -32007,
+            -32014, -32020, -32023, -32024, -32022, -32017, -32011, -32005, -31999, -31995,
+            -31992, -31992, -31994, -31998, -32003, -32009, -32014, -32017, -32019, -32019,
+            -32017, -32013, -32009, -32004, -32000, -31996, -31995, -31995, -31997, -32001,
+            -32005, -32009, -32013, -32016, -32017, -32016, -32014, -32011, -32007, -32003,
+            -32000, -31998, -31997, -31998, -32000, -32003, -32006, -32010, -32013, -32015,
+            -32015, -32014, -32012, -32009, -32006, -32003, -32001, -31999, -31999, -31999,
+            -32001, -32004, -32007, -32010, -32012, -32014, -32014, -32013, -32011, -32008,
+            -32005, -32003, -32001, -32000, -32000, -32001, -32003, -32005, -32008, -32010,
+            -32012, -32013, -32013, -32012, -32010, -32007, -32005, -32003, -32001, -32000,
+            -32001, -32002, -32004, -32006, -32008, -32010, -32012, -32012, -32012, -32011,
+            -32009, -32007, -32005, -32003, -32001, -32001, -32001, -32003, -32004, -32007,
+            -32009, -32010, -32012, -32012, -32011, -32010, -32008, -32006, -32004, -32002,
+            -32001, -32001, -32002, -32003, -32005, -32007, -32009, -32011, -32011, -32012,
+            -32011, -32010, -32008, -32006, -32004, -32002, -32002, -32002, -32002, -32004,
+            -32006, -32008, -32009, -32011, -32011, -32011, -32010, -32009, -32007, -32005,
+            -32003, -32002, -32002, -32002, -32003, -32004, -32006, -32008, -32010, -32011,
+            -32011, -32011, -32010, -32008, -32007, -32005, -32003, -32002, -32002, -32002,
+            -32003, -32005, -32007, -32008, -32010, -32011, -32011, -32011, -32010, -32008,
+            -32006, -32004, -32003, -32002, -32002, -32002, -32003, -32005, -32007, -32009,
+            -32010, -32011, -32011, -32011, -32009, -32008, -32006, -32004, -32002, -32002,
+            -32002, -32002, -32004, -32006, -32008, -32010, -32011, -32012, -32011, -32011,
+            -32009, -32007, -32005, -32003, -32002, -32001, -32001, -32002, -32004, -32006,
+            -32008, -32010, -32011, -32012, -32012, -32010, -32009, -32007, -32004, -32003,
+            -32001, -32001, -32001, -32003, -32005, -32007, -32009, -32011, -32012, -32012,
+            -32012, -32010, -32008, -32006, -32004, -32002, -32001, -32000, -32001, -32003,
+            -32005, -32007, -32010, -32012, -32013, -32013, -32012, -32010, -32008, -32005,
+            -32003, -32001, -32000, -32000, -32001, -32003, -32005, -32008, -32011, -32013,
+            -32014, -32014, -32012, -32010, -32007, -32004, -32001, -31999, -31999, -31999,
+            -32001, -32003, -32006, -32009, -32012, -32014, -32015, -32015, -32013, -32010,
+            -32006, -32003, -32000, -31998, -31997, -31998, -32000, -32003, -32007, -32011,
+            -32014, -32016, -32017, -32016, -32013, -32009, -32005, -32001, -31997, -31995,
+            -31995, -31996, -32000, -32004, -32009, -32013, -32017, -32019, -32019, -32017,
+            -32014, -32009, -32003, -31998, -31994, -31992, -31992, -31995, -31999, -32005,
+            -32011, -32017, -32022, -32024, -32023, -32020, -32014, -32007, -32000, -31993,
+            -31988, -31986, -31987, -31992, -31999, -32007, -32016, -32024, -32029, -32031,
+            -32029, -32023, -32015, -32004, -31993, -31984, -31978, -31977, -31980, -31987,
+            -31999, -32012, -32025, -32036, -32043, -32044, -32039, -32029, -32014, -31996,
+            -31980, -31966, -31958, -31957, -31965, -31980, -32001, -32025, -32047, -32065,
+            -32074, -32073, -32060, -32037, -32007, -31973, -31941, -31917, -31906, -31911,
+            -31934, -31972, -32021, -32074, -32122, -32157, -32169, -32154, -32109, -32038,
+            -31948, -31852, -31768, -31713, -31704, -31755, -31870, -32046, -32263, -32490,
+            -32678, -32767, -32686, -32356, -31699, -30641, -29118, -27086, -24520, -21425,
+            -17831, -13797, -9408, -4768, 0,
+        },
+        { // octave 3: 32 harmonics
+            0, 2428, 4839, 7216, 9543, 11805, 13987, 16076, 18061, 19930,
+            21677, 23294, 24776, 26121, 27328, 28397, 29332, 30136, 30815, 31376,
+            31827, 32177, 32436, 32614, 32721, 32767, 32763, 32720, 32645, 32549,
+            32439, 32322, 32206, 32094, 31991, 31902, 31827, 31769, 31728, 31703,
+            31695, 31702, 31721, 31752, 31791, 31836, 31884, 31934, 31983, 32029,
+            32070, 32105, 32134, 32155, 32168, 32173, 32170, 32161, 32146, 32126,
+            32102, 32075, 32047, 32019, 31993, 31968, 31946, 31928, 31914, 31905,
+            31901, 31901, 31905, 31914, 31925, 31940, 31956, 31974, 31993, 32011,
+            32027, 32043, 32056, 32066, 32074, 32078, 32079, 32077, 32072, 32065,
+            32055, 32044, 32032, 32019, 32006, 31993, 31981, 31971, 31963, 31957,
+            31952, 31951, 31951, 31954, 31959, 31965, 31973, 31982, 31992, 32002,
+            32012, 32021, 32029, 32036, 32042, 32046, 32048, 32049, 32047, 32044,
+            32040, 32034, 32027, 32019, 32011, 32003, 31996, 31989, 31982, 31977,
+            31973, 31971, 31970, 31971, 31972, 31976, 31980, 31985, 31991, 31998,
+            32004, 32011, 32017, 32023, 32028, 32031, 32034, 32035, 32036, 32034,
+            32032, 32029, 32025, 32020, 32014, 32009, 32003, 31998, 31992, 31988,
+            31984, 31982, 31980, 31979, 31980, 31981, 31984, 31987, 31991, 31995,
+            32000, 32005, 32010, 32015, 32019, 32023, 32026, 32028, 32029, 32029,
+            32028, 32026, 32024, 32020, 32016, 32012, 32008, 32003, 31999, 31994,
+            31991, 31988, 31986, 31984, 31984, 31984, 31985, 31988, 31990, 31994,
+            31998, 32002, 32006, 32010, 32014, 32018, 32021, 32023, 32025, 32026,
+            32026, 32025, 32023, 32021, 32018, 32015, 32011, 32007, 32003, 31999,
+            31995, 31992, 31990, 31988, 31987, 31986, 31987, 31988, 31990, 31992,
+            31995, 31999, 32002, 32006, 32010, 32014, 32017, 32020, 32022, 32023,
+            32024, 32024, 32023, 32022, 32020, 32017, 32014, 32010, 32007, 32003,
+            31999, 31996, 31993, 31990, 31988, 31987, 31987, 31987, 31988, 31990,
+            31993, 31996, 31999, 32003, 32007, 32010, 32014, 32017, 32020, 32022,
+            32023, 32024, 32024, 32023, 32022, 32020, 32017, 32014, 32010, 32006,
+            32002, 31999, 31995, 31992, 31990, 31988, 31987, 31986, 31987, 31988,
+            31990, 31992, 31995, 31999, 32003, 32007, 32011, 32015, 32018, 32021,
+            32023, 32025, 32026, 32026, 32025, 32023, 32021, 32018, 32014, 32010,
+            32006, 32002, 31998, 31994, 31990, 31988, 31985, 31984, 31984, 31984,
+            31986, 31988, 31991, 31994, 31999, 32003, 32008, 32012, 32016, 32020,
+            32024, 32026, 32028, 32029, 32029, 32028, 32026, 32023, 32019, 32015,
+            32010, 32005, 32000, 31995, 31991, 31987, 31984, 31981, 31980, 31979,
+            31980, 31982, 31984, 31988, 31992, 31998, 32003, 32009, 32014, 32020,
+            32025, 32029, 32032, 32034, 32036, 32035, 32034, 32031, 32028, 32023,
+            32017, 32011, 32004, 31998, 31991, 31985, 31980, 31976, 31972, 31971,
+            31970, 31971, 31973, 31977, 31982, 31989, 31996, 32003, 32011, 32019,
+            32027, 32034, 32040, 32044, 32047, 32049, 32048, 32046, 32042, 32036,
+            32029, 32021, 32012, 32002, 31992, 31982, 31973, 31965, 31959, 31954,
+            31951, 31951, 31952, 31957, 31963, 31971, 31981, 31993, 32006, 32019,
+            32032, 32044, 32055, 32065, 32072, 32077, 32079, 32078, 32074, 32066,
+            32056, 32043, 32027, 32011, 31993, 31974, 31956, 31940, 31925, 31914,
+            31905, 31901, 31901, 31905, 31914, 31928, 31946, 31968, 31993, 32019,
+            32047, 32075, 32102, 32126, 32146, 32161, 32170, 32173, 32168, 32155,
+            32134, 32105, 32070, 32029, 31983, 31934, 31884, 31836, 31791, 31752,
+            31721, 31702, 31695, 31703, 31728, 31769, 31827, 31902, 31991, 32094,
+            32206, 32322, 32439, 32549, 32645, 32720, 32763, 32767, 32721, 32614,
+            32436, 32177, 31827, 31376, 30815, 30136, 29332, 28397, 27328, 26121,
+            24776, 23294, 21677, 19930, 18061, 16076, 13987, 11805, 9543, 7216,
+            4839, 2428, 0, -2428, -4839, -7216, -9543, -11805, -13987, -16076,
+            -18061, -19930, -21677, -23294, -24776, -26121, -27328, -28397, -29332, -30136,
+            -30815, -31376, -31827, -32177, -32436, -32614, -32721, -32767, -32763, -32720,
+            -32645, -32549, -32439, -32322, -32206, -32094, -31991, -31902, -31827, -31769,
+            -31728, -31703, -31695, -31702, -31721, -31752, -31791, -31836, -31884, -31934,
+            -31983, -32029, -32070, -32105, -32134, -32155, -32168, -32173, -32170, -32161,
+            -32146, -32126, -32102, -32075, -32047, -32019, -31993, -31968, -31946, -31928,
+            -31914, -31905, -31901, -31901, -31905, -31914, -31925, -31940, -31956, -31974,
+            -31993, -32011, -32027, -32043, -32056, -32066, -32074, -32078, -32079, -32077,
+            -32072, -32065, -32055, -32044, -32032, -32019, -32006, -31993, -31981, -31971,
+            -31963, -31957, -31952, -31951, -31951, -31954, -31959, -31965, -31973, -31982,
+            -31992, -32002, -32012, -32021, -32029, -32036, -32042, -32046, -32048, -32049,
+            -32047, -32044, -32040, -32034, -32027, -32019, -32011, -32003, -31996, -31989,
+            -31982, -31977, -31973, -31971, -31970, -31971, -31972, -31976, -31980, -31985,
+            -31991, -31998, -32004, -32011, -32017, -32023, -32028, -32031, -32034, -32035,
+            -32036, -32034, -32032, -32029, -32025, -32020, -32014, -32009, -32003, -31998,
+            -31992, -31988, -31984, -31982, -31980, -31979, -31980, -31981, -31984, -31987,
+            -31991, -31995, -32000, -32005, -32010, -32015, -32019, -32023, -32026, -32028,
+            -32029, -32029, -32028, -32026, -32024, -32020, -32016, -32012, -32008, -32003,
+            -31999, -31994, -31991, -31988, -31986, -31984, -31984, -31984, -31985, -31988,
+            -31990, -31994, -31998, -32002, -32006, -32010, -32014, -32018, -32021, -32023,
+            -32025, -32026, -32026, -32025, -32023, -32021, -32018, -32015, -32011, -32007,
+            -32003, -31999, -31995, -31992, -31990, -31988, -31987, -31986, -31987, -31988,
+            -31990, -31992, -31995, -31999, -32002, -32006, -32010, -32014, -32017, -32020,
+            -32022, -32023, -32024, -32024, -32023, -32022, -32020, -32017, -32014, -32010,
+            -32007, -32003, -31999, -31996, -31993, -31990, -31988, -31987, -31987, -31987,
+            -31988, -31990, -31993, -31996, -31999, -32003, -32007, -32010, -32014, -32017,
+            -32020, -32022, -32023, -32024, -32024, -32023, -32022, -32020, -32017, -32014,
+            -32010, -32006, -32002, -31999, -31995, -31992, -31990, -31988, -31987, -31986,
+            -31987, -31988, -31990, -31992, -31995, -31999, -32003, -32007, -32011, -32015,
+            -32018, -32021, -32023, -32025, -32026, -32026, -32025, -32023, -32021, -32018,
+            -32014, -32010, -32006, -32002, -31998, -31994, -31990, -31988, -31985, -31984,
+            -31984, -31984, -31986, -31988, -31991, -31994, -31999, -32003, -32008, -32012,
+            -32016, -32020, -32024, -32026, -32028, -32029, -32029, -32028, -32026, -32023,
+            -32019, -32015, -32010, -32005, -32000, -31995, -31991, -31987, -31984, -31981,
+            -31980, -31979, -31980, -31982, -31984, -31988, -31992, -31998, -32003, -32009,
+            -32014, -32020, -32025, -32029, -32032, -32034, -32036, -32035, -32034, -32031,
+            -32028, -32023, -32017, -32011, -32004, -31998, -31991, -31985, -31980, -31976,
+            -31972, -31971, -31970, -31971, -31973, -31977, -31982, -31989, -31996, -32003,
+            -32011, -32019, -32027, -32034, -32040, -32044, -32047, -32049, -32048, -32046,
+            -32042, -32036, -32029, -32021, -32012, -32002, -31992, -31982, -31973, -31965,
+            -31959, -31954, -31951, -31951, -31952, -31957, -31963, -31971, -31981, -31993,
+            -32006, -32019, -32032, -32044, -32055, -32065, -32072, -32077, -32079, -32078,
+            -32074, -32066, -32056, -32043, -32027, -32011, -31993, -31974, -31956, -31940,
+            -31925, -31914, -31905, -31901, -31901, -31905, -31914, -31928, -31946, -31968,
+            -31993, -32019, -32047, -32075, -32102, -32126, -32146, -32161, -32170, -32173,
+            -32168, -32155, -32134, -32105, -32070, -32029, -31983, -31934, -31884, -31836,
+            -31791, -31752, -31721, -31702, -31695, -31703, -31728, -31769, -31827, -31902,
+            -31991, -32094, -32206, -32322, -32439, -32549, -32645, -32720, -32763, -32767,
+            -32721, -32614, -32436, -32177, -31827, -31376, -30815, -30136, -29332, -28397,
+            -27328, -26121, -24776, -23294, -21677, -19930, -18061, -16076, -13987, -11805,
+            -9543, -7216, -4839, -2428, 0,
+        },
+        { // octave 4: 16 harmonics
+            0, 1249, 2496, 3739, 4974, 6200, 7415, 8617, 9803, 10971,
+            12119, 13246, 14349, 15428, 16479, 17503, 18497, 19460, 20391, 21289,
+            22153, 22982, 23776, 24534, 25256, 25941, 26590, 27202, 27778, 28318,
+            28821, 29290, 29724, 30123, 30490, 30824, 31127, 31400, 31643, 31858,
+            32047, 32210, 32350, 32466, 32561, 32636, 32693, 32733, 32757, 32767,
+            32764, 32750, 32725, 32692, 32652, 32605, 32552, 32496, 32437, 32376,
+            32314, 32252, 32190, 32129, 32071, 32015, 31962, 31913, 31867, 31826,
+            31789, 31756, 31728, 31705, 31687, 31673, 31664, 31660, 31659, 31663,
+            31670, 31681, 31695, 31712, 31732, 31754, 31777, 31802, 31829, 31856,
+            31883, 31911, 31938, 31965, 31991, 32016, 32040, 32062, 32083, 32102,
+            32118, 32133, 32145, 32155, 32163, 32168, 32172, 32173, 32171, 32168,
+            32163, 32155, 32146, 32136, 32124, 32111, 32097, 32082, 32066, 32050,
+            32033, 32017, 32001, 31984, 31969, 31954, 31939, 31926, 31913, 31902,
+            31892, 31883, 31876, 31870, 31866, 31863, 31861, 31861, 31862, 31865,
+            31869, 31874, 31881, 31888, 31896, 31906, 31916, 31926, 31937, 31949,
+            31960, 31972, 31984, 31995, 32006, 32017, 32027, 32037, 32046, 32054,
+            32061, 32067, 32072, 32076, 32079, 32081, 32082, 32082, 32081, 32079,
+            32075, 32071, 32066, 32060, 32054, 32046, 32038, 32030, 32021, 32012,
+            32003, 31994, 31985, 31976, 31967, 31958, 31950, 31943, 31936, 31929,
+            31923, 31918, 31914, 31911, 31909, 31907, 31906, 31907, 31908, 31910,
+            31913, 31916, 31921, 31926, 31932, 31938, 31945, 31952, 31959, 31967,
+            31975, 31983, 31991, 31999, 32006, 32014, 32021, 32027, 32034, 32039,
+            32044, 32048, 32052, 32055, 32057, 32058, 32059, 32058, 32057, 32055,
+            32053, 32049, 32045, 32041, 32035, 32029, 32023, 32017, 32010, 32002,
+            31995, 31988, 31980, 31973, 31966, 31959, 31952, 31946, 31940, 31935,
+            31930, 31926, 31923, 31920, 31918, 31917, 31917, 31917, 31918, 31920,
+            31923, 31926, 31930, 31935, 31940, 31946, 31952, 31959, 31966, 31973,
+            31980, 31988, 31995, 32002, 32010, 32017, 32023, 32029, 32035, 32041,
+            32045, 32049, 32053, 32055, 32057, 32058, 32059, 32058, 32057, 32055,
+            32052, 32048, 32044, 32039, 32034, 32027, 32021, 32014, 32006, 31999,
+            31991, 31983, 31975, 31967, 31959, 31952, 31945, 31938, 31932, 31926,
+            31921, 31916, 31913, 31910, 31908, 31907, 31906, 31907, 31909, 31911,
+            31914, 31918, 31923, 31929, 31936, 31943, 31950, 31958, 31967, 31976,
+            31985, 31994, 32003, 32012, 32021, 32030, 32038, 32046, 32054, 32060,
+            32066, 32071, 32075, 32079, 32081, 32082, 32082, 32081, 32079, 32076,
+            32072, 32067, 32061, 32054, 32046, 32037, 32027, 32017, 32006, 31995,
+            31984, 31972, 31960, 31949, 31937, 31926, 31916, 31906, 31896, 31888,
+            31881, 31874, 31869, 31865, 31862, 31861, 31861, 31863, 31866, 31870,
+            31876, 31883, 31892, 31902, 31913, 31926, 31939, 31954, 31969, 31984,
+            32001, 32017, 32033, 32050, 32066, 32082, 32097, 32111, 32124, 32136,
+            32146, 32155, 32163, 32168, 32171, 32173, 32172, 32168, 32163, 32155,
+            32145, 32133, 32118, 32102, 32083, 32062, 32040, 32016, 31991, 31965,
+            31938, 31911, 31883, 31856, 31829, 31802, 31777, 31754, 31732, 31712,
+            31695, 31681, 31670, 31663, 31659, 31660, 31664, 31673, 31687, 31705,
+            31728, 31756, 31789, 31826, 31867, 31913, 31962, 32015, 32071, 32129,
+            32190, 32252, 32314, 32376, 32437, 32496, 32552, 32605, 32652, 32692,
+            32725, 32750, 32764, 32767, 32757, 32733, 32693, 32636, 32561, 32466,
+            32350, 32210, 32047, 31858, 31643, 31400, 31127, 30824, 30490, 30123,
+            29724, 29290, 28821, 28318, 27778, 27202, 26590, 25941, 25256, 24534,
+            23776, 22982, 22153, 21289, 20391, 19460, 18497, 17503, 16479, 15428,
+            14349, 13246, 12119, 10971, 9803, 8617, 7415, 6200, 4974, 3739,
+            2496, 1249, 0, -1249, -2496, -3739, -4974, -6200, -7415, -8617,
+            -9803, -10971, -12119, -13246, -14349, -15428, -16479, -17503, -18497, -19460,
+            -20391, -21289, -22153, -22982, -23776, -24534, -25256, -25941, -26590, -27202,
+            -27778, -28318, -28821, -29290, -29724, -30123, -30490, -30824, -31127, -31400,
+            -31643, -31858, -32047, -32210, -32350, -32466, -32561, -32636, -32693, -32733,
+            -32757, -32767, -32764, -32750, -32725, -32692, -32652, -32605, -32552, -32496,
+            -32437, -32376, -32314, -32252, -32190, -32129, -32071, -32015, -31962, -31913,
+            -31867, -31826, -31789, -31756, -31728, -31705, -31687, -31673, -31664, -31660,
+            -31659, -31663, -31670, -31681, -31695, -31712, -31732, -31754, -31777, -31802,
+            -31829, -31856, -31883, -31911, -31938, -31965, -31991, -32016, -32040, -32062,
+            -32083, -32102, -32118, -32133, -32145, -32155, -32163, -32168, -32172, -32173,
+            -32171, -32168, -32163, -32155, -32146, -32136, -32124, -32111, -32097, -32082,
+            -32066, -32050, -32033, -32017, -32001, -31984, -31969, -31954, -31939, -31926,
+            -31913, -31902, -31892, -31883, -31876, -31870, -31866, -31863, -31861, -31861,
+            -31862, -31865, -31869, -31874, -31881, -31888, -31896, -31906, -31916, -31926,
+            -31937, -31949, -31960, -31972, -31984, -31995, -32006, -32017, -32027, -32037,
+            -32046, -32054, -32061, -32067, -32072, -32076, -32079, -32081, -32082, -32082,
+            -32081, -32079, -32075, -32071, -32066, -32060, -32054, -32046, -32038, -32030,
+            -32021, -32012, -32003, -31994, -31985, -31976, -31967, -31958, -31950, -31943,
+            -31936, -31929, -31923, -31918, -31914, -31911, -31909, -31907, -31906, -31907,
+            -31908, -31910, -31913, -31916, -31921, -31926, -31932, -31938, -31945, -31952,
+            -31959, -31967, -31975, -31983, -31991, -31999, -32006, -32014, -32021, -32027,
+            -32034, -32039, -32044, -32048, -32052, -32055, -32057, -32058, -32059, -32058,
+            -32057, -32055, -32053, -32049, -32045, -32041, -32035, -32029, -32023, -32017,
+            -32010, -32002, -31995, -31988, -31980, -31973, -31966, -31959, -31952, -31946,
+            -31940, -31935, -31930, -31926, -31923, -31920, -31918, -31917, -31917, -31917,
+            -31918, -31920, -31923, -31926, -31930, -31935, -31940, -31946, -31952, -31959,
+            -31966, -31973, -31980, -31988, -31995, -32002, -32010, -32017, -32023, -32029,
+            -32035, -32041, -32045, -32049, -32053, -32055, -32057, -32058, -32059, -32058,
+            -32057, -32055, -32052, -32048, -32044, -32039, -32034, -32027, -32021, -32014,
+            -32006, -31999, -31991, -31983, -31975, -31967, -31959, -31952, -31945, -31938,
+            -31932, -31926, -31921, -31916, -31913, -31910, -31908, -31907, -31906, -31907,
+            -31909, -31911, -31914, -31918, -31923, -31929, -31936, -31943, -31950, -31958,
+            -31967, -31976, -31985, -31994, -32003, -32012, -32021, -32030, -32038, -32046,
+            -32054, -32060, -32066, -32071, -32075, -32079, -32081, -32082, -32082, -32081,
+            -32079, -32076, -32072, -32067, -32061, -32054, -32046, -32037, -32027, -32017,
+            -32006, -31995, -31984, -31972, -31960, -31949, -31937, -31926, -31916, -31906,
+            -31896, -31888, -31881, -31874, -31869, -31865, -31862, -31861, -31861, -31863,
+            -31866, -31870, -31876, -31883, -31892, -31902, -31913, -31926, -31939, -31954,
+            -31969, -31984, -32001, -32017, -32033, -32050, -32066, -32082, -32097, -32111,
+            -32124, -32136, -32146, -32155, -32163, -32168, -32171, -32173, -32172, -32168,
+            -32163, -32155, -32145, -32133, -32118, -32102, -32083, -32062, -32040, -32016,
+            -31991, -31965, -31938, -31911, -31883, -31856, -31829, -31802, -31777, -31754,
+            -31732, -31712, -31695, -31681, -31670, -31663, -31659, -31660, -31664, -31673,
+            -31687, -31705, -31728, -31756, -31789, -31826, -31867, -31913, -31962, -32015,
+            -32071, -32129, -32190, -32252, -32314, -32376, -32437, -32496, -32552, -32605,
+            -32652, -32692, -32725, -32750, -32764, -32767, -32757, -32733, -32693, -32636,
+            -32561, -32466, -32350, -32210, -32047, -31858, -31643, -31400, -31127, -30824,
+            -30490, -30123, -29724, -29290, -28821, -28318, -27778, -27202, -26590, -25941,
+            -25256, -24534, -23776, -22982, -22153, -21289, -20391, -19460, -18497, -17503,
+            -16479, -15428, -14349, -13246, -12119, -10971, -9803, -8617, -7415, -6200,
+            -4974, -3739, -2496, -1249, 0,
+        },
+        { // octave 5: 8 harmonics
+            0, 657, 1314, 1970, 2625, 3279, 3931, 4581, 5228, 5874,
+            6516, 7155, 7790, 8422, 9049, 9672, 10290, 10903, 11510, 12112,
+            12708, 13298, 13881, 14458, 15028, 15591, 16146, 16694, 17234, 17765,
+            18289, 18804, 19311, 19809, 20298, 20777, 21248, 21709, 22161, 22604,
+            23036, 23459, 23872, 24275, 24668, 25051, 25424, 25787, 26140, 26482,
+            26815, 27137, 27449, 27751, 28043, 28325, 28597, 28859, 29111, 29353,
+            29586, 29809, 30022, 30226, 30421, 30607, 30784, 30951, 31110, 31261,
+            31403, 31537, 31662, 31780, 31890, 31993, 32088, 32176, 32256, 32330,
+            32398, 32459, 32514, 32562, 32605, 32643, 32675, 32702, 32724, 32741,
+            32754, 32762, 32767, 32767, 32764, 32757, 32747, 32734, 32718, 32700,
+            32679, 32655, 32630, 32603, 32574, 32544, 32512, 32479, 32445, 32410,
+            32374, 32338, 32302, 32265, 32229, 32192, 32155, 32119, 32083, 32048,
+            32013, 31979, 31945, 31913, 31882, 31851, 31822, 31794, 31767, 31742,
+            31717, 31695, 31673, 31653, 31635, 31618, 31603, 31589, 31577, 31566,
+            31557, 31549, 31543, 31538, 31535, 31533, 31533, 31534, 31537, 31540,
+            31546, 31552, 31559, 31568, 31578, 31589, 31601, 31613, 31627, 31641,
+            31656, 31672, 31689, 31706, 31723, 31741, 31759, 31778, 31797, 31815,
+            31835, 31854, 31873, 31892, 31911, 31929, 31948, 31966, 31983, 32001,
+            32018, 32034, 32050, 32065, 32080, 32093, 32107, 32119, 32131, 32141,
+            32152, 32161, 32169, 32176, 32183, 32189, 32193, 32197, 32200, 32202,
+            32203, 32203, 32202, 32200, 32198, 32194, 32190, 32185, 32179, 32172,
+            32165, 32157, 32148, 32138, 32128, 32118, 32106, 32094, 32082, 32070,
+            32056, 32043, 32029, 32015, 32001, 31987, 31972, 31958, 31943, 31929,
+            31914, 31900, 31886, 31872, 31858, 31845, 31832, 31819, 31806, 31794,
+            31783, 31772, 31762, 31752, 31743, 31734, 31726, 31719, 31712, 31706,
+            31701, 31697, 31694, 31691, 31689, 31688, 31687, 31688, 31689, 31691,
+            31694, 31697, 31701, 31706, 31712, 31719, 31726, 31734, 31743, 31752,
+            31762, 31772, 31783, 31794, 31806, 31819, 31832, 31845, 31858, 31872,
+            31886, 31900, 31914, 31929, 31943, 31958, 31972, 31987, 32001, 32015,
+            32029, 32043, 32056, 32070, 32082, 32094, 32106, 32118, 32128, 32138,
+            32148, 32157, 32165, 32172, 32179, 32185, 32190, 32194, 32198, 32200,
+            32202, 32203, 32203, 32202, 32200, 32197, 32193, 32189, 32183, 32176,
+            32169, 32161, 32152, 32141, 32131, 32119, 32107, 32093, 32080, 32065,
+            32050, 32034, 32018, 32001, 31983, 31966, 31948, 31929, 31911, 31892,
+            31873, 31854, 31835, 31815, 31797, 31778, 31759, 31741, 31723, 31706,
+            31689, 31672, 31656, 31641, 31627, 31613, 31601, 31589, 31578, 31568,
+            31559, 31552, 31546, 31540, 31537, 31534, 31533, 31533, 31535, 31538,
+            31543, 31549, 31557, 31566, 31577, 31589, 31603, 31618, 31635, 31653,
+            31673, 31695, 31717, 31742, 31767, 31794, 31822, 31851, 31882, 31913,
+            31945, 31979, 32013, 32048, 32083, 32119, 32155, 32192, 32229, 32265,
+            32302, 32338, 32374, 32410, 32445, 32479, 32512, 32544, 32574, 32603,
+            32630, 32655, 32679, 32700, 32718, 32734, 32747, 32757, 32764, 32767,
+            32767, 32762, 32754, 32741, 32724, 32702, 32675, 32643, 32605, 32562,
+            32514, 32459, 32398, 32330, 32256, 32176, 32088, 31993, 31890, 31780,
+            31662, 31537, 31403, 31261, 31110, 30951, 30784, 30607, 30421, 30226,
+            30022, 29809, 29586, 29353, 29111, 28859, 28597, 28325, 28043, 27751,
+            27449, 27137, 26815, 26482, 26140, 25787, 25424, 25051, 24668, 24275,
+            23872, 23459, 23036, 22604, 22161, 21709, 21248, 20777, 20298, 19809,
+            19311, 18804, 18289, 17765, 17234, 16694, 16146, 15591, 15028, 14458,
+            13881, 13298, 12708, 12112, 11510, 10903, 10290, 9672, 9049, 8422,
+            7790, 7155, 6516, 5874, 5228, 4581, 3931, 3279, 2625, 1970,
+            1314, 657, 0, -657, -1314, -1970, -2625, -3279, -3931, -4581,
+            -5228, -5874, -6516, -7155, -7790, -8422, -9049, -9672, -10290, -10903,
+            -11510, -12112, -12708, -13298, -13881, -14458, -15028, -15591, -16146, -16694,
+            -17234, -17765, -18289, -18804, -19311, -19809, -20298, -20777, -21248, -21709,
+            -22161, -22604, -23036, -23459, -23872, -24275, -24668, -25051, -25424, -25787,
+            -26140, -26482, -26815, -27137, -27449, -27751, -28043, -28325, -28597, -28859,
+            -29111, -29353, -29586, -29809, -30022, -30226, -30421, -30607, -30784, -30951,
+            -31110, -31261, -31403, -31537, -31662, -31780, -31890, -31993, -32088, -32176,
+            -32256, -32330, -32398, -32459, -32514, -32562, -32605, -32643, -32675, -32702,
+            -32724, -32741, -32754, -32762, -32767, -32767, -32764, -32757, -32747, -32734,
+            -32718, -32700, -32679, -32655, -32630, -32603, -32574, -32544, -32512, -32479,
+            -32445, -32410, -32374, -32338, -32302, -32265, -32229, -32192, -32155, -32119,
+            -32083, -32048, -32013, -31979, -31945, -31913, -31882, -31851, -31822, -31794,
+            -31767, -31742, -31717, -31695, -31673, -31653, -31635, -31618, -31603, -31589,
+            -31577, -31566, -31557, -31549, -31543, -31538, -31535, -31533, -31533, -31534,
+            -31537, -31540, -31546, -31552, -31559, -31568, -31578, -31589, -31601, -31613,
+            -31627, -31641, -31656, -31672, -31689, -31706, -31723, -31741, -31759, -31778,
+            -31797, -31815, -31835, -31854, -31873, -31892, -31911, -31929, -31948, -31966,
+            -31983, -32001, -32018, -32034, -32050, -32065, -32080, -32093, -32107, -32119,
+            -32131, -32141, -32152, -32161, -32169, -32176, -32183, -32189, -32193, -32197,
+            -32200, -32202, -32203, -32203, -32202, -32200, -32198, -32194, -32190, -32185,
+            -32179, -32172, -32165, -32157, -32148, -32138, -32128, -32118, -32106, -32094,
+            -32082, -32070, -32056, -32043, -32029, -32015, -32001, -31987, -31972, -31958,
+            -31943, -31929, -31914, -31900, -31886, -31872, -31858, -31845, -31832, -31819,
+            -31806, -31794, -31783, -31772, -31762, -31752, -31743, -31734, -31726, -31719,
+            -31712, -31706, -31701, -31697, -31694, -31691, -31689, -31688, -31687, -31688,
+            -31689, -31691, -31694, -31697, -31701, -31706, -31712, -31719, -31726, -31734,
+            -31743, -31752, -31762, -31772, -31783, -31794, -31806, -31819, -31832, -31845,
+            -31858, -31872, -31886, -31900, -31914, -31929, -31943, -31958, -31972, -31987,
+            -32001, -32015, -32029, -32043, -32056, -32070, -32082, -32094, -32106, -32118,
+            -32128, -32138, -32148, -32157, -32165, -32172, -32179, -32185, -32190, -32194,
+            -32198, -32200, -32202, -32203, -32203, -32202, -32200, -32197, -32193, -32189,
+            -32183, -32176, -32169, -32161, -32152, -32141, -32131, -32119, -32107, -32093,
+            -32080, -32065, -32050, -32034, -32018, -32001, -31983, -31966, -31948, -31929,
+            -31911, -31892, -31873, -31854, -31835, -31815, -31797, -31778, -31759, -31741,
+            -31723, -31706, -31689, -31672, -31656, -31641, -31627, -31613, -31601, -31589,
+            -31578, -31568, -31559, -31552, -31546, -31540, -31537, -31534, -31533, -31533,
+            -31535, -31538, -31543, -31549, -31557, -31566, -31577, -31589, -31603, -31618,
+            -31635, -31653, -31673, -31695, -31717, -31742, -31767, -31794, -31822, -31851,
+            -31882, -31913, -31945, -31979, -32013, -32048, -32083, -32119, -32155, -32192,
+            -32229, -32265, -32302, -32338, -32374, -32410, -32445, -32479, -32512, -32544,
+            -32574, -32603, -32630, -32655, -32679, -32700, -32718, -32734, -32747, -32757,
+            -32764, -32767, -32767, -32762, -32754, -32741, -32724, -32702, -32675, -32643,
+            -32605, -32562, -32514, -32459, -32398, -32330, -32256, -32176, -32088, -31993,
+            -31890, -31780, -31662, -31537, -31403, -31261, -31110, -30951, -30784, -30607,
+            -30421, -30226, -30022, -29809, -29586, -29353, -29111, -28859, -28597, -28325,
+            -28043, -27751, -27449, -27137, -26815, -26482, -26140, -25787, -25424, -25051,
+            -24668, -24275, -23872, -23459, -23036, -22604, -22161, -21709, -21248, -20777,
+            -20298, -19809, -19311, -18804, -18289, -17765, -17234, -16694, -16146, -15591,
+            -15028, -14458, -13881, -13298, -12708, -12112, -11510, -10903, -10290, -9672,
+            -9049, -8422, -7790, -7155, -6516, -5874, -5228, -4581, -3931, -3279,
+            -2625, -1970, -1314, -657, 0,
+        },
+        { // octave 6: 4 harmonics
+            0, 357, 714, 1071, 1428, 1784, 2140, 2496, 2852, 3207,
+            3562, 3916, 4270, 4623, 4975, 5327, 5678, 6028, 6377, 6725,
+            7073, 7419, 7765, 8109, 8452, 8794, 9134, 9474, 9812, 10149,
+            10484, 10818, 11150, 11481, 11810, 12137, 12463, 12787, 13109, 13430,
+            13748, 14065, 14380, 14693, 15003, 15312, 15619, 15923, 16226, 16526,
+            16824, 17120, 17413, 17704, 17993, 18279, 18563, 18845, 19124, 19400,
+            19674, 19945, 20214, 20480, 20744, 21004, 21263, 21518, 21771, 22021,
+            22268, 22512, 22753, 22992, 23228, 23461, 23691, 23918, 24142, 24363,
+            24582, 24797, 25009, 25219, 25425, 25628, 25829, 26026, 26220, 26412,
+            26600, 26785, 26967, 27146, 27322, 27495, 27665, 27832, 27996, 28157,
+            28315, 28470, 28621, 28770, 28916, 29058, 29198, 29335, 29468, 29599,
+            29727, 29851, 29973, 30092, 30208, 30321, 30431, 30538, 30643, 30744,
+            30843, 30939, 31032, 31122, 31210, 31295, 31377, 31457, 31534, 31608,
+            31679, 31749, 31815, 31879, 31940, 31999, 32056, 32110, 32162, 32211,
+            32258, 32303, 32345, 32385, 32423, 32459, 32492, 32524, 32553, 32580,
+            32606, 32629, 32650, 32670, 32687, 32703, 32717, 32729, 32739, 32748,
+            32755, 32760, 32764, 32766, 32767, 32766, 32764, 32760, 32755, 32749,
+            32741, 32732, 32722, 32711, 32698, 32685, 32670, 32655, 32638, 32620,
+            32602, 32582, 32562, 32541, 32519, 32497, 32473, 32450, 32425, 32400,
+            32374, 32348, 32322, 32295, 32267, 32239, 32211, 32183, 32154, 32125,
+            32096, 32067, 32038, 32008, 31979, 31949, 31920, 31890, 31861, 31832,
+            31802, 31773, 31744, 31716, 31687, 31659, 31632, 31604, 31577, 31550,
+            31524, 31498, 31472, 31447, 31423, 31399, 31375, 31353, 31330, 31309,
+            31288, 31267, 31247, 31228, 31210, 31192, 31175, 31159, 31143, 31129,
+            31115, 31101, 31089, 31077, 31067, 31057, 31048, 31039, 31032, 31025,
+            31020, 31015, 31011, 31008, 31006, 31004, 31004, 31004, 31006, 31008,
+            31011, 31015, 31020, 31025, 31032, 31039, 31048, 31057, 31067, 31077,
+            31089, 31101, 31115, 31129, 31143, 31159, 31175, 31192, 31210, 31228,
+            31247, 31267, 31288, 31309, 31330, 31353, 31375, 31399, 31423, 31447,
+            31472, 31498, 31524, 31550, 31577, 31604, 31632, 31659, 31687, 31716,
+            31744, 31773, 31802, 31832, 31861, 31890, 31920, 31949, 31979, 32008,
+            32038, 32067, 32096, 32125, 32154, 32183, 32211, 32239, 32267, 32295,
+            32322, 32348, 32374, 32400, 32425, 32450, 32473, 32497, 32519, 32541,
+            32562, 32582, 32602, 32620, 32638, 32655, 32670, 32685, 32698, 32711,
+            32722, 32732, 32741, 32749, 32755, 32760, 32764, 32766, 32767, 32766,
+            32764, 32760, 32755, 32748, 32739, 32729, 32717, 32703, 32687, 32670,
+            32650, 32629, 32606, 32580, 32553, 32524, 32492, 32459, 32423, 32385,
+            32345, 32303, 32258, 32211, 32162, 32110, 32056, 31999, 31940, 31879,
+            31815, 31749, 31679, 31608, 31534, 31457, 31377, 31295, 31210, 31122,
+            31032, 30939, 30843, 30744, 30643, 30538, 30431, 30321, 30208, 30092,
+            29973, 29851, 29727, 29599, 29468, 29335, 29198, 29058, 28916, 28770,
+            28621, 28470, 28315, 28157, 27996, 27832, 27665, 27495, 27322, 27146,
+            26967, 26785, 26600, 26412, 26220, 26026, 25829, 25628, 25425, 25219,
+            25009, 24797, 24582, 24363, 24142, 23918, 23691, 23461, 23228, 22992,
+            22753, 22512, 22268, 22021, 21771, 21518, 21263, 21004, 20744, 20480,
+            20214, 19945, 19674, 19400, 19124, 18845, 18563, 18279, 17993, 17704,
+            17413, 17120, 16824, 16526, 16226, 15923, 15619, 15312, 15003, 14693,
+            14380, 14065, 13748, 13430, 13109, 12787, 12463, 12137, 11810, 11481,
+            11150, 10818, 10484, 10149, 9812, 9474, 9134, 8794, 8452, 8109,
+            7765, 7419, 7073, 6725, 6377, 6028, 5678, 5327, 4975, 4623,
+            4270, 3916, 3562, 3207, 2852, 2496, 2140, 1784, 1428, 1071,
+            714, 357, 0, -357, -714, -1071, -1428, -1784, -2140, -2496,
+            -2852, -3207, -3562, -3916, -4270, -4623, -4975, -5327, -5678, -6028,
+            -6377, -6725, -7073, -7419, -7765, -8109, -8452, -8794, -9134, -9474,
+            -9812, -10149, -10484, -10818, -11150, -11481, -11810, -12137, -12463, -12787,
+            -13109, -13430, -13748, -14065, -14380, -14693, -15003, -15312, -15619, -15923,
+            -16226, -16526, -16824, -17120, -17413, -17704, -17993, -18279, -18563, -18845,
+            -19124, -19400, -19674, -19945, -20214, -20480, -20744, -21004, -21263, -21518,
+            -21771, -22021, -22268, -22512, -22753, -22992, -23228, -23461, -23691, -23918,
+            -24142, -24363, -24582, -24797, -25009, -25219, -25425, -25628, -25829, -26026,
+            -26220, -26412, -26600, -26785, -26967, -27146, -27322, -27495, -27665, -27832,
+            -27996, -28157, -28315, -28470, -28621, -28770, -28916, -29058, -29198, -29335,
+            -29468, -29599, -29727, -29851, -29973, -30092, -30208, -30321, -30431, -30538,
+            -30643, -30744, -30843, -30939, -31032, -31122, -31210, -31295, -31377, -31457,
+            -31534, -31608, -31679, -31749, -31815, -31879, -31940, -31999, -32056, -32110,
+            -32162, -32211, -32258, -32303, -32345, -32385, -32423, -32459, -32492, -32524,
+            -32553, -32580, -32606, -32629, -32650, -32670, -32687, -32703, -32717, -32729,
+            -32739, -32748, -32755, -32760, -32764, -32766, -32767, -32766, -32764, -32760,
+            -32755, -32749, -32741, -32732, -32722, -32711, -32698, -32685, -32670, -32655,
+            -32638, -32620, -32602, -32582, -32562, -32541, -32519, -32497, -32473, -32450,
+            -32425, -32400, -32374, -32348, -32322, -32295, -32267, -32239, -32211, -32183,
+            -32154, -32125, -32096, -32067, -32038, -32008, -31979, -31949, -31920, -31890,
+            -31861, -31832, -31802, -31773, -31744, -31716, -31687, -31659, -31632, -31604,
+            -31577, -31550, -31524, -31498, -31472, -31447, -31423, -31399, -31375, -31353,
+            -31330, -31309, -31288, -31267, -31247, -31228, -31210, -31192, -31175, -31159,
+            -31143, -31129, -31115, -31101, -31089, -31077, -31067, -31057, -31048, -31039,
+            -31032, -31025, -31020, -31015, -31011, -31008, -31006, -31004, -31004, -31004,
+            -31006, -31008, -31011, -31015, -31020, -31025, -31032, -31039, -31048, -31057,
+            -31067, -31077, -31089, -31101, -31115, -31129, -31143, -31159, -31175, -31192,
+            -31210, -31228, -31247, -31267, -31288, -31309, -31330, -31353, -31375, -31399,
+            -31423, -31447, -31472, -31498, -31524, -31550, -31577, -31604, -31632, -31659,
+            -31687, -31716, -31744, -31773, -31802, -31832, -31861, -31890, -31920, -31949,
+            -31979, -32008, -32038, -32067, -32096, -32125, -32154, -32183, -32211, -32239,
+            -32267, -32295, -32322, -32348, -32374, -32400, -32425, -32450, -32473, -32497,
+            -32519, -32541, -32562, -32582, -32602, -32620, -32638, -32655, -32670, -32685,
+            -32698, -32711, -32722, -32732, -32741, -32749, -32755, -32760, -32764, -32766,
+            -32767, -32766, -32764, -32760, -32755, -32748, -32739, -32729, -32717, -32703,
+            -32687, -32670, -32650, -32629, -32606, -32580, -32553, -32524, -32492, -32459,
+            -32423, -32385, -32345, -32303, -32258, -32211, -32162, -32110, -32056, -31999,
+            -31940, -31879, -31815, -31749, -31679, -31608, -31534, -31457, -31377, -31295,
+            -31210, -31122, -31032, -30939, -30843, -30744, -30643, -30538, -30431, -30321,
+            -30208, -30092, -29973, -29851, -29727, -29599, -29468, -29335, -29198, -29058,
+            -28916, -28770, -28621, -28470, -28315, -28157, -27996, -27832, -27665, -27495,
+            -27322, -27146, -26967, -26785, -26600, -26412, -26220, -26026, -25829, -25628,
+            -25425, -25219, -25009, -24797, -24582, -24363, -24142, -23918, -23691, -23461,
+            -23228, -22992, -22753, -22512, -22268, -22021, -21771, -21518, -21263, -21004,
+            -20744, -20480, -20214, -19945, -19674, -19400, -19124, -18845, -18563, -18279,
+            -17993, -17704, -17413, -17120, -16824, -16526, -16226, -15923, -15619, -15312,
+            -15003, -14693, -14380, -14065, -13748, -13430, -13109, -12787, -12463, -12137,
+            -11810, -11481, -11150, -10818, -10484, -10149, -9812, -9474, -9134, -8794,
+            -8452, -8109, -7765, -7419, -7073, -6725, -6377, -6028, -5678, -5327,
+            -4975, -4623, -4270, -3916, -3562, -3207, -2852, -2496, -2140, -1784,
+            -1428, -1071, -714, -357, 0,
+        },
+        { // octave 7: 2 harmonics
+            0, 201, 402, 603, 804, 1005, 1206, 1407, 1608, 1809,
+            2009, 2210, 2410, 2611, 2811, 3012, 3212, 3412, 3612, 3811,
+            4011, 4210, 4410, 4609, 4808, 5007, 5205, 5404, 5602, 5800,
+            5998, 6195, 6393, 6590, 6786, 6983, 7179, 7375, 7571, 7767,
+            7962, 8157, 8351, 8545, 8739, 8933, 9126, 9319, 9512, 9704,
+            9896, 10087, 10278, 10469, 10659, 10849, 11039, 11228, 11417, 11605,
+            11793, 11980, 12167, 12353, 12539, 12725, 12910, 13094, 13279, 13462,
+            13645, 13828, 14010, 14191, 14372, 14553, 14732, 14912, 15090, 15269,
+            15446, 15623, 15800, 15976, 16151, 16325, 16499, 16673, 16846, 17018,
+            17189, 17360, 17530, 17700, 17869, 18037, 18204, 18371, 18537, 18703,
+            18868, 19032, 19195, 19357, 19519, 19680, 19841, 20000, 20159, 20317,
+            20475, 20631, 20787, 20942, 21096, 21250, 21403, 21554, 21705, 21856,
+            22005, 22154, 22301, 22448, 22594, 22739, 22884, 23027, 23170, 23311,
+            23452, 23592, 23731, 23870, 24007, 24143, 24279, 24413, 24547, 24680,
+            24811, 24942, 25072, 25201, 25329, 25456, 25582, 25708, 25832, 25955,
+            26077, 26198, 26319, 26438, 26556, 26674, 26790, 26905, 27019, 27133,
+            27245, 27356, 27466, 27575, 27683, 27790, 27896, 28001, 28105, 28208,
+            28310, 28411, 28510, 28609, 28706, 28803, 28898, 28992, 29085, 29177,
+            29268, 29358, 29447, 29534, 29621, 29706, 29791, 29874, 29956, 30037,
+            30117, 30195, 30273, 30349, 30424, 30498, 30571, 30643, 30714, 30783,
+            30852, 30919, 30985, 31050, 31113, 31176, 31237, 31297, 31356, 31414,
+            31470, 31526, 31580, 31633, 31685, 31736, 31785, 31833, 31880, 31926,
+            31971, 32014, 32057, 32098, 32137, 32176, 32213, 32250, 32285, 32318,
+            32351, 32382, 32412, 32441, 32469, 32495, 32521, 32545, 32567, 32589,
+            32609, 32628, 32646, 32663, 32678, 32692, 32705, 32717, 32728, 32737,
+            32745, 32752, 32757, 32761, 32765, 32766, 32767, 32766, 32765, 32761,
+            32757, 32752, 32745, 32737, 32728, 32717, 32705, 32692, 32678, 32663,
+            32646, 32628, 32609, 32589, 32567, 32545, 32521, 32495, 32469, 32441,
+            32412, 32382, 32351, 32318, 32285, 32250, 32213, 32176, 32137, 32098,
+            32057, 32014, 31971, 31926, 31880, 31833, 31785, 31736, 31685, 31633,
+            31580, 31526, 31470, 31414, 31356, 31297, 31237, 31176, 31113, 31050,
+            30985, 30919, 30852, 30783, 30714, 30643, 30571, 30498, 30424, 30349,
+            30273, 30195, 30117, 30037, 29956, 29874, 29791, 29706, 29621, 29534,
+            29447, 29358, 29268, 29177, 29085, 28992, 28898, 28803, 28706, 28609,
+            28510, 28411, 28310, 28208, 28105, 28001, 27896, 27790, 27683, 27575,
+            27466, 27356, 27245, 27133, 27019, 26905, 26790, 26674, 26556, 26438,
+            26319, 26198, 26077, 25955, 25832, 25708, 25582, 25456, 25329, 25201,
+            25072, 24942, 24811, 24680, 24547, 24413, 24279, 24143, 24007, 23870,
+            23731, 23592, 23452, 23311, 23170, 23027, 22884, 22739, 22594, 22448,
+            22301, 22154, 22005, 21856, 21705, 21554, 21403, 21250, 21096, 20942,
+            20787, 20631, 20475, 20317, 20159, 20000, 19841, 19680, 19519, 19357,
+            19195, 19032, 18868, 18703, 18537, 18371, 18204, 18037, 17869, 17700,
+            17530, 17360, 17189, 17018, 16846, 16673, 16499, 16325, 16151, 15976,
+            15800, 15623, 15446, 15269, 15090, 14912, 14732, 14553, 14372, 14191,
+            14010, 13828, 13645, 13462, 13279, 13094, 12910, 12725, 12539, 12353,
+            12167, 11980, 11793, 11605, 11417, 11228, 11039, 10849, 10659, 10469,
+            10278, 10087, 9896, 9704, 9512, 9319, 9126, 8933, 8739, 8545,
+            8351, 8157, 7962, 7767, 7571, 7375, 7179, 6983, 6786, 6590,
+            6393, 6195, 5998, 5800, 5602, 5404, 5205, 5007, 4808, 4609,
+            4410, 4210, 4011, 3811, 3612, 3412, 3212, 3012, 2811, 2611,
+            2410, 2210, 2009, 1809, 1608, 1407, 1206, 1005, 804, 603,
+            402, 201, 0, -201, -402, -603, -804, -1005, -1206, -1407,
+            -1608, -1809, -2009, -2210, -2410, -2611, -2811, -3012, -3212, -3412,
+            -3612, -3811, -4011, -4210, -4410, -4609, -4808, -5007, -5205, -5404,
+            -5602, -5800, -5998, -6195, -6393, -6590, -6786, -6983, -7179, -7375,
+            -7571, -7767, -7962, -8157, -8351, -8545, -8739, -8933, -9126, -9319,
+            -9512, -9704, -9896, -10087, -10278, -10469, -10659, -10849, -11039, -11228,
+            -11417, -11605, -11793, -11980, -12167, -12353, -12539, -12725, -12910, -13094,
+            -13279, -13462, -13645, -13828, -14010, -14191, -14372, -14553, -14732, -14912,
+            -15090, -15269, -15446, -15623, -15800, -15976, -16151, -16325, -16499, -16673,
+            -16846, -17018, -17189, -17360, -17530, -17700, -17869, -18037, -18204, -18371,
+            -18537, -18703, -18868, -19032, -19195, -19357, -19519, -19680, -19841, -20000,
+            -20159, -20317, -20475, -20631, -20787, -20942, -21096, -21250, -21403, -21554,
+            -21705, -21856, -22005, -22154, -22301, -22448, -22594, -22739, -22884, -23027,
+            -23170, -23311, -23452, -23592, -23731, -23870, -24007, -24143, -24279, -24413,
+            -24547, -24680, -24811, -24942, -25072, -25201, -25329, -25456, -25582, -25708,
+            -25832, -25955, -26077, -26198, -26319, -26438, -26556, -26674, -26790, -26905,
+            -27019, -27133, -27245, -27356, -27466, -27575, -27683, -27790, -27896, -28001,
+            -28105, -28208, -28310, -28411, -28510, -28609, -28706, -28803, -28898, -28992,
+            -29085, -29177, -29268, -29358, -29447, -29534, -29621, -29706, -29791, -29874,
+            -29956, -30037, -30117, -30195, -30273, -30349, -30424, -30498, -30571, -30643,
+            -30714, -30783, -30852, -30919, -30985, -31050, -31113, -31176, -31237, -31297,
+            -31356, -31414, -31470, -31526, -31580, -31633, -31685, -31736, -31785, -31833,
+            -31880, -31926, -31971, -32014, -32057, -32098, -32137, -32176, -32213, -32250,
+            -32285, -32318, -32351, -32382, -32412, -32441, -32469, -32495, -32521, -32545,
+            -32567, -32589, -32609, -32628, -32646, -32663, -32678, -32692, -32705, -32717,
+            -32728, -32737, -32745, -32752, -32757, -32761, -32765, -32766, -32767, -32766,
+            -32765, -32761, -32757, -32752, -32745, -32737, -32728, -32717, -32705, -32692,
+            -32678, -32663, -32646, -32628, -32609, -32589, -32567, -32545, -32521, -32495,
+            -32469, -32441, -32412, -32382, -32351, -32318, -32285, -32250, -32213, -32176,
+            -32137, -32098, -32057, -32014, -31971, -31926, -31880, -31833, -31785, -31736,
+            -31685, -31633, -31580, -31526, -31470, -31414, -31356, -31297, -31237, -31176,
+            -31113, -31050, -30985, -30919, -30852, -30783, -30714, -30643, -30571, -30498,
+            -30424, -30349, -30273, -30195, -30117, -30037, -29956, -29874, -29791, -29706,
+            -29621, -29534, -29447, -29358, -29268, -29177, -29085, -28992, -28898, -28803,
+            -28706, -28609, -28510, -28411, -28310, -28208, -28105, -28001, -27896, -27790,
+            -27683, -27575, -27466, -27356, -27245, -27133, -27019, -26905, -26790, -26674,
+            -26556, -26438, -26319, -26198, -26077, -25955, -25832, -25708, -25582, -25456,
+            -25329, -25201, -25072, -24942, -24811, -24680, -24547, -24413, -24279, -24143,
+            -24007, -23870, -23731, -23592, -23452, -23311, -23170, -23027, -22884, -22739,
+            -22594, -22448, -22301, -22154, -22005, -21856, -21705, -21554, -21403, -21250,
+            -21096, -20942, -20787, -20631, -20475, -20317, -20159, -20000, -19841, -19680,
+            -19519, -19357, -19195, -19032, -18868, -18703, -18537, -18371, -18204, -18037,
+            -17869, -17700, -17530, -17360, -17189, -17018, -16846, -16673, -16499, -16325,
+            -16151, -15976, -15800, -15623, -15446, -15269, -15090, -14912, -14732, -14553,
+            -14372, -14191, -14010, -13828, -13645, -13462, -13279, -13094, -12910, -12725,
+            -12539, -12353, -12167, -11980, -11793, -11605, -11417, -11228, -11039, -10849,
+            -10659, -10469, -10278, -10087, -9896, -9704, -9512, -9319, -9126, -8933,
+            -8739, -8545, -8351, -8157, -7962, -7767, -7571, -7375, -7179, -6983,
+            -6786, -6590, -6393, -6195, -5998, -5800, -5602, -5404, -5205, -5007,
+            -4808, -4609, -4410, -4210, -4011, -3811, -3612, -3412, -3212, -3012,
+            -2811, -2611, -2410, -2210, -2009, -1809, -1608, -1407, -1206, -1005,
+            -804, -603, -402, -201, 0,
+        },
+        { // octave 8: 1 harmonics
+            0, 201, 402, 603, 804, 1005, 1206, 1407, 1608, 1809,
+            2009, 2210, 2410, 2611, 2811, 3012, 3212, 3412, 3612, 3811,
+            4011, 4210, 4410, 4609, 4808, 5007, 5205, 5404, 5602, 5800,
+            5998, 6195, 6393, 6590, 6786, 6983, 7179, 7375, 7571, 7767,
+            7962, 8157, 8351, 8545, 8739, 8933, 9126, 9319, 9512, 9704,
+            9896, 10087, 10278, 10469, 10659, 10849, 11039, 11228, 11417, 11605,
+            11793, 11980, 12167, 12353, 12539, 12725, 12910, 13094, 13279, 13462,
+            13645, 13828, 14010, 14191, 14372, 14553, 14732, 14912, 15090, 15269,
+            15446, 15623, 15800, 15976, 16151, 16325, 16499, 16673, 16846, 17018,
+            17189, 17360, 17530, 17700, 17869, 18037, 18204, 18371, 18537, 18703,
+            18868, 19032, 19195, 19357, 19519, 19680, 19841, 20000, 20159, 20317,
+            20475, 20631, 20787, 20942, 21096, 21250, 21403, 21554, 21705, 21856,
+            22005, 22154, 22301, 22448, 22594, 22739, 22884, 23027, 23170, 23311,
+            23452, 23592, 23731, 23870, 24007, 24143, 24279, 24413, 24547, 24680,
+            24811, 24942, 25072, 25201, 25329, 25456, 25582, 25708, 25832, 25955,
+            26077, 26198, 26319, 26438, 26556, 26674, 26790, 26905, 27019, 27133,
+            27245, 27356, 27466, 27575, 27683, 27790, 27896, 28001, 28105, 28208,
+            28310, 28411, 28510, 28609, 28706, 28803, 28898, 28992, 29085, 29177,
+            29268, 29358, 29447, 29534, 29621, 29706, 29791, 29874, 29956, 30037,
+            30117, 30195, 30273, 30349, 30424, 30498, 30571, 30643, 30714, 30783,
+            30852, 30919, 30985, 31050, 31113, 31176, 31237, 31297, 31356, 31414,
+            31470, 31526, 31580, 31633, 31685, 31736, 31785, 31833, 31880, 31926,
+            31971, 32014, 32057, 32098, 32137, 32176, 32213, 32250, 32285, 32318,
+            32351, 32382, 32412, 32441, 32469, 32495, 32521, 32545, 32567, 32589,
+            32609, 32628, 32646, 32663, 32678, 32692, 32705, 32717, 32728, 32737,
+            32745, 32752, 32757, 32761, 32765, 32766, 32767, 32766, 32765, 32761,
+            32757, 32752, 32745, 32737, 32728, 32717, 32705, 32692, 32678, 32663,
+            32646, 32628, 32609, 32589, 32567, 32545, 32521, 32495, 32469, 32441,
+            32412, 32382, 32351, 32318, 32285, 32250, 32213, 32176, 32137, 32098,
+            32057, 32014, 31971, 31926, 31880, 31833, 31785, 31736, 31685, 31633,
+            31580, 31526, 31470, 31414, 31356, 31297, 31237, 31176, 31113, 31050,
+            30985, 30919, 30852, 30783, 30714, 30643, 30571, 30498, 30424, 30349,
+            30273, 30195, 30117, 30037, 29956, 29874, 29791, 29706, 29621, 29534,
+            29447, 29358, 29268, 29177, 29085, 28992, 28898, 28803, 28706, 28609,
+            28510, 28411, 28310, 28208, 28105, 28001, 27896, 27790, 27683, 27575,
+            27466, 27356, 27245, 27133, 27019, 26905, 26790, 26674, 26556, 26438,
+            26319, 26198, 26077, 25955, 25832, 25708, 25582, 25456, 25329, 25201,
+            25072, 24942, 24811, 24680, 24547, 24413, 24279, 24143, 24007, 23870,
+            23731, 23592, 23452, 23311, 23170, 23027, 22884, 22739, 22594, 22448,
+            22301, 22154, 22005, 21856, 21705, 21554, 21403, 21250, 21096, 20942,
+            20787, 20631, 20475, 20317, 20159, 20000, 19841, 19680, 19519, 19357,
+            19195, 19032, 18868, 18703, 18537, 18371, 18204, 18037, 17869, 17700,
+            17530, 17360, 17189, 17018, 16846, 16673, 16499, 16325, 16151, 15976,
+            15800, 15623, 15446, 15269, 15090, 14912, 14732, 14553, 14372, 14191,
+            14010, 13828, 13645, 13462, 13279, 13094, 12910, 12725, 12539, 12353,
+            12167, 11980, 11793, 11605, 11417, 11228, 11039, 10849, 10659, 10469,
+            10278, 10087, 9896, 9704, 9512, 9319, 9126, 8933, 8739, 8545,
+            8351, 8157, 7962, 7767, 7571, 7375, 7179, 6983, 6786, 6590,
+            6393, 6195, 5998, 5800, 5602, 5404, 5205, 5007, 4808, 4609,
+            4410, 4210, 4011, 3811, 3612, 3412, 3212, 3012, 2811, 2611,
+            2410, 2210, 2009, 1809, 1608, 1407, 1206, 1005, 804, 603,
+            402, 201, 0, -201, -402, -603, -804, -1005, -1206, -1407,
+            -1608, -1809, -2009, -2210, -2410, -2611, -2811, -3012, -3212, -3412,
+            -3612, -3811, -4011, -4210, -4410, -4609, -4808, -5007, -5205, -5404,
+            -5602, -5800, -5998, -6195, -6393, -6590, -6786, -6983, -7179, -7375,
+            -7571, -7767, -7962, -8157, -8351, -8545, -8739, -8933, -9126, -9319,
+            -9512, -9704, -9896, -10087, -10278, -10469, -10659, -10849, -11039, -11228,
+            -11417, -11605, -11793, -11980, -12167, -12353, -12539, -12725, -12910, -13094,
+            -13279, -13462, -13645, -13828, -14010, -14191, -14372, -14553, -14732, -14912,
+            -15090, -15269, -15446, -15623, -15800, -15976, -16151, -16325, -16499, -16673,
+            -16846, -17018, -17189, -17360, -17530, -17700, -17869, -18037, -18204, -18371,
+            -18537, -18703, -18868, -19032, -19195, -19357, -19519, -19680, -19841, -20000,
+            -20159, -20317, -20475, -20631, -20787, -20942, -21096, -21250, -21403, -21554,
+            -21705, -21856, -22005, -22154, -22301, -22448, -22594, -22739, -22884, -23027,
+            -23170, -23311, -23452, -23592, -23731, -23870, -24007, -24143, -24279, -24413,
+            -24547, -24680, -24811, -24942, -25072, -25201, -25329, -25456, -25582, -25708,
+            -25832, -25955, -26077, -26198, -26319, -26438, -26556, -26674, -26790, -26905,
+            -27019, -27133, -27245, -27356, -27466, -27575, -27683, -27790, -27896, -28001,
+            -28105, -28208, -28310, -28411, -28510, -28609, -28706, -28803, -28898, -28992,
+            -29085, -29177, -29268, -29358, -29447, -29534, -29621, -29706, -29791, -29874,
+            -29956, -30037, -30117, -30195, -30273, -30349, -30424, -30498, -30571, -30643,
+            -30714, -30783, -30852, -30919, -30985, -31050, -31113, -31176, -31237, -31297,
+            -31356, -31414, -31470, -31526, -31580, -31633, -31685, -31736, -31785, -31833,
+            -31880, -31926, -31971, -32014, -32057, -32098, -32137, -32176, -32213, -32250,
+            -32285, -32318, -32351, -32382, -32412, -32441, -32469, -32495, -32521, -32545,
+            -32567, -32589, -32609, -32628, -32646, -32663, -32678, -32692, -32705, -32717,
+            -32728, -32737, -32745, -32752, -32757, -32761, -32765, -32766, -32767, -32766,
+            -32765, -32761, -32757, -32752, -32745, -32737, -32728, -32717, -32705, -32692,
+            -32678, -32663, -32646, -32628, -32609, -32589, -32567, -32545, -32521, -32495,
+            -32469, -32441, -32412, -32382, -32351, -32318, -32285, -32250, -32213, -32176,
+            -32137, -32098, -32057, -32014, -31971, -31926, -31880, -31833, -31785, -31736,
+            -31685, -31633, -31580, -31526, -31470, -31414, -31356, -31297, -31237, -31176,
+            -31113, -31050, -30985, -30919, -30852, -30783, -30714, -30643, -30571, -30498,
+            -30424, -30349, -30273, -30195, -30117, -30037, -29956, -29874, -29791, -29706,
+            -29621, -29534, -29447, -29358, -29268, -29177, -29085, -28992, -28898, -28803,
+            -28706, -28609, -28510, -28411, -28310, -28208, -28105, -28001, -27896, -27790,
+            -27683, -27575, -27466, -27356, -27245, -27133, -27019, -26905, -26790, -26674,
+            -26556, -26438, -26319, -26198, -26077, -25955, -25832, -25708, -25582, -25456,
+            -25329, -25201, -25072, -24942, -24811, -24680, -24547, -24413, -24279, -24143,
+            -24007, -23870, -23731, -23592, -23452, -23311, -23170, -23027, -22884, -22739,
+            -22594, -22448, -22301, -22154, -22005, -21856, -21705, -21554, -21403, -21250,
+            -21096, -20942, -20787, -20631, -20475, -20317, -20159, -20000, -19841, -19680,
+            -19519, -19357, -19195, -19032, -18868, -18703, -18537, -18371, -18204, -18037,
+            -17869, -17700, -17530, -17360, -17189, -17018, -16846, -16673, -16499, -16325,
+            -16151, -15976, -15800, -15623, -15446, -15269, -15090, -14912, -14732, -14553,
+            -14372, -14191, -14010, -13828, -13645, -13462, -13279, -13094, -12910, -12725,
+            -12539, -12353, -12167, -11980, -11793, -11605, -11417, -11228, -11039, -10849,
+            -10659, -10469, -10278, -10087, -9896, -9704, -9512, -9319, -9126, -8933,
+            -8739, -8545, -8351, -8157, -7962, -7767, -7571, -7375, -7179, -6983,
+            -6786, -6590, -6393, -6195, -5998, -5800, -5602, -5404, -5205, -5007,
+            -4808, -4609, -4410, -4210, -4011, -3811, -3612, -3412, -3212, -3012,
+            -2811, -2611, -2410, -2210, -2009, -1809, -1608, -1407, -1206, -1005,
+            -804, -603, -402, -201, 0,
+        },
+    },
+    { // triangle
+        { // octave 0: 256 harmonics
+            32767, 32730, 32634, 32508, 32377, 32249, 32122, 31993, 31864, 31736,
+            31607, 31479, 31350, 31222, 31093, 30965, 30836, 30708, 30579, 30451,
+            30322, 30194, 30065, 29937, 29808, 29680, 29551, 29423, 29294, 29166,
+            29037, 28909, 28780, 28652, 28524, 28395, 28267, 28138, 28010, 27881,
+            27753, 27624, 27496, 27367, 27239, 27110, 26982, 26853, 26725, 26596,
+            26468, 26339, 26211, 26082, 25954, 25825, 25697, 25568, 25440, 25311,
+            25183, 25054, 24926, 24797, 24669, 24540, 24412, 24284, 24155, 24027,
+            23898, 23770, 23641, 23513, 23384, 23256, 23127, 22999, 22870, 22742,
+            22613, 22485, 22356, 22228, 22099, 21971, 21842, 21714, 21585, 21457,
+            21328, 21200, 21071, 20943, 20814, 20686, 20557, 20429, 20301, 20172,
+            20044, 19915, 19787, 19658, 19530, 19401, 19273, 19144, 19016, 18887,
+            18759, 18630, 18502, 18373, 18245, 18116, 17988, 17859, 17731, 17602,
+            17474, 17345, 17217, 17088, 16960, 16831, 16703, 16574, 16446, 16317,
+            16189, 16061, 15932, 15804, 15675, 15547, 15418, 15290, 15161, 15033,
+            14904, 14776, 14647, 14519, 14390, 14262, 14133, 14005, 13876, 13748,
+            13619, 13491, 13362, 13234, 13105, 12977, 12848, 12720, 12591, 12463,
+            12334, 12206, 12078, 11949, 11821, 11692, 11564, 11435, 11307, 11178,
+            11050, 10921, 10793, 10664, 10536, 10407, 10279, 10150, 10022, 9893,
+            9765, 9636, 9508, 9379, 9251, 9122, 8994, 8865, 8737, 8608,
+            8480, 8351, 8223, 8095, 7966, 7838, 7709, 7581, 7452, 7324,
+            7195, 7067, 6938, 6810, 6681, 6553, 6424, 6296, 6167, 6039,
+            5910, 5782, 5653, 5525, 5396, 5268, 5139, 5011, 4882, 4754,
+            4625, 4497, 4368, 4240, 4111, 3983, 3855, 3726, 3598, 3469,
+            3341, 3212, 3084, 2955, 2827, 2698, 2570, 2441, 2313, 2184,
+            2056, 1927, 1799, 1670, 1542, 1413, 1285, 1156, 1028, 899,
+            771, 642, 514, 385, 257, 128, 0, -128, -257, -385,
+            -514, -642, -771, -899, -1028, -1156, -1285, -1413, -1542, -1670,
+            -1799, -1927, -2056, -2184, -2313, -2441, -2570, -2698, -2827, -2955,
+            -3084, -3212, -3341, -3469, -3598, -3726, -3855, -3983, -4111, -4240,
+            -4368, -4497, -4625, -4754, -4882, -5011, -5139, -5268, -5396, -5525,
+            -5653, -5782, -5910, -6039, -6167, -6296, -6424, -6553, -6681, -6810,
+            -6938, -7067, -7195, -7324, -7452, -7581, -7709, -7838, -7966, -8095,
+            -8223, -8351, -8480, -8608, -8737, -8865, -8994, -9122, -9251, -9379,
+            -9508, -9636, -9765, -9893, -10022, -10150, -10279, -10407, -10536, -10664,
+            -10793, -10921, -11050, -11178, -11307, -11435, -11564, -11692, -11821, -11949,
+            -12078, -12206, -12334, -12463, -12591, -12720, -12848, -12977, -13105, -13234,
+            -13362, -13491, -13619, -13748, -13876, -14005, -14133, -14262, -14390, -14519,
+            -14647, -14776, -14904, -15033, -15161, -15290, -15418, -15547, -15675, -15804,
+            -15932, -16061, -16189, -16317, -16446, -16574, -16703, -16831, -16960, -17088,
+            -17217, -17345, -17474, -17602, -17731, -17859, -17988, -18116, -18245, -18373,
+            -18502, -18630, -18759, -18887, -19016, -19144, -19273, -19401, -19530, -19658,
+            -19787, -19915, -20044, -20172, -20301, -20429, -20557, -20686, -20814, -20943,
+            -21071, -21200, -21328, -21457, -21585, -21714, -21842, -21971, -22099, -22228,
+            -22356, -22485, -22613, -22742, -22870, -22999, -23127, -23256, -23384, -23513,
+            -23641, -23770, -23898, -24027, -24155, -24284, -24412, -24540, -24669, -24797,
+            -24926, -25054, -25183, -25311, -25440, -25568, -25697, -25825, -25954, -26082,
+            -26211, -26339, -26468, -26596, -26725, -26853, -26982, -27110, -27239, -27367,
+            -27496, -27624, -27753, -27881, -28010, -28138, -28267, -28395, -28524, -28652,
+            -28780, -28909, -29037, -29166, -29294, -29423, -29551, -29680, -29808, -29937,
+            -30065, -30194, -30322, -30451, -30579, -30708, -30836, -30965, -31093, -31222,
+            -31350, -31479, -31607, -31736, -31864, -31993, -32122, -32249, -32377, -32508,
+            -32634, -32730, -32767, -32730, -32634, -32508, -32377, -32249, -32122, -31993,
+            -31864, -31736, -31607, -31479, -31350, -31222, -31093, -30965, -30836, -30708,
+            -30579, -30451, -30322, -30194, -30065, -29937, -29808, -29680, -29551, -29423,
+            -29294, -29166, -29037, -28909, -28780, -28652, -28524, -28395, -28267, -28138,
+            -28010, -27881, -27753, -27624, -27496, -27367, -27239, -27110, -26982, -26853,
+            -26725, -26596, -26468, -26339, -26211, -26082, -25954, -25825, -25697, -25568,
+            -25440, -25311, -25183, -25054, -24926, -24797, -24669, -24540, -24412, -24284,
+            -24155, -24027, -23898, -23770, -23641, -23513, -23384, -23256, -23127, -22999,
+            -22870, -22742, -22613, -22485, -22356, -22228, -22099, -21971, -21842, -21714,
+            -21585, -21457, -21328, -21200, -21071, -20943, -20814, -20686, -20557, -20429,
+            -20301, -20172, -20044, -19915, -19787, -19658, -19530, -19401, -19273, -19144,
+            -19016, -18887, -18759, -18630, -18502, -18373, -18245, -18116, -17988, -17859,
+            -17731, -17602, -17474, -17345, -17217, -17088, -16960, -16831, -16703, -16574,
+            -16446, -16317, -16189, -16061, -15932, -15804, -15675, -15547, -15418, -15290,
+            -15161, -15033, -14904, -14776, -14647, -14519, -14390, -14262, -14133, -14005,
+            -13876, -13748, -13619, -13491, -13362, -13234, -13105, -12977, -12848, -12720,
+            -12591, -12463, -12334, -12206, -12078, -11949, -11821, -11692, -11564, -11435,
+            -11307, -11178, -11050, -10921, -10793, -10664, -10536, -10407, -10279, -10150,
+            -10022, -9893, -9765, -9636, -9508, -9379, -9251, -9122, -8994, -8865,
+            -8737, -8608, -8480, -8351, -8223, -8095, -7966, -7838, -7709, -7581,
+            -7452, -7324, -7195, -7067, -6938, -6810, -6681, -6553, -6424, -6296,
+            -6167, -6039, -5910, -5782, -5653, -5525, -5396, -5268, -5139, -5011,
+            -4882, -4754, -4625, -4497, -4368, -4240, -4111, -3983, -3855, -3726,
+            -3598, -3469, -3341, -3212, -3084, -2955, -2827, -2698, -2570, -2441,
+            -2313, -2184, -2056, -1927, -1799, -1670, -1542, -1413, -1285, -1156,
+            -1028, -899, -771, -642, -514, -385, -257, -128, 0, 128,
+            257, 385, 514, 642, 771, 899, 1028, 1156, 1285, 1413,
+            1542, 1670, 1799, 1927, 2056, 2184, 2313, 2441, 2570, 2698,
+            2827, 2955, 3084, 3212, 3341, 3469, 3598, 3726, 3855, 3983,
+            4111, 4240, 4368, 4497, 4625, 4754, 4882, 5011, 5139, 5268,
+            5396, 5525, 5653, 5782, 5910, 6039, 6167, 6296, 6424, 6553,
+            6681, 6810, 6938, 7067, 7195, 7324, 7452, 7581, 7709, 7838,
+            7966, 8095, 8223, 8351, 8480, 8608, 8737, 8865, 8994, 9122,
+            9251, 9379, 9508, 9636, 9765, 9893, 10022, 10150, 10279, 10407,
+            10536, 10664, 10793, 10921, 11050, 11178, 11307, 11435, 11564, 11692,
+            11821, 11949, 12078, 12206, 12334, 12463, 12591, 12720, 12848, 12977,
+            13105, 13234, 13362, 13491, 13619, 13748, 13876, 14005, 14133, 14262,
+            14390, 14519, 14647, 14776, 14904, 15033, 15161, 15290, 15418, 15547,
+            15675, 15804, 15932, 16061, 16189, 16317, 16446, 16574, 16703, 16831,
+            16960, 17088, 17217, 17345, 17474, 17602, 17731, 17859, 17988, 18116,
+            18245, 18373, 18502, 18630, 18759, 18887, 19016, 19144, 19273, 19401,
+            19530, 19658, 19787, 19915, 20044, 20172, 20301, 20429, 20557, 20686,
+            20814, 20943, 21071, 21200, 21328, 21457, 21585, 21714, 21842, 21971,
+            22099, 22228, 22356, 22485, 22613, 22742, 22870, 22999, 23127, 23256,
+            23384, 23513, 23641, 23770, 23898, 24027, 24155, 24284, 24412, 24540,
+            24669, 24797, 24926, 25054, 25183, 25311, 25440, 25568, 25697, 25825,
+            25954, 26082, 26211, 26339, 26468, 26596, 26725, 26853, 26982, 27110,
+            27239, 27367, 27496, 27624, 27753, 27881, 28010, 28138, 28267, 28395,
+            28524, 28652, 28780, 28909, 29037, 29166, 29294, 29423, 29551, 29680,
+            29808, 29937, 30065, 30194, 30322, 30451, 30579, 30708, 30836, 30965,
+            31093, 31222, 31350, 31479, 31607, 31736, 31864, 31993, 32122, 32249,
+            32377, 32508, 32634, 32730, 32767,
+        },
+        { // octave 1: 128 harmonics
+            32767, 32748, 32693, 32608, 32499, 32376, 32246, 32115, 31984, 31854,
+            31726, 31598, 31470, 31341, 31212, 31082, 30953, 30824, 30695, 30567,
+            30438, 30309, 30180, 30050, 29921, 29792, 29664, 29535, 29406, 29277,
+            29148, 29019, 28890, 28761, 28632, 28503, 28374, 28245, 28116, 27987,
+            27858, 27729, 27600, 27471, 27342, 27213, 27084, 26955, 26826, 26697,
+            26568, 26439, 26310, 26181, 26052, 25923, 25794, 25665, 25537, 25408,
+            25279, 25150, 25021, 24892, 24763, 24634, 24505, 24376, 24247, 24118,
+            23989, 23860, 23731, 23602, 23473, 23344, 23215, 23086, 22957, 22828,
+            22699, 22570, 22441, 22312, 22183, 22054, 21925, 21796, 21667, 21538,
+            21409, 21280, 21151, 21022, 20893, 20765, 20636, 20507, 20378, 20249,
+            20120, 19991, 19862, 19733, 19604, 19475, 19346, 19217, 19088, 18959,
+            18830, 18701, 18572, 18443, 18314, 18185, 18056, 17927, 17798, 17669,
+            17540, 17411, 17282, 17153, 17024, 16895, 16766, 16637, 16508, 16379,
+            16251, 16122, 15993, 15864, 15735, 15606, 15477, 15348, 15219, 15090,
+            14961, 14832, 14703, 14574, 14445, 14316, 14187, 14058, 13929, 13800,
+            13671, 13542, 13413, 13284, 13155, 13026, 12897, 12768, 12639, 12510,
+            12381, 12252, 12123, 11994, 11865, 11736, 11607, 11479, 11350, 11221,
+            11092, 10963, 10834, 10705, 10576, 10447, 10318, 10189, 10060, 9931,
+            9802, 9673, 9544, 9415, 9286, 9157, 9028, 8899, 8770, 8641,
+            8512, 8383, 8254, 8125, 7996, 7867, 7738, 7609, 7480, 7351,
+            7222, 7093, 6965, 6836, 6707, 6578, 6449, 6320, 6191, 6062,
+            5933, 5804, 5675, 5546, 5417, 5288, 5159, 5030, 4901, 4772,
+            4643, 4514, 4385, 4256, 4127, 3998, 3869, 3740, 3611, 3482,
+            3353, 3224, 3095, 2966, 2837, 2708, 2579, 2450, 2321, 2193,
+            2064, 1935, 1806, 1677, 1548, 1419, 1290, 1161, 1032, 903,
+            774, 645, 516, 387, 258, 129, 0, -129, -258, -387,
+            -516, -645, -774, -903, -1032, -1161, -1290, -1419, -1548, -1677,
+            -1806, -1935, -2064, -2193, -2321, -2450, -2579, -2708, -2837, -2966,
+            -3095, -3224, -3353, -3482, -3611, -3740, -3869, -3998, -4127, -4256,
+            -4385, -4514, -4643, -4772, -4901, -5030, -5159, -5288, -5417, -5546,
+            -5675, -5804, -5933, -6062, -6191, -6320, -6449, -6578, -6707, -6836,
+            -6965, -7093, -7222, -7351, -7480, -7609, -7738, -7867, -7996, -8125,
+            -8254, -8383, -8512, -8641, -8770, -8899, -9028, -9157, -9286, -9415,
+            -9544, -9673, -9802, -9931, -10060, -10189, -10318, -10447, -10576, -10705,
+            -10834, -10963, -11092, -11221, -11350, -11479, -11607, -11736, -11865, -11994,
+            -12123, -12252, -12381, -12510, -12639, -12768, -12897, -13026, -13155, -13284,
+            -13413, -13542, -13671, -13800, -13929, -14058, -14187, -14316, -14445, -14574,
+            -14703, -14832, -14961, -15090, -15219, -15348, -15477, -15606, -15735, -15864,
+            -15993, -16122, -16251, -16379, -16508, -16637, -16766, -16895, -17024, -17153,
+            -17282, -17411, -17540, -17669, -17798, -17927, -18056, -18185, -18314, -18443,
+            -18572, -18701, -18830, -18959, -19088, -19217, -19346, -19475, -19604, -19733,
+            -19862, -19991, -20120, -20249, -20378, -20507, -20636, -20765, -20893, -21022,
+            -21151, -21280, -21409, -21538, -21667, -21796, -21925, -22054, -22183, -22312,
+            -22441, -22570, -22699, -22828, -22957, -23086, -23215, -23344, -23473, -23602,
+            -23731, -23860, -23989, -24118, -24247, -24376, -24505, -24634, -24763, -24892,
+            -25021, -25150, -25279, -25408, -25537, -25665, -25794, -25923, -26052, -26181,
+            -26310, -26439, -26568, -26697, -26826, -26955, -27084, -27213, -27342, -27471,
+            -27600, -27729, -27858, -27987, -28116, -28245, -28374, -28503, -28632, -28761,
+            -28890, -29019, -29148, -29277, -29406, -29535, -29664, -29792, -29921, -30050,
+            -30180, -30309, -30438, -30567, -30695, -30824, -30953, -31082, -31212, -31341,
+            -31470, -31598, -31726, -31854, -31984, -32115, -32246, -32376, -32499, -32608,
+            -32693, -32748, -32767, -32748, -32693, -32608, -32499, -32376, -32246, -32115,
+            -31984, -31854, -31726, -31598, -31470, -31341, -31212, -31082, -30953, -30824,
+            -30695, -30567, -30438, -30309, -30180, -30050, -29921, -29792, -29664, -29535,
+            -29406, -29277, -29148, -29019, -28890, -28761, -28632, -28503, -28374, -28245,
+            -28116, -27987, -27858, -27729, -27600, -27471, -27342, -27213, -27084, -26955,
+            -26826, -26697, -26568, -26439, -26310, -26181, -26052, -25923, -25794, -25665,
+            -25537, -25408, -25279, -25150, -25021, -24892, -24763, -24634, -24505, -24376,
+            -24247, -24118, -23989, -23860, -23731, -23602, -23473, -23344, -23215, -23086,
+            -22957, -22828, -22699, -22570, -22441, -22312, -22183, -22054, -21925, -21796,
+            -21667, -21538, -21409, -21280, -21151, -21022, -20893, -20765, -20636, -20507,
+            -20378, -20249, -20120, -19991, -19862, -19733, -19604, -19475, -19346, -19217,
+            -19088, -18959, -18830, -18701, -18572, -18443, -18314, -18185, -18056, -17927,
+            -17798, -17669, -17540, -17411, -17282, -17153, -17024, -16895, -16766, -16637,
+            -16508, -16379, -16251, -16122, -15993, -15864, -15735, -15606, -15477, -15348,
+            -15219, -15090, -14961, -14832, -14703, -14574, -14445, -14316, -14187, -14058,
+            -13929, -13800, -13671, -13542, -13413, -13284, -13155, -13026, -12897, -12768,
+            -12639, -12510, -12381, -12252, -12123, -11994, -11865, -11736, -11607, -11479,
+            -11350, -11221, -11092, -10963, -10834, -10705, -10576, -10447, -10318, -10189,
+            -10060, -9931, -9802, -9673, -9544, -9415, -9286, -9157, -9028, -8899,
+            -8770, -8641, -8512, -8383, -8254, -8125, -7996, -7867, -7738, -7609,
+            -7480, -7351, -7222, -7093, -6965, -6836, -6707, -6578, -6449, -6320,
+            -6191, -6062, -5933, -5804, -5675, -5546, -5417, -5288, -5159, -5030,
+            -4901, -4772, -4643, -4514, -4385, -4256, -4127, -3998, -3869, -3740,
+            -3611, -3482, -3353, -3224, -3095, -2966, -2837, -2708, -2579, -2450,
+            -2321, -2193, -2064, -1935, -1806, -1677, -1548, -1419, -1290, -1161,
+            -1032, -903, -774, -645, -516, -387, -258, -129, 0, 129,
+            258, 387, 516, 645, 774, 903, 1032, 1161, 1290, 1419,
+            1548, 1677, 1806, 1935, 2064, 2193, 2321, 2450, 2579, 2708,
+            2837, 2966, 3095, 3224, 3353, 3482, 3611, 3740, 3869, 3998,
+            4127, 4256, 4385, 4514, 4643, 4772, 4901, 5030, 5159, 5288,
+            5417, 5546, 5675, 5804, 5933, 6062, 6191, 6320, 6449, 6578,
+            6707, 6836, 6965, 7093, 7222, 7351, 7480, 7609, 7738, 7867,
+            7996, 8125, 8254, 8383, 8512, 8641, 8770, 8899, 9028, 9157,
+            9286, 9415, 9544, 9673, 9802, 9931, 10060, 10189, 10318, 10447,
+            10576, 10705, 10834, 10963, 11092, 11221, 11350, 11479, 11607, 11736,
+            11865, 11994, 12123, 12252, 12381, 12510, 12639, 12768, 12897, 13026,
+            13155, 13284, 13413, 13542, 13671, 13800, 13929, 14058, 14187, 14316,
+            14445, 14574, 14703, 14832, 14961, 15090, 15219, 15348, 15477, 15606,
+            15735, 15864, 15993, 16122, 16251, 16379, 16508, 16637, 16766, 16895,
+            17024, 17153, 17282, 17411, 17540, 17669, 17798, 17927, 18056, 18185,
+            18314, 18443, 18572, 18701, 18830, 18959, 19088, 19217, 19346, 19475,
+            19604, 19733, 19862, 19991, 20120, 20249, 20378, 20507, 20636, 20765,
+            20893, 21022, 21151, 21280, 21409, 21538, 21667, 21796, 21925, 22054,
+            22183, 22312, 22441, 22570, 22699, 22828, 22957, 23086, 23215, 23344,
+            23473, 23602, 23731, 23860, 23989, 24118, 24247, 24376, 24505, 24634,
+            24763, 24892, 25021, 25150, 25279, 25408, 25537, 25665, 25794, 25923,
+            26052, 26181, 26310, 26439, 26568, 26697, 26826, 26955, 27084, 27213,
+            27342, 27471, 27600, 27729, 27858, 27987, 28116, 28245, 28374, 28503,
+            28632, 28761, 28890, 29019, 29148, 29277, 29406, 29535, 29664, 29792,
+            29921, 30050, 30180, 30309, 30438, 30567, 30695, 30824, 30953, 31082,
+            31212, 31341, 31470, 31598, 31726, 31854, 31984, 32115, 32246, 32376,
+            32499, 32608, 32693, 32748, 32767,
+        },
+        { // octave 2: 64 harmonics
+            32767, 32757, 32728, 32681, 32617, 32537, 32444, 32339, 32224, 32103,
+            31976, 31846, 31714, 31581, 31448, 31316, 31184, 31054, 30924, 30795,
+            30666, 30537, 30409, 30279, 30150, 30020, 29890, 29759, 29629, 29498,
+            29368, 29237, 29107, 28977, 28848, 28718, 28588, 28459, 28329, 28199,
+            28070, 27940, 27809, 27679, 27549, 27419, 27289, 27159, 27029, 26899,
+            26769, 26639, 26509, 26380, 26250, 26120, 25990, 25860, 25730, 25600,
+            25470, 25340, 25210, 25080, 24950, 24820, 24690, 24560, 24430, 24300,
+            24171, 24041, 23911, 23781, 23651, 23521, 23391, 23261, 23131, 23001,
+            22871, 22741, 22611, 22481, 22351, 22221, 22091, 21961, 21831, 21701,
+            21571, 21441, 21311, 21181, 21051, 20921, 20792, 20662, 20532, 20402,
+            20272, 20142, 20012, 19882, 19752, 19622, 19492, 19362, 19232, 19102,
+            18972, 18842, 18712, 18583, 18453, 18323, 18193, 18063, 17933, 17803,
+            17673, 17543, 17413, 17283, 17153, 17023, 16893, 16763, 16633, 16503,
+            16373, 16244, 16114, 15984, 15854, 15724, 15594, 15464, 15334, 15204,
+            15074, 14944, 14814, 14684, 14554, 14424, 14294, 14164, 14034, 13905,
+            13775, 13645, 13515, 13385, 13255, 13125, 12995, 12865, 12735, 12605,
+            12475, 12345, 12215, 12085, 11955, 11825, 11695, 11565, 11435, 11305,
+            11176, 11046, 10916, 10786, 10656, 10526, 10396, 10266, 10136, 10006,
+            9876, 9746, 9616, 9486, 9356, 9226, 9096, 8966, 8836, 8706,
+            8577, 8447, 8317, 8187, 8057, 7927, 7797, 7667, 7537, 7407,
+            7277, 7147, 7017, 6887, 6757, 6627, 6497, 6367, 6237, 6108,
+            5978, 5848, 5718, 5588, 5458, 5328, 5198, 5068, 4938, 4808,
+            4678, 4548, 4418, 4288, 4158, 4028, 3898, 3769, 3639, 3509,
+            3379, 3249, 3119, 2989, 2859, 2729, 2599, 2469, 2339, 2209,
+            2079, 1949, 1819, 1689, 1559, 1429, 1300, 1170, 1040, 910,
+            780, 650, 520, 390, 260, 130, 0, -130, -260, -390,
+            -520, -650, -780, -910, -1040, -1170, -1300, -1429, -1559, -1689,
+            -1819, -1949, -2079, -2209, -2339, -2469, -2599, -2729, -2859, -2989,
+            -3119, -3249, -3379, -3509, -3639, -3769, -3898, -4028, -4158, -4288,
+            -4418, -4548, -4678, -4808, -4938, -5068, -5198, -5328, -5458, -5588,
+            -5718, -5848, -5978, -6108, -6237, -6367, -6497, -6627, -6757, -6887,
+            -7017, -7147, -7277, -7407, -7537, -7667, -7797, -7927, -8057, -8187,
+            -8317, -8447, -8577, -8706, -8836, -8966, -9096, -9226, -9356, -9486,
+            -9616, -9746, -9876, -10006, -10136, -10266, -10396, -10526, -10656, -10786,
+            -10916, -11046, -11176, -11305, -11435, -11565, -11695, -11825, -11955, -12085,
+            -12215, -12345, -12475, -12605, -12735, -12865, -12995, -13125, -13255, -13385,
+            -13515, -13645, -13775, -13905, -14034, -14164, -14294, -14424, -14554, -14684,
+            -14814, -14944, -15074, -15204, -15334, -15464, -15594, -15724, -15854, -15984,
+            -16114, -16244, -16373, -16503, -16633, -16763, -16893, -17023, -17153, -17283,
+            -17413, -17543, -17673, -17803, -17933, -18063, -18193, -18323, -18453, -18583,
+            -18712, -18842, -18972, -19102, -19232, -19362, -19492, -19622, -19752, -19882,
+            -20012, -20142, -20272, -20402, -20532, -20662, -20792, -20921, -21051, -21181,
+            -21311, -21441, -21571, -21701, -21831, -21961, -22091, -22221, -22351, -22481,
+            -22611, -22741, -22871, -23001, -23131, -23261, -23391, -23521, -23651, -23781,
+            -23911, -24041, -24171, -24300, -24430, -24560, -24690, -24820, -24950, -25080,
+            -25210, -25340, -25470, -25600, -25730, -25860, -25990, -26120, -26250, -26380,
+            -26509, -26639, -26769, -26899, -27029, -27159, -27289, -27419, -27549, -27679,
+            -27809, -27940, -28070, -28199, -28329, -28459, -28588, -28718, -28848, -28977,
+            -29107, -29237, -29368, -29498, -29629, -29759, -29890, -30020, -30150, -30279,
+            -30409, -30537, -30666, -30795, -30924, -31054, -31184, -31316, -31448, -31581,
+            -31714, -31846, -31976, -32103, -32224, -32339, -32444, -32537, -32617, -32681,
+            -32728, -32757, -32767, -32757, -32728, -32681, -32617, -32537, -32444, -32339,
+            -32224, -32103, -31976, -31846, -31714, -31581, -31448, -31316, -31184, -31054,
+            -30924, -30795, -30666, -30537, -30409, -30279, -30150, -30020, -29890, -29759,
+            -29629, -29498, -29368, -29237, -29107, -28977, -28848, -28718, -28588, -28459,
+            -28329, -28199, -28070, -27940, -27809, -27679, -27549, -27419, -27289, -27159,
+            -27029, -26899, -26769, -26639, -26509, -26380, -26250, -26120, -25990, -25860,
+            -25730, -25600, -25470, -25340, -25210, -25080, -24950, -24820, -24690, -24560,
+            -24430, -24300, -24171, -24041, -23911, -23781, -23651, -23521, -23391, -23261,
+            -23131, -23001, -22871, -22741, -22611, -22481, -22351, -22221, -22091, -21961,
+            -21831, -21701, -21571, -21441, -21311, -21181, -21051, -20921, -20792, -20662,
+            -20532, -20402, -20272, -20142, -20012, -19882, -19752, -19622, -19492, -19362,
+            -19232, -19102, -18972, -18842, -18712, -18583, -18453, -18323, -18193, -18063,
+            -17933, -17803, -17673, -17543, -17413, -17283, -17153, -17023, -16893, -16763,
+            -16633, -16503, -16373, -16244, -16114, -15984, -15854, -15724, -15594, -15464,
+            -15334, -15204, -15074, -14944, -14814, -14684, -14554, -14424, -14294, -14164,
+            -14034, -13905, -13775, -13645, -13515, -13385, -13255, -13125, -12995, -12865,
+            -12735, -12605, -12475, -12345, -12215, -12085, -11955, -11825, -11695, -11565,
+            -11435, -11305, -11176, -11046, -10916, -10786, -10656, -10526, -10396, -10266,
+            -10136, -10006, -9876, -9746, -9616, -9486, -9356, -9226, -9096, -8966,
+            -8836, -8706, -8577, -8447, -8317, -8187, -8057, -7927, -7797, -7667,
+            -7537, -7407, -7277, -7147, -7017, -6887, -6757, -6627, -6497, -6367,
+            -6237, -6108, -5978, -5848, -5718, -5588, -5458, -5328, -5198, -5068,
+            -4938, -4808, -4678, -4548, -4418, -4288, -4158, -4028, -3898, -3769,
+            -3639, -3509, -3379, -3249, -3119, -2989, -2859, -2729, -2599, -2469,
+            -2339, -2209, -2079, -1949, -1819, -1689, -1559, -1429, -1300, -1170,
+            -1040, -910, -780, -650, -520, -390, -260, -130, 0, 130,
+            260, 390, 520, 650, 780, 910, 1040, 1170, 1300, 1429,
+            1559, 1689, 1819, 1949, 2079, 2209, 2339, 2469, 2599, 2729,
+            2859, 2989, 3119, 3249, 3379, 3509, 3639, 3769, 3898, 4028,
+            4158, 4288, 4418, 4548, 4678, 4808, 4938, 5068, 5198, 5328,
+            5458, 5588, 5718, 5848, 5978, 6108, 6237, 6367, 6497, 6627,
+            6757, 6887, 7017, 7147, 7277, 7407, 7537, 7667, 7797, 7927,
+            8057, 8187, 8317, 8447, 8577, 8706, 8836, 8966, 9096, 9226,
+            9356, 9486, 9616, 9746, 9876, 10006, 10136, 10266, 10396, 10526,
+            10656, 10786, 10916, 11046, 11176, 11305, 11435, 11565, 11695, 11825,
+            11955, 12085, 12215, 12345, 12475, 12605, 12735, 12865, 12995, 13125,
+            13255, 13385, 13515, 13645, 13775, 13905, 14034, 14164, 14294, 14424,
+            14554, 14684, 14814, 14944, 15074, 15204, 15334, 15464, 15594, 15724,
+            15854, 15984, 16114, 16244, 16373, 16503, 16633, 16763, 16893, 17023,
+            17153, 17283, 17413, 17543, 17673, 17803, 17933, 18063, 18193, 18323,
+            18453, 18583, 18712, 18842, 18972, 19102, 19232, 19362, 19492, 19622,
+            19752, 19882, 20012, 20142, 20272, 20402, 20532, 20662, 20792, 20921,
+            21051, 21181, 21311, 21441, 21571, 21701, 21831, 21961, 22091, 22221,
+            22351, 22481, 22611, 22741, 22871, 23001, 23131, 23261, 23391, 23521,
+            23651, 23781, 23911, 24041, 24171, 24300, 24430, 24560, 24690, 24820,
+            24950, 25080, 25210, 25340, 25470, 25600, 25730, 25860, 25990, 26120,
+            26250, 26380, 26509, 26639, 26769, 26899, 27029, 27159, 27289, 27419,
+            27549, 27679, 27809, 27940, 28070, 28199, 28329, 28459, 28588, 28718,
+            28848, 28977, 29107, 29237, 29368, 29498, 29629, 29759, 29890, 30020,
+            30150, 30279, 30409, 30537, 30666, 30795, 30924, 31054, 31184, 31316,
+            31448, 31581, 31714, 31846, 31976, 32103, 32224, 32339, 32444, 32537,
+            32617, 32681, 32728, 32757, 32767,
+        },
+        { // octave 3: 32 harmonics
+            32767, 32762, 32747, 32722, 32688, 32644, 32590, 32528, 32458, 32380,
+            32294, 32201, 32102, 31997, 31887, 31772, 31653, 31531, 31405, 31277,
+            31146, 31015, 30881, 30747, 30613, 30478, 30343, 30208, 30073, 29939,
+            29805, 29671, 29538, 29406, 29274, 29142, 29011, 28880, 28749, 28618,
+            28488, 28357, 28226, 28096, 27965, 27834, 27702, 27571, 27439, 27307,
+            27175, 27043, 26910, 26778, 26645, 26513, 26380, 26248, 26115, 25983,
+            25850, 25718, 25586, 25454, 25322, 25190, 25059, 24927, 24795, 24664,
+            24532, 24401, 24270, 24138, 24006, 23875, 23743, 23612, 23480, 23348,
+            23216, 23084, 22952, 22820, 22687, 22555, 22423, 22291, 22159, 22027,
+            21894, 21762, 21630, 21498, 21366, 21235, 21103, 20971, 20839, 20707,
+            20576, 20444, 20312, 20181, 20049, 19917, 19786, 19654, 19522, 19390,
+            19258, 19126, 18994, 18862, 18730, 18598, 18466, 18334, 18202, 18070,
+            17938, 17806, 17674, 17542, 17410, 17278, 17146, 17014, 16882, 16751,
+            16619, 16487, 16355, 16224, 16092, 15960, 15828, 15696, 15565, 15433,
+            15301, 15169, 15037, 14905, 14773, 14641, 14509, 14377, 14245, 14113,
+            13981, 13849, 13717, 13585, 13453, 13321, 13189, 13057, 12926, 12794,
+            12662, 12530, 12398, 12267, 12135, 12003, 11871, 11739, 11608, 11476,
+            11344, 11212, 11080, 10948, 10816, 10684, 10552, 10420, 10288, 10156,
+            10024, 9892, 9760, 9628, 9496, 9364, 9232, 9101, 8969, 8837,
+            8705, 8573, 8441, 8310, 8178, 8046, 7914, 7782, 7650, 7519,
+            7387, 7255, 7123, 6991, 6859, 6727, 6595, 6463, 6331, 6199,
+            6067, 5935, 5803, 5671, 5539, 5408, 5276, 5144, 5012, 4880,
+            4748, 4616, 4484, 4352, 4221, 4089, 3957, 3825, 3693, 3562,
+            3430, 3298, 3166, 3034, 2902, 2770, 2638, 2506, 2374, 2242,
+            2110, 1978, 1846, 1715, 1583, 1451, 1319, 1187, 1055, 923,
+            791, 659, 527, 395, 264, 132, 0, -132, -264, -395,
+            -527, -659, -791, -923, -1055, -1187, -1319, -1451, -1583, -1715,
+            -1846, -1978, -2110, -2242, -2374, -2506, -2638, -2770, -2902, -3034,
+            -3166, -3298, -3430, -3562, -3693, -3825, -3957, -4089, -4221, -4352,
+            -4484, -4616, -4748, -4880, -5012, -5144, -5276, -5408, -5539, -5671,
+            -5803, -5935, -6067, -6199, -6331, -6463, -6595, -6727, -6859, -6991,
+            -7123, -7255, -7387, -7519, -7650, -7782, -7914, -8046, -8178, -8310,
+            -8441, -8573, -8705, -8837, -8969, -9101, -9232, -9364, -9496, -9628,
+            -9760, -9892, -10024, -10156, -10288, -10420, -10552, -10684, -10816, -10948,
+            -11080, -11212, -11344, -11476, -11608, -11739, -11871, -12003, -12135, -12267,
+            -12398, -12530, -12662, -12794, -12926, -13057, -13189, -13321, -13453, -13585,
+            -13717, -13849, -13981, -14113, -14245, -14377, -14509, -14641, -14773, -14905,
+            -15037, -15169, -15301, -15433, -15565, -15696, -15828, -15960, -16092, -16224,
+            -16355, -16487, -16619, -16751, -16882, -17014, -17146, -17278, -17410, -17542,
+            -17674, -17806, -17938, -18070, -18202, -18334, -18466, -18598, -18730, -18862,
+            -18994, -19126, -19258, -19390, -19522, -19654, -19786, -19917, -20049, -20181,
+            -20312, -20444, -20576, -20707, -20839, -20971, -21103, -21235, -21366, -21498,
+            -21630, -21762, -21894, -22027, -22159, -22291, -22423, -22555, -22687, -22820,
+            -22952, -23084, -23216, -23348, -23480, -23612, -23743, -23875, -24006, -24138,
+            -24270, -24401, -24532, -24664, -24795, -24927, -25059, -25190, -25322, -25454,
+            -25586, -25718, -25850, -25983, -26115, -26248, -26380, -26513, -26645, -26778,
+            -26910, -27043, -27175, -27307, -27439, -27571, -27702, -27834, -27965, -28096,
+            -28226, -28357, -28488, -28618, -28749, -28880, -29011, -29142, -29274, -29406,
+            -29538, -29671, -29805, -29939, -30073, -30208, -30343, -30478, -30613, -30747,
+            -30881, -31015, -31146, -31277, -31405, -31531, -31653, -31772, -31887, -31997,
+            -32102, -32201, -32294, -32380, -32458, -32528, -32590, -32644, -32688, -32722,
+            -32747, -32762, -32767, -32762, -32747, -32722, -32688, -32644, -32590, -32528,
+            -32458, -32380, -32294, -32201, -32102, -31997, -31887, -31772, -31653, -31531,
+            -31405, -31277, -31146, -31015, -30881, -30747, -30613, -30478, -30343, -30208,
+            -30073, -29939, -29805, -29671, -29538, -29406, -29274, -29142, -29011, -28880,
+            -28749, -28618, -28488, -28357, -28226, -28096, -27965, -27834, -27702, -27571,
+            -27439, -27307, -27175, -27043, -26910, -26778, -26645, -26513, -26380, -26248,
+            -26115, -25983, -25850, -25718, -25586, -25454, -25322, -25190, -25059, -24927,
+            -24795, -24664, -24532, -24401, -24270, -24138, -24006, -23875, -23743, -23612,
+            -23480, -23348, -23216, -23084, -22952, -22820, -22687, -22555, -22423, -22291,
+            -22159, -22027, -21894, -21762, -21630, -21498, -21366, -21235, -21103, -20971,
+            -20839, -20707, -20576, -20444, -20312, -20181, -20049, -19917, -19786, -19654,
+            -19522, -19390, -19258, -19126, -18994, -18862, -18730, -18598, -18466, -18334,
+            -18202, -18070, -17938, -17806, -17674, -17542, -17410, -17278, -17146, -17014,
+            -16882, -16751, -16619, -16487, -16355, -16224, -16092, -15960, -15828, -15696,
+            -15565, -15433, -15301, -15169, -15037, -14905, -14773, -14641, -14509, -14377,
+            -14245, -14113, -13981, -13849, -13717, -13585, -13453, -13321, -13189, -13057,
+            -12926, -12794, -12662, -12530, -12398, -12267, -12135, -12003, -11871, -11739,
+            -11608, -11476, -11344, -11212, -11080, -10948, -10816, -10684, -10552, -10420,
+            -10288, -10156, -10024, -9892, -9760, -9628, -9496, -9364, -9232, -9101,
+            -8969, -8837, -8705, -8573, -8441, -8310, -8178, -8046, -7914, -7782,
+            -7650, -7519, -7387, -7255, -7123, -6991, -6859, -6727, -6595, -6463,
+            -6331, -6199, -6067, -5935, -5803, -5671, -5539, -5408, -5276, -5144,
+            -5012, -4880, -4748, -4616, -4484, -4352, -4221, -4089, -3957, -3825,
+            -3693, -3562, -3430, -3298, -3166, -3034, -2902, -2770, -2638, -2506,
+            -2374, -2242, -2110, -1978, -1846, -1715, -1583, -1451, -1319, -1187,
+            -1055, -923, -791, -659, -527, -395, -264, -132, 0, 132,
+            264, 395, 527, 659, 791, 923, 1055, 1187, 1319, 1451,
+            1583, 1715, 1846, 1978, 2110, 2242, 2374, 2506, 2638, 2770,
+            2902, 3034, 3166, 3298, 3430, 3562, 3693, 3825, 3957, 4089,
+            4221, 4352, 4484, 4616, 4748, 4880, 5012, 5144, 5276, 5408,
+            5539, 5671, 5803, 5935, 6067, 6199, 6331, 6463, 6595, 6727,
+            6859, 6991, 7123, 7255, 7387, 7519, 7650, 7782, 7914, 8046,
+            8178, 8310, 8441, 8573, 8705, 8837, 8969, 9101, 9232, 9364,
+            9496, 9628, 9760, 9892, 10024, 10156, 10288, 10420, 10552, 10684,
+            10816, 10948, 11080, 11212, 11344, 11476, 11608, 11739, 11871, 12003,
+            12135, 12267, 12398, 12530, 12662, 12794, 12926, 13057, 13189, 13321,
+            13453, 13585, 13717, 13849, 13981, 14113, 14245, 14377, 14509, 14641,
+            14773, 14905, 15037, 15169, 15301, 15433, 15565, 15696, 15828, 15960,
+            16092, 16224, 16355, 16487, 16619, 16751, 16882, 17014, 17146, 17278,
+            17410, 17542, 17674, 17806, 17938, 18070, 18202, 18334, 18466, 18598,
+            18730, 18862, 18994, 19126, 19258, 19390, 19522, 19654, 19786, 19917,
+            20049, 20181, 20312, 20444, 20576, 20707, 20839, 20971, 21103, 21235,
+            21366, 21498, 21630, 21762, 21894, 22027, 22159, 22291, 22423, 22555,
+            22687, 22820, 22952, 23084, 23216, 23348, 23480, 23612, 23743, 23875,
+            24006, 24138, 24270, 24401, 24532, 24664, 24795, 24927, 25059, 25190,
+            25322, 25454, 25586, 25718, 25850, 25983, 26115, 26248, 26380, 26513,
+            26645, 26778, 26910, 27043, 27175, 27307, 27439, 27571, 27702, 27834,
+            27965, 28096, 28226, 28357, 28488, 28618, 28749, 28880, 29011, 29142,
+            29274, 29406, 29538, 29671, 29805, 29939, 30073, 30208, 30343, 30478,
+            30613, 30747, 30881, 31015, 31146, 31277, 31405, 31531, 31653, 31772,
+            31887, 31997, 32102, 32201, 32294, 32380, 32458, 32528, 32590, 32644,
+            32688, 32722, 32747, 32762, 32767,
+        },
+        { // octave 4: 16 harmonics
+            32767, 32764, 32756, 32743, 32725, 32701, 32672, 32638, 32599, 32555,
+            32506, 32452, 32393, 32330, 32262, 32190, 32114, 32033, 31949, 31860,
+            31768, 31672, 31573, 31470, 31365, 31256, 31144, 31030, 30913, 30794,
+            30673, 30550, 30424, 30297, 30169, 30038, 29907, 29774, 29640, 29506,
+            29370, 29233, 29096, 28959, 28821, 28682, 28544, 28405, 28266, 28127,
+            27988, 27849, 27710, 27571, 27432, 27293, 27155, 27017, 26879, 26742,
+            26604, 26467, 26330, 26194, 26058, 25922, 25786, 25650, 25515, 25380,
+            25245, 25110, 24975, 24840, 24706, 24571, 24437, 24302, 24168, 24033,
+            23899, 23765, 23630, 23495, 23361, 23226, 23091, 22956, 22821, 22686,
+            22551, 22415, 22280, 22144, 22008, 21872, 21736, 21600, 21464, 21328,
+            21192, 21055, 20919, 20782, 20646, 20509, 20373, 20236, 20099, 19963,
+            19826, 19690, 19553, 19417, 19280, 19144, 19008, 18871, 18735, 18599,
+            18463, 18327, 18191, 18056, 17920, 17784, 17648, 17513, 17377, 17242,
+            17106, 16971, 16836, 16700, 16565, 16430, 16295, 16159, 16024, 15889,
+            15753, 15618, 15483, 15347, 15212, 15077, 14941, 14806, 14670, 14534,
+            14399, 14263, 14127, 13992, 13856, 13720, 13584, 13448, 13312, 13176,
+            13040, 12903, 12767, 12631, 12495, 12359, 12223, 12086, 11950, 11814,
+            11678, 11542, 11405, 11269, 11133, 10997, 10861, 10725, 10589, 10453,
+            10317, 10182, 10046, 9910, 9774, 9638, 9503, 9367, 9232, 9096,
+            8960, 8825, 8689, 8554, 8419, 8283, 8148, 8012, 7877, 7741,
+            7606, 7470, 7335, 7199, 7064, 6928, 6792, 6657, 6521, 6385,
+            6250, 6114, 5978, 5842, 5706, 5571, 5435, 5299, 5163, 5027,
+            4891, 4755, 4619, 4482, 4346, 4210, 4074, 3938, 3802, 3666,
+            3530, 3394, 3258, 3122, 2986, 2850, 2714, 2578, 2442, 2306,
+            2170, 2034, 1898, 1763, 1627, 1491, 1356, 1220, 1084, 949,
+            813, 678, 542, 407, 271, 136, 0, -136, -271, -407,
+            -542, -678, -813, -949, -1084, -1220, -1356, -1491, -1627, -1763,
+            -1898, -2034, -2170, -2306, -2442, -2578, -2714, -2850, -2986, -3122,
+            -3258, -3394, -3530, -3666, -3802, -3938, -4074, -4210, -4346, -4482,
+            -4619, -4755, -4891, -5027, -5163, -5299, -5435, -5571, -5706, -5842,
+            -5978, -6114, -6250, -6385, -6521, -6657, -6792, -6928, -7064, -7199,
+            -7335, -7470, -7606, -7741, -7877, -8012, -8148, -8283, -8419, -8554,
+            -8689, -8825, -8960, -9096, -9232, -9367, -9503, -9638, -9774, -9910,
+            -10046, -10182, -10317, -10453, -10589, -10725, -10861, -10997, -11133, -11269,
+            -11405, -11542, -11678, -11814, -11950, -12086, -12223, -12359, -12495, -12631,
+            -12767, -12903, -13040, -13176, -13312, -13448, -13584, -13720, -13856, -13992,
+            -14127, -14263, -14399, -14534, -14670, -14806, -14941, -15077, -15212, -15347,
+            -15483, -15618, -15753, -15889, -16024, -16159, -16295, -16430, -16565, -16700,
+            -16836, -16971, -17106, -17242, -17377, -17513, -17648, -17784, -17920, -18056,
+            -18191, -18327, -18463, -18599, -18735, -18871, -19008, -19144, -19280, -19417,
+            -19553, -19690, -19826, -19963, -20099, -20236, -20373, -20509, -20646, -20782,
+            -20919, -21055, -21192, -21328, -21464, -21600, -21736, -21872, -22008, -22144,
+            -22280, -22415, -22551, -22686, -22821, -22956, -23091, -23226, -23361, -23495,
+            -23630, -23765, -23899, -24033, -24168, -24302, -24437, -24571, -24706, -24840,
+            -24975, -25110, -25245, -25380, -25515, -25650, -25786, -25922, -26058, -26194,
+            -26330, -26467, -26604, -26742, -26879, -27017, -27155, -27293, -27432, -27571,
+            -27710, -27849, -27988, -28127, -28266, -28405, -28544, -28682, -28821, -28959,
+            -29096, -29233, -29370, -29506, -29640, -29774, -29907, -30038, -30169, -30297,
+            -30424, -30550, -30673, -30794, -30913, -31030, -31144, -31256, -31365, -31470,
+            -31573, -31672, -31768, -31860, -31949, -32033, -32114, -32190, -32262, -32330,
+            -32393, -32452, -32506, -32555, -32599, -32638, -32672, -32701, -32725, -32743,
+            -32756, -32764, -32767, -32764, -32756, -32743, -32725, -32701, -32672, -32638,
+            -32599, -32555, -32506, -32452, -32393, -32330, -32262, -32190, -32114, -32033,
+            -31949, -31860, -31768, -31672, -31573, -31470, -31365, -31256, -31144, -31030,
+            -30913, -30794, -30673, -30550, -30424, -30297, -30169, -30038, -29907, -29774,
+            -29640, -29506, -29370, -29233, -29096, -28959, -28821, -28682, -28544, -28405,
+            -28266, -28127, -27988, -27849, -27710, -27571, -27432, -27293, -27155, -27017,
+            -26879, -26742, -26604, -26467, -26330, -26194, -26058, -25922, -25786, -25650,
+            -25515, -25380, -25245, -25110, -24975, -24840, -24706, -24571, -24437, -24302,
+            -24168, -24033, -23899, -23765, -23630, -23495, -23361, -23226, -23091, -22956,
+            -22821, -22686, -22551, -22415, -22280, -22144, -22008, -21872, -21736, -21600,
+            -21464, -21328, -21192, -21055, -20919, -20782, -20646, -20509, -20373, -20236,
+            -20099, -19963, -19826, -19690, -19553, -19417, -19280, -19144, -19008, -18871,
+            -18735, -18599, -18463, -18327, -18191, -18056, -17920, -17784, -17648, -17513,
+            -17377, -17242, -17106, -16971, -16836, -16700, -16565, -16430, -16295, -16159,
+            -16024, -15889, -15753, -15618, -15483, -15347, -15212, -15077, -14941, -14806,
+            -14670, -14534, -14399, -14263, -14127, -13992, -13856, -13720, -13584, -13448,
+            -13312, -13176, -13040, -12903, -12767, -12631, -12495, -12359, -12223, -12086,
+            -11950, -11814, -11678, -11542, -11405, -11269, -11133, -10997, -10861, -10725,
+            -10589, -10453, -10317, -10182, -10046, -9910, -9774, -9638, -9503, -9367,
+            -9232, -9096, -8960, -8825, -8689, -8554, -8419, -8283, -8148, -8012,
+            -7877, -7741, -7606, -7470, -7335, -7199, -7064, -6928, -6792, -6657,
+            -6521, -6385, -6250, -6114, -5978, -5842, -5706, -5571, -5435, -5299,
+            -5163, -5027, -4891, -4755, -4619, -4482, -4346, -4210, -4074, -3938,
+            -3802, -3666, -3530, -3394, -3258, -3122, -2986, -2850, -2714, -2578,
+            -2442, -2306, -2170, -2034, -1898, -1763, -1627, -1491, -1356, -1220,
+            -1084, -949, -813, -678, -542, -407, -271, -136, 0, 136,
+            271, 407, 542, 678, 813, 949, 1084, 1220, 1356, 1491,
+            1627, 1763, 1898, 2034, 2170, 2306, 2442, 2578, 2714, 2850,
+            2986, 3122, 3258, 3394, 3530, 3666, 3802, 3938, 4074, 4210,
+            4346, 4482, 4619, 4755, 4891, 5027, 5163, 5299, 5435, 5571,
+            5706, 5842, 5978, 6114, 6250, 6385, 6521, 6657, 6792, 6928,
+            7064, 7199, 7335, 7470, 7606, 7741, 7877, 8012, 8148, 8283,
+            8419, 8554, 8689, 8825, 8960, 9096, 9232, 9367, 9503, 9638,
+            9774, 9910, 10046, 10182, 10317, 10453, 10589, 10725, 10861, 10997,
+            11133, 11269, 11405, 11542, 11678, 11814, 11950, 12086, 12223, 12359,
+            12495, 12631, 12767, 12903, 13040, 13176, 13312, 13448, 13584, 13720,
+            13856, 13992, 14127, 14263, 14399, 14534, 14670, 14806, 14941, 15077,
+            15212, 15347, 15483, 15618, 15753, 15889, 16024, 16159, 16295, 16430,
+            16565, 16700, 16836, 16971, 17106, 17242, 17377, 17513, 17648, 17784,
+            17920, 18056, 18191, 18327, 18463, 18599, 18735, 18871, 19008, 19144,
+            19280, 19417, 19553, 19690, 19826, 19963, 20099, 20236, 20373, 20509,
+            20646, 20782, 20919, 21055, 21192, 21328, 21464, 21600, 21736, 21872,
+            22008, 22144, 22280, 22415, 22551, 22686, 22821, 22956, 23091, 23226,
+            23361, 23495, 23630, 23765, 23899, 24033, 24168, 24302, 24437, 24571,
+            24706, 24840, 24975, 25110, 25245, 25380, 25515, 25650, 25786, 25922,
+            26058, 26194, 26330, 26467, 26604, 26742, 26879, 27017, 27155, 27293,
+            27432, 27571, 27710, 27849, 27988, 28127, 28266, 28405, 28544, 28682,
+            28821, 28959, 29096, 29233, 29370, 29506, 29640, 29774, 29907, 30038,
+            30169, 30297, 30424, 30550, 30673, 30794, 30913, 31030, 31144, 31256,
+            31365, 31470, 31573, 31672, 31768, 31860, 31949, 32033, 32114, 32190,
+            32262, 32330, 32393, 32452, 32506, 32555, 32599, 32638, 32672, 32701,
+            32725, 32743, 32756, 32764, 32767,
+        },
+        { // octave 5: 8 harmonics
+            32767, 32766, 32761, 32754, 32743, 32730, 32714, 32695, 32673, 32648,
+            32620, 32589, 32556, 32519, 32480, 32438, 32393, 32345, 32295, 32242,
+            32186, 32127, 32066, 32002, 31936, 31867, 31796, 31722, 31646, 31567,
+            31486, 31403, 31317, 31229, 31139, 31046, 30952, 30855, 30757, 30656,
+            30553, 30449, 30342, 30234, 30124, 30012, 29899, 29784, 29667, 29548,
+            29429, 29307, 29184, 29060, 28935, 28808, 28680, 28551, 28421, 28289,
+            28157, 28023, 27888, 27753, 27617, 27479, 27341, 27203, 27063, 26923,
+            26782, 26640, 26498, 26355, 26212, 26069, 25925, 25780, 25635, 25490,
+            25344, 25199, 25052, 24906, 24760, 24613, 24466, 24319, 24172, 24025,
+            23877, 23730, 23583, 23435, 23288, 23141, 22993, 22846, 22699, 22552,
+            22405, 22258, 22111, 21964, 21818, 21671, 21525, 21379, 21233, 21087,
+            20941, 20796, 20651, 20505, 20360, 20215, 20071, 19926, 19782, 19638,
+            19494, 19350, 19206, 19062, 18919, 18776, 18632, 18489, 18346, 18204,
+            18061, 17918, 17776, 17633, 17491, 17349, 17207, 17065, 16923, 16781,
+            16639, 16497, 16355, 16213, 16071, 15929, 15788, 15646, 15504, 15362,
+            15220, 15078, 14936, 14794, 14653, 14510, 14368, 14226, 14084, 13942,
+            13799, 13657, 13515, 13372, 13229, 13087, 12944, 12801, 12658, 12515,
+            12372, 12229, 12085, 11942, 11798, 11655, 11511, 11368, 11224, 11080,
+            10936, 10792, 10648, 10504, 10359, 10215, 10071, 9926, 9782, 9637,
+            9493, 9348, 9203, 9059, 8914, 8769, 8625, 8480, 8335, 8190,
+            8045, 7900, 7756, 7611, 7466, 7321, 7176, 7032, 6887, 6742,
+            6598, 6453, 6308, 6164, 6019, 5875, 5730, 5586, 5442, 5297,
+            5153, 5009, 4865, 4721, 4577, 4433, 4289, 4146, 4002, 3858,
+            3715, 3571, 3428, 3284, 3141, 2998, 2855, 2712, 2568, 2425,
+            2282, 2140, 1997, 1854, 1711, 1568, 1426, 1283, 1140, 998,
+            855, 713, 570, 428, 285, 143, 0, -143, -285, -428,
+            -570, -713, -855, -998, -1140, -1283, -1426, -1568, -1711, -1854,
+            -1997, -2140, -2282, -2425, -2568, -2712, -2855, -2998, -3141, -3284,
+            -3428, -3571, -3715, -3858, -4002, -4146, -4289, -4433, -4577, -4721,
+            -4865, -5009, -5153, -5297, -5442, -5586, -5730, -5875, -6019, -6164,
+            -6308, -6453, -6598, -6742, -6887, -7032, -7176, -7321, -7466, -7611,
+            -7756, -7900, -8045, -8190, -8335, -8480, -8625, -8769, -8914, -9059,
+            -9203, -9348, -9493, -9637, -9782, -9926, -10071, -10215, -10359, -10504,
+            -10648, -10792, -10936, -11080, -11224, -11368, -11511, -11655, -11798, -11942,
+            -12085, -12229, -12372, -12515, -12658, -12801, -12944, -13087, -13229, -13372,
+            -13515, -13657, -13799, -13942, -14084, -14226, -14368, -14510, -14653, -14794,
+            -14936, -15078, -15220, -15362, -15504, -15646, -15788, -15929, -16071, -16213,
+            -16355, -16497, -16639, -16781, -16923, -17065, -17207, -17349, -17491, -17633,
+            -17776, -17918, -18061, -18204, -18346, -18489, -18632, -18776, -18919, -19062,
+            -19206, -19350, -19494, -19638, -19782, -19926, -20071, -20215, -20360, -20505,
+            -20651, -20796, -20941, -21087, -21233, -21379, -21525, -21671, -21818, -21964,
+            -22111, -22258, -22405, -22552, -22699, -22846, -22993, -23141, -23288, -23435,
+            -23583, -23730, -23877, -24025, -24172, -24319, -24466, -24613, -24760, -24906,
+            -25052, -25199, -25344, -25490, -25635, -25780, -25925, -26069, -26212, -26355,
+            -26498, -26640, -26782, -26923, -27063, -27203, -27341, -27479, -27617, -27753,
+            -27888, -28023, -28157, -28289, -28421, -28551, -28680, -28808, -28935, -29060,
+            -29184, -29307, -29429, -29548, -29667, -29784, -29899, -30012, -30124, -30234,
+            -30342, -30449, -30553, -30656, -30757, -30855, -30952, -31046, -31139, -31229,
+            -31317, -31403, -31486, -31567, -31646, -31722, -31796, -31867, -31936, -32002,
+            -32066, -32127, -32186, -32242, -32295, -32345, -32393, -32438, -32480, -32519,
+            -32556, -32589, -32620, -32648, -32673, -32695, -32714, -32730, -32743, -32754,
+            -32761, -32766, -32767, -32766, -32761, -32754, -32743, -32730, -32714, -32695,
+            -32673, -32648, -32620, -32589, -32556, -32519, -32480, -32438, -32393, -32345,
+            -32295, -32242, -32186, -32127, -32066, -32002, -31936, -31867, -31796, -31722,
+            -31646, -31567, -31486, -31403, -31317, -31229, -31139, -31046, -30952, -30855,
+            -30757, -30656, -30553, -30449, -30342, -30234, -30124, -30012, -29899, -29784,
+            -29667, -29548, -29429, -29307, -29184, -29060, -28935, -28808, -28680, -28551,
+            -28421, -28289, -28157, -28023, -27888, -27753, -27617, -27479, -27341, -27203,
+            -27063, -26923, -26782, -26640, -26498, -26355, -26212, -26069, -25925, -25780,
+            -25635, -25490, -25344, -25199, -25052, -24906, -24760, -24613, -24466, -24319,
+            -24172, -24025, -23877, -23730, -23583, -23435, -23288, -23141, -22993, -22846,
+            -22699, -22552, -22405, -22258, -22111, -21964, -21818, -21671, -21525, -21379,
+            -21233, -21087, -20941, -20796, -20651, -20505, -20360, -20215, -20071, -19926,
+            -19782, -19638, -19494, -19350, -19206, -19062, -18919, -18776, -18632, -18489,
+            -18346, -18204, -18061, -17918, -17776, -17633, -17491, -17349, -17207, -17065,
+            -16923, -16781, -16639, -16497, -16355, -16213, -16071, -15929, -15788, -15646,
+            -15504, -15362, -15220, -15078, -14936, -14794, -14653, -14510, -14368, -14226,
+            -14084, -13942, -13799, -13657, -13515, -13372, -13229, -13087, -12944, -12801,
+            -12658, -12515, -12372, -12229, -12085, -11942, -11798, -11655, -11511, -11368,
+            -11224, -11080, -10936, -10792, -10648, -10504, -10359, -10215, -10071, -9926,
+            -9782, -9637, -9493, -9348, -9203, -9059, -8914, -8769, -8625, -8480,
+            -8335, -8190, -8045, -7900, -7756, -7611, -7466, -7321, -7176, -7032,
+            -6887, -6742, -6598, -6453, -6308, -6164, -6019, -5875, -5730, -5586,
+            -5442, -5297, -5153, -5009, -4865, -4721, -4577, -4433, -4289, -4146,
+            -4002, -3858, -3715, -3571, -3428, -3284, -3141, -2998, -2855, -2712,
+            -2568, -2425, -2282, -2140, -1997, -1854, -1711, -1568, -1426, -1283,
+            -1140, -998, -855, -713, -570, -428, -285, -143, 0, 143,
+            285, 428, 570, 713, 855, 998, 1140, 1283, 1426, 1568,
+            1711, 1854, 1997, 2140, 2282, 2425, 2568, 2712, 2855, 2998,
+            3141, 3284, 3428, 3571, 3715, 3858, 4002, 4146, 4289, 4433,
+            4577, 4721, 4865, 5009, 5153, 5297, 5442, 5586, 5730, 5875,
+            6019, 6164, 6308, 6453, 6598, 6742, 6887, 7032, 7176, 7321,
+            7466, 7611, 7756, 7900, 8045, 8190, 8335, 8480, 8625, 8769,
+            8914, 9059, 9203, 9348, 9493, 9637, 9782, 9926, 10071, 10215,
+            10359, 10504, 10648, 10792, 10936, 11080, 11224, 11368, 11511, 11655,
+            11798, 11942, 12085, 12229, 12372, 12515, 12658, 12801, 12944, 13087,
+            13229, 13372, 13515, 13657, 13799, 13942, 14084, 14226, 14368, 14510,
+            14653, 14794, 14936, 15078, 15220, 15362, 15504, 15646, 15788, 15929,
+            16071, 16213, 16355, 16497, 16639, 16781, 16923, 17065, 17207, 17349,
+            17491, 17633, 17776, 17918, 18061, 18204, 18346, 18489, 18632, 18776,
+            18919, 19062, 19206, 19350, 19494, 19638, 19782, 19926, 20071, 20215,
+            20360, 20505, 20651, 20796, 20941, 21087, 21233, 21379, 21525, 21671,
+            21818, 21964, 22111, 22258, 22405, 22552, 22699, 22846, 22993, 23141,
+            23288, 23435, 23583, 23730, 23877, 24025, 24172, 24319, 24466, 24613,
+            24760, 24906, 25052, 25199, 25344, 25490, 25635, 25780, 25925, 26069,
+            26212, 26355, 26498, 26640, 26782, 26923, 27063, 27203, 27341, 27479,
+            27617, 27753, 27888, 28023, 28157, 28289, 28421, 28551, 28680, 28808,
+            28935, 29060, 29184, 29307, 29429, 29548, 29667, 29784, 29899, 30012,
+            30124, 30234, 30342, 30449, 30553, 30656, 30757, 30855, 30952, 31046,
+            31139, 31229, 31317, 31403, 31486, 31567, 31646, 31722, 31796, 31867,
+            31936, 32002, 32066, 32127, 32186, 32242, 32295, 32345, 32393, 32438,
+            32480, 32519, 32556, 32589, 32620, 32648, 32673, 32695, 32714, 32730,
+            32743, 32754, 32761, 32766, 32767,
+        },
+        { // octave 6: 4 harmonics
+            32767, 32766, 32763, 32759, 32753, 32745, 32735, 32723, 32710, 32695,
+            32678, 32659, 32638, 32616, 32592, 32566, 32538, 32509, 32478, 32445,
+            32410, 32374, 32336, 32296, 32255, 32211, 32166, 32120, 32071, 32021,
+            31969, 31916, 31861, 31804, 31746, 31685, 31624, 31560, 31495, 31429,
+            31361, 31291, 31219, 31147, 31072, 30996, 30918, 30839, 30759, 30676,
+            30593, 30507, 30421, 30333, 30243, 30152, 30060, 29966, 29871, 29774,
+            29676, 29576, 29476, 29374, 29270, 29165, 29059, 28952, 28843, 28733,
+            28622, 28510, 28396, 28282, 28166, 28049, 27930, 27811, 27690, 27568,
+            27446, 27322, 27197, 27071, 26944, 26816, 26686, 26556, 26425, 26293,
+            26160, 26026, 25891, 25756, 25619, 25481, 25343, 25204, 25064, 24923,
+            24781, 24639, 24495, 24351, 24207, 24061, 23915, 23768, 23620, 23472,
+            23323, 23174, 23024, 22873, 22722, 22570, 22418, 22265, 22111, 21957,
+            21802, 21647, 21492, 21336, 21180, 21023, 20865, 20708, 20550, 20391,
+            20233, 20073, 19914, 19754, 19594, 19434, 19273, 19112, 18951, 18789,
+            18627, 18465, 18303, 18141, 17978, 17815, 17652, 17489, 17326, 17162,
+            16999, 16835, 16671, 16507, 16343, 16179, 16015, 15851, 15687, 15522,
+            15358, 15194, 15029, 14865, 14700, 14536, 14372, 14207, 14043, 13878,
+            13714, 13550, 13386, 13221, 13057, 12893, 12729, 12565, 12402, 12238,
+            12074, 11911, 11747, 11584, 11421, 11257, 11094, 10931, 10769, 10606,
+            10443, 10281, 10119, 9957, 9795, 9633, 9471, 9310, 9148, 8987,
+            8826, 8665, 8504, 8343, 8183, 8022, 7862, 7702, 7542, 7382,
+            7222, 7063, 6904, 6744, 6585, 6426, 6267, 6109, 5950, 5792,
+            5634, 5475, 5317, 5160, 5002, 4844, 4687, 4529, 4372, 4215,
+            4058, 3901, 3744, 3587, 3431, 3274, 3118, 2961, 2805, 2649,
+            2492, 2336, 2180, 2024, 1868, 1712, 1557, 1401, 1245, 1089,
+            934, 778, 622, 467, 311, 156, 0, -156, -311, -467,
+            -622, -778, -934, -1089, -1245, -1401, -1557, -1712, -1868, -2024,
+            -2180, -2336, -2492, -2649, -2805, -2961, -3118, -3274, -3431, -3587,
+            -3744, -3901, -4058, -4215, -4372, -4529, -4687, -4844, -5002, -5160,
+            -5317, -5475, -5634, -5792, -5950, -6109, -6267, -6426, -6585, -6744,
+            -6904, -7063, -7222, -7382, -7542, -7702, -7862, -8022, -8183, -8343,
+            -8504, -8665, -8826, -8987, -9148, -9310, -9471, -9633, -9795, -9957,
+            -10119, -10281, -10443, -10606, -10769, -10931, -11094, -11257, -11421, -11584,
+            -11747, -11911, -12074, -12238, -12402, -12565, -12729, -12893, -13057, -13221,
+            -13386, -13550, -13714, -13878, -14043, -14207, -14372, -14536, -14700, -14865,
+            -15029, -15194, -15358, -15522, -15687, -15851, -16015, -16179, -16343, -16507,
+            -16671, -16835, -16999, -17162, -17326, -17489, -17652, -17815, -17978, -18141,
+            -18303, -18465, -18627, -18789, -18951, -19112, -19273, -19434, -19594, -19754,
+            -19914, -20073, -20233, -20391, -20550, -20708, -20865, -21023, -21180, -21336,
+            -21492, -21647, -21802, -21957, -22111, -22265, -22418, -22570, -22722, -22873,
+            -23024, -23174, -23323, -23472, -23620, -23768, -23915, -24061, -24207, -24351,
+            -24495, -24639, -24781, -24923, -25064, -25204, -25343, -25481, -25619, -25756,
+            -25891, -26026, -26160, -26293, -26425, -26556, -26686, -26816, -26944, -27071,
+            -27197, -27322, -27446, -27568, -27690, -27811, -27930, -28049, -28166, -28282,
+            -28396, -28510, -28622, -28733, -28843, -28952, -29059, -29165, -29270, -29374,
+            -29476, -29576, -29676, -29774, -29871, -29966, -30060, -30152, -30243, -30333,
+            -30421, -30507, -30593, -30676, -30759, -30839, -30918, -30996, -31072, -31147,
+            -31219, -31291, -31361, -31429, -31495, -31560, -31624, -31685, -31746, -31804,
+            -31861, -31916, -31969, -32021, -32071, -32120, -32166, -32211, -32255, -32296,
+            -32336, -32374, -32410, -32445, -32478, -32509, -32538, -32566, -32592, -32616,
+            -32638, -32659, -32678, -32695, -32710, -32723, -32735, -32745, -32753, -32759,
+            -32763, -32766, -32767, -32766, -32763, -32759, -32753, -32745, -32735, -32723,
+            -32710, -32695, -32678, -32659, -32638, -32616, -32592, -32566, -32538, -32509,
+            -32478, -32445, -32410, -32374, -32336, -32296, -32255, -32211, -32166, -32120,
+            -32071, -32021, -31969, -31916, -31861, -31804, -31746, -31685, -31624, -31560,
+            -31495, -31429, -31361, -31291, -31219, -31147, -31072, -30996, -30918, -30839,
+            -30759, -30676, -30593, -30507, -30421, -30333, -30243, -30152, -30060, -29966,
+            -29871, -29774, -29676, -29576, -29476, -29374, -29270, -29165, -29059, -28952,
+            -28843, -28733, -28622, -28510, -28396, -28282, -28166, -28049, -27930, -27811,
+            -27690, -27568, -27446, -27322, -27197, -27071, -26944, -26816, -26686, -26556,
+            -26425, -26293, -26160, -26026, -25891, -25756, -25619, -25481, -25343, -25204,
+            -25064, -24923, -24781, -24639, -24495, -24351, -24207, -24061, -23915, -23768,
+            -23620, -23472, -23323, -23174, -23024, -22873, -22722, -22570, -22418, -22265,
+            -22111, -21957, -21802, -21647, -21492, -21336, -21180, -21023, -20865, -20708,
+            -20550, -20391, -20233, -20073, -19914, -19754, -19594, -19434, -19273, -19112,
+            -18951, -18789, -18627, -18465, -18303, -18141, -17978, -17815, -17652, -17489,
+            -17326, -17162, -16999, -16835, -16671, -16507, -16343, -16179, -16015, -15851,
+            -15687, -15522, -15358, -15194, -15029, -14865, -14700, -14536, -14372, -14207,
+            -14043, -13878, -13714, -13550, -13386, -13221, -13057, -12893, -12729, -12565,
+            -12402, -12238, -12074, -11911, -11747, -11584, -11421, -11257, -11094, -10931,
+            -10769, -10606, -10443, -10281, -10119, -9957, -9795, -9633, -9471, -9310,
+            -9148, -8987, -8826, -8665, -8504, -8343, -8183, -8022, -7862, -7702,
+            -7542, -7382, -7222, -7063, -6904, -6744, -6585, -6426, -6267, -6109,
+            -5950, -5792, -5634, -5475, -5317, -5160, -5002, -4844, -4687, -4529,
+            -4372, -4215, -4058, -3901, -3744, -3587, -3431, -3274, -3118, -2961,
+            -2805, -2649, -2492, -2336, -2180, -2024, -1868, -1712, -1557, -1401,
+            -1245, -1089, -934, -778, -622, -467, -311, -156, 0, 156,
+            311, 467, 622, 778, 934, 1089, 1245, 1401, 1557, 1712,
+            1868, 2024, 2180, 2336, 2492, 2649, 2805, 2961, 3118, 3274,
+            3431, 3587, 3744, 3901, 4058, 4215, 4372, 4529, 4687, 4844,
+            5002, 5160, 5317, 5475, 5634, 5792, 5950, 6109, 6267, 6426,
+            6585, 6744, 6904, 7063, 7222, 7382, 7542, 7702, 7862, 8022,
+            8183, 8343, 8504, 8665, 8826, 8987, 9148, 9310, 9471, 9633,
+            9795, 9957, 10119, 10281, 10443, 10606, 10769, 10931, 11094, 11257,
+            11421, 11584, 11747, 11911, 12074, 12238, 12402, 12565, 12729, 12893,
+            13057, 13221, 13386, 13550, 13714, 13878, 14043, 14207, 14372, 14536,
+            14700, 14865, 15029, 15194, 15358, 15522, 15687, 15851, 16015, 16179,
+            16343, 16507, 16671, 16835, 16999, 17162, 17326, 17489, 17652, 17815,
+            17978, 18141, 18303, 18465, 18627, 18789, 18951, 19112, 19273, 19434,
+            19594, 19754, 19914, 20073, 20233, 20391, 20550, 20708, 20865, 21023,
+            21180, 21336, 21492, 21647, 21802, 21957, 22111, 22265, 22418, 22570,
+            22722, 22873, 23024, 23174, 23323, 23472, 23620, 23768, 23915, 24061,
+            24207, 24351, 24495, 24639, 24781, 24923, 25064, 25204, 25343, 25481,
+            25619, 25756, 25891, 26026, 26160, 26293, 26425, 26556, 26686, 26816,
+            26944, 27071, 27197, 27322, 27446, 27568, 27690, 27811, 27930, 28049,
+            28166, 28282, 28396, 28510, 28622, 28733, 28843, 28952, 29059, 29165,
+            29270, 29374, 29476, 29576, 29676, 29774, 29871, 29966, 30060, 30152,
+            30243, 30333, 30421, 30507, 30593, 30676, 30759, 30839, 30918, 30996,
+            31072, 31147, 31219, 31291, 31361, 31429, 31495, 31560, 31624, 31685,
+            31746, 31804, 31861, 31916, 31969, 32021, 32071, 32120, 32166, 32211,
+            32255, 32296, 32336, 32374, 32410, 32445, 32478, 32509, 32538, 32566,
+            32592, 32616, 32638, 32659, 32678, 32695, 32710, 32723, 32735, 32745,
+            32753, 32759, 32763, 32766, 32767,
+        },
+        { // octave 7: 2 harmonics
+            32767, 32766, 32765, 32761, 32757, 32752, 32745, 32737, 32728, 32717,
+            32705, 32692, 32678, 32663, 32646, 32628, 32609, 32589, 32567, 32545,
+            32521, 32495, 32469, 32441, 32412, 32382, 32351, 32318, 32285, 32250,
+            32213, 32176, 32137, 32098, 32057, 32014, 31971, 31926, 31880, 31833,
+            31785, 31736, 31685, 31633, 31580, 31526, 31470, 31414, 31356, 31297,
+            31237, 31176, 31113, 31050, 30985, 30919, 30852, 30783, 30714, 30643,
+            30571, 30498, 30424, 30349, 30273, 30195, 30117, 30037, 29956, 29874,
+            29791, 29706, 29621, 29534, 29447, 29358, 29268, 29177, 29085, 28992,
+            28898, 28803, 28706, 28609, 28510, 28411, 28310, 28208, 28105, 28001,
+            27896, 27790, 27683, 27575, 27466, 27356, 27245, 27133, 27019, 26905,
+            26790, 26674, 26556, 26438, 26319, 26198, 26077, 25955, 25832, 25708,
+            25582, 25456, 25329, 25201, 25072, 24942, 24811, 24680, 24547, 24413,
+            24279, 24143, 24007, 23870, 23731, 23592, 23452, 23311, 23170, 23027,
+            22884, 22739, 22594, 22448, 22301, 22154, 22005, 21856, 21705, 21554,
+            21403, 21250, 21096, 20942, 20787, 20631, 20475, 20317, 20159, 20000,
+            19841, 19680, 19519, 19357, 19195, 19032, 18868, 18703, 18537, 18371,
+            18204, 18037, 17869, 17700, 17530, 17360, 17189, 17018, 16846, 16673,
+            16499, 16325, 16151, 15976, 15800, 15623, 15446, 15269, 15090, 14912,
+            14732, 14553, 14372, 14191, 14010, 13828, 13645, 13462, 13279, 13094,
+            12910, 12725, 12539, 12353, 12167, 11980, 11793, 11605, 11417, 11228,
+            11039, 10849, 10659, 10469, 10278, 10087, 9896, 9704, 9512, 9319,
+            9126, 8933, 8739, 8545, 8351, 8157, 7962, 7767, 7571, 7375,
+            7179, 6983, 6786, 6590, 6393, 6195, 5998, 5800, 5602, 5404,
+            5205, 5007, 4808, 4609, 4410, 4210, 4011, 3811, 3612, 3412,
+            3212, 3012, 2811, 2611, 2410, 2210, 2009, 1809, 1608, 1407,
+            1206, 1005, 804, 603, 402, 201, 0, -201, -402, -603,
+            -804, -1005, -1206, -1407, -1608, -1809, -2009, -2210, -2410, -2611,
+            -2811, -3012, -3212, -3412, -3612, -3811, -4011, -4210, -4410, -4609,
+            -4808, -5007, -5205, -5404, -5602, -5800, -5998, -6195, -6393, -6590,
+            -6786, -6983, -7179, -7375, -7571, -7767, -7962, -8157, -8351, -8545,
+            -8739, -8933, -9126, -9319, -9512, -9704, -9896, -10087, -10278, -10469,
+            -10659, -10849, -11039, -11228, -11417, -11605, -11793, -11980, -12167, -12353,
+            -12539, -12725, -12910, -13094, -13279, -13462, -13645, -13828, -14010, -14191,
+            -14372, -14553, -14732, -14912, -15090, -15269, -15446, -15623, -15800, -15976,
+            -16151, -16325, -16499, -16673, -16846, -17018, -17189, -17360, -17530, -17700,
+            -17869, -18037, -18204, -18371, -18537, -18703, -18868, -19032, -19195, -19357,
+            -19519, -19680, -19841, -20000, -20159, -20317, -20475, -20631, -20787, -20942,
+            -21096, -21250, -21403, -21554, -21705, -21856, -22005, -22154, -22301, -22448,
+            -22594, -22739, -22884, -23027, -23170, -23311, -23452, -23592, -23731, -23870,
+            -24007, -24143, -24279, -24413, -24547, -24680, -24811, -24942, -25072, -25201,
+            -25329, -25456, -25582, -25708, -25832, -25955, -26077, -26198, -26319, -26438,
+            -26556, -26674, -26790, -26905, -27019, -27133, -27245, -27356, -27466, -27575,
+            -27683, -27790, -27896, -28001, -28105, -28208, -28310, -28411, -28510, -28609,
+            -28706, -28803, -28898, -28992, -29085, -29177, -29268, -29358, -29447, -29534,
+            -29621, -29706, -29791, -29874, -29956, -30037, -30117, -30195, -30273, -30349,
+            -30424, -30498, -30571, -30643, -30714, -30783, -30852, -30919, -30985, -31050,
+            -31113, -31176, -31237, -31297, -31356, -31414, -31470, -31526, -31580, -31633,
+            -31685, -31736, -31785, -31833, -31880, -31926, -31971, -32014, -32057, -32098,
+            -32137, -32176, -32213, -32250, -32285, -32318, -32351, -32382, -32412, -32441,
+            -32469, -32495, -32521, -32545, -32567, -32589, -32609, -32628, -32646, -32663,
+            -32678, -32692, -32705, -32717, -32728, -32737, -32745, -32752, -32757, -32761,
+            -32765, -32766, -32767, -32766, -32765, -32761, -32757, -32752, -32745, -32737,
+            -32728, -32717, -32705, -32692, -32678, -32663, -32646, -32628, -32609, -32589,
+            -32567, -32545, -32521, -32495, -32469, -32441, -32412, -32382, -32351, -32318,
+            -32285, -32250, -32213, -32176, -32137, -32098, -32057, -32014, -31971, -31926,
+            -31880, -31833, -31785, -31736, -31685, -31633, -31580, -31526, -31470, -31414,
+            -31356, -31297, -31237, -31176, -31113, -31050, -30985, -30919, -30852, -30783,
+            -30714, -30643, -30571, -30498, -30424, -30349, -30273, -30195, -30117, -30037,
+            -29956, -29874, -29791, -29706, -29621, -29534, -29447, -29358, -29268, -29177,
+            -29085, -28992, -28898, -28803, -28706, -28609, -28510, -28411, -28310, -28208,
+            -28105, -28001, -27896, -27790, -27683, -27575, -27466, -27356, -27245, -27133,
+            -27019, -26905, -26790, -26674, -26556, -26438, -26319, -26198, -26077, -25955,
+            -25832, -25708, -25582, -25456, -25329, -25201, -25072, -24942, -24811, -24680,
+            -24547, -24413, -24279, -24143, -24007, -23870, -23731, -23592, -23452, -23311,
+            -23170, -23027, -22884, -22739, -22594, -22448, -22301, -22154, -22005, -21856,
+            -21705, -21554, -21403, -21250, -21096, -20942, -20787, -20631, -20475, -20317,
+            -20159, -20000, -19841, -19680, -19519, -19357, -19195, -19032, -18868, -18703,
+            -18537, -18371, -18204, -18037, -17869, -17700, -17530, -17360, -17189, -17018,
+            -16846, -16673, -16499, -16325, -16151, -15976, -15800, -15623, -15446, -15269,
+            -15090, -14912, -14732, -14553, -14372, -14191, -14010, -13828, -13645, -13462,
+            -13279, -13094, -12910, -12725, -12539, -12353, -12167, -11980, -11793, -11605,
+            -11417, -11228, -11039, -10849, -10659, -10469, -10278, -10087, -9896, -9704,
+            -9512, -9319, -9126, -8933, -8739, -8545, -8351, -8157, -7962, -7767,
+            -7571, -7375, -7179, -6983, -6786, -6590, -6393, -6195, -5998, -5800,
+            -5602, -5404, -5205, -5007, -4808, -4609, -4410, -4210, -4011, -3811,
+            -3612, -3412, -3212, -3012, -2811, -2611, -2410, -2210, -2009, -1809,
+            -1608, -1407, -1206, -1005, -804, -603, -402, -201, 0, 201,
+            402, 603, 804, 1005, 1206, 1407, 1608, 1809, 2009, 2210,
+            2410, 2611, 2811, 3012, 3212, 3412, 3612, 3811, 4011, 4210,
+            4410, 4609, 4808, 5007, 5205, 5404, 5602, 5800, 5998, 6195,
+            6393, 6590, 6786, 6983, 7179, 7375, 7571, 7767, 7962, 8157,
+            8351, 8545, 8739, 8933, 9126, 9319, 9512, 9704, 9896, 10087,
+            10278, 10469, 10659, 10849, 11039, 11228, 11417, 11605, 11793, 11980,
+            12167, 12353, 12539, 12725, 12910, 13094, 13279, 13462, 13645, 13828,
+            14010, 14191, 14372, 14553, 14732, 14912, 15090, 15269, 15446, 15623,
+            15800, 15976, 16151, 16325, 16499, 16673, 16846, 17018, 17189, 17360,
+            17530, 17700, 17869, 18037, 18204, 18371, 18537, 18703, 18868, 19032,
+            19195, 19357, 19519, 19680, 19841, 20000, 20159, 20317, 20475, 20631,
+            20787, 20942, 21096, 21250, 21403, 21554, 21705, 21856, 22005, 22154,
+            22301, 22448, 22594, 22739, 22884, 23027, 23170, 23311, 23452, 23592,
+            23731, 23870, 24007, 24143, 24279, 24413, 24547, 24680, 24811, 24942,
+            25072, 25201, 25329, 25456, 25582, 25708, 25832, 25955, 26077, 26198,
+            26319, 26438, 26556, 26674, 26790, 26905, 27019, 27133, 27245, 27356,
+            27466, 27575, 27683, 27790, 27896, 28001, 28105, 28208, 28310, 28411,
+            28510, 28609, 28706, 28803, 28898, 28992, 29085, 29177, 29268, 29358,
+            29447, 29534, 29621, 29706, 29791, 29874, 29956, 30037, 30117, 30195,
+            30273, 30349, 30424, 30498, 30571, 30643, 30714, 30783, 30852, 30919,
+            30985, 31050, 31113, 31176, 31237, 31297, 31356, 31414, 31470, 31526,
+            31580, 31633, 31685, 31736, 31785, 31833, 31880, 31926, 31971, 32014,
+            32057, 32098, 32137, 32176, 32213, 32250, 32285, 32318, 32351, 32382,
+            32412, 32441, 32469, 32495, 32521, 32545, 32567, 32589, 32609, 32628,
+            32646, 32663, 32678, 32692, 32705, 32717, 32728, 32737, 32745, 32752,
+            32757, 32761, 32765, 32766, 32767,
+        },
+        { // octave 8: 1 harmonics
+            32767, 32766, 32765, 32761, 32757, 32752, 32745, 32737, 32728, 32717,
+            32705, 32692, 32678, 32663, 32646, 32628, 32609, 32589, 32567, 32545,
+            32521, 32495, 32469, 32441, 32412, 32382, 32351, 32318, 32285, 32250,
+            32213, 32176, 32137, 32098, 32057, 32014, 31971, 31926, 31880, 31833,
+            31785, 31736, 31685, 31633, 31580, 31526, 31470, 31414, 31356, 31297,
+            31237, 31176, 31113, 31050, 30985, 30919, 30852, 30783, 30714, 30643,
+            30571, 30498, 30424, 30349, 30273, 30195, 30117, 30037, 29956, 29874,
+            29791, 29706, 29621, 29534, 29447, 29358, 29268, 29177, 29085, 28992,
+            28898, 28803, 28706, 28609, 28510, 28411, 28310, 28208, 28105, 28001,
+            27896, 27790, 27683, 27575, 27466, 27356, 27245, 27133, 27019, 26905,
+            26790, 26674, 26556, 26438, 26319, 26198, 26077, 25955, 25832, 25708,
+            25582, 25456, 25329, 25201, 25072, 24942, 24811, 24680, 24547, 24413,
+            24279, 24143, 24007, 23870, 23731, 23592, 23452, 23311, 23170, 23027,
+            22884, 22739, 22594, 22448, 22301, 22154, 22005, 21856, 21705, 21554,
+            21403, 21250, 21096, 20942, 20787, 20631, 20475, 20317, 20159, 20000,
+            19841, 19680, 19519, 19357, 19195, 19032, 18868, 18703, 18537, 18371,
+            18204, 18037, 17869, 17700, 17530, 17360, 17189, 17018, 16846, 16673,
+            16499, 16325, 16151, 15976, 15800, 15623, 15446, 15269, 15090, 14912,
+            14732, 14553, 14372, 14191, 14010, 13828, 13645, 13462, 13279, 13094,
+            12910, 12725, 12539, 12353, 12167, 11980, 11793, 11605, 11417, 11228,
+            11039, 10849, 10659, 10469, 10278, 10087, 9896, 9704, 9512, 9319,
+            9126, 8933, 8739, 8545, 8351, 8157, 7962, 7767, 7571, 7375,
+            7179, 6983, 6786, 6590, 6393, 6195, 5998, 5800, 5602, 5404,
+            5205, 5007, 4808, 4609, 4410, 4210, 4011, 3811, 3612, 3412,
+            3212, 3012, 2811, 2611, 2410, 2210, 2009, 1809, 1608, 1407,
+            1206, 1005, 804, 603, 402, 201, 0, -201, -402, -603,
+            -804, -1005, -1206, -1407, -1608, -1809, -2009, -2210, -2410, -2611,
+            -2811, -3012, -3212, -3412, -3612, -3811, -4011, -4210, -4410, -4609,
+            -4808, -5007, -5205, -5404, -5602, -5800, -5998, -6195, -6393, -6590,
+            -6786, -6983, -7179, -7375, -7571, -7767, -7962, -8157, -8351, -8545,
+            -8739, -8933, -9126, -9319, -9512, -9704, -9896, -10087, -10278, -10469,
+            -10659, -10849, -11039, -11228, -11417, -11605, -11793, -11980, -12167, -12353,
+            -12539, -12725, -12910, -13094, -13279, -13462, -13645, -13828, -14010, -14191,
+            -14372, -14553, -14732, -14912, -15090, -15269, -15446, -15623, -15800, -15976,
+            -16151, -16325, -16499, -16673, -16846, -17018, -17189, -17360, -17530, -17700,
+            -17869, -18037, -18204, -18371, -18537, -18703, -18868, -19032, -19195, -19357,
+            -19519, -19680, -19841, -20000, -20159, -20317, -20475, -20631, -20787, -20942,
+            -21096, -21250, -21403, -21554, -21705, -21856, -22005, -22154, -22301, -22448,
+            -22594, -22739, -22884, -23027, -23170, -23311, -23452, -23592, -23731, -23870,
+            -24007, -24143, -24279, -24413, -24547, -24680, -24811, -24942, -25072, -25201,
+            -25329, -25456, -25582, -25708, -25832, -25955, -26077, -26198, -26319, -26438,
+            -26556, -26674, -26790, -26905, -27019, -27133, -27245, -27356, -27466, -27575,
+            -27683, -27790, -27896, -28001, -28105, -28208, -28310, -28411, -28510, -28609,
+            -28706, -28803, -28898, -28992, -29085, -29177, -29268, -29358, -29447, -29534,
+            -29621, -29706, -29791, -29874, -29956, -30037, -30117, -30195, -30273, -30349,
+            -30424, -30498, -30571, -30643, -30714, -30783, -30852, -30919, -30985, -31050,
+            -31113, -31176, -31237, -31297, -31356, -31414, -31470, -31526, -31580, -31633,
+            -31685, -31736, -31785, -31833, -31880, -31926, -31971, -32014, -32057, -32098,
+            -32137, -32176, -32213, -32250, -32285, -32318, -32351, -32382, -32412, -32441,
+            -32469, -32495, -32521, -32545, -32567, -32589, -32609, -32628, -32646, -32663,
+            -32678, -32692, -32705, -32717, -32728, -32737, -32745, -32752, -32757, -32761,
+            -32765, -32766, -32767, -32766, -32765, -32761, -32757, -32752, -32745, -32737,
+            -32728, -32717, -32705, -32692, -32678, -32663, -32646, -32628, -32609, -32589,
+            -32567, -32545, -32521, -32495, -32469, -32441, -32412, -32382, -32351, -32318,
+            -32285, -32250, -32213, -32176, -32137, -32098, -32057, -32014, -31971, -31926,
+            -31880, -31833, -31785, -31736, -31685, -31633, -31580, -31526, -31470, -31414,
+            -31356, -31297, -31237, -31176, -31113, -31050, -30985, -30919, -30852, -30783,
+            -30714, -30643, -30571, -30498, -30424, -30349, -30273, -30195, -30117, -30037,
+            -29956, -29874, -29791, -29706, -29621, -29534, -29447, -29358, -29268, -29177,
+            -29085, -28992, -28898, -28803, -28706, -28609, -28510, -28411, -28310, -28208,
+            -28105, -28001, -27896, -27790, -27683, -27575, -27466, -27356, -27245, -27133,
+            -27019, -26905, -26790, -26674, -26556, -26438, -26319, -26198, -26077, -25955,
+            -25832, -25708, -25582, -25456, -25329, -25201, -25072, -24942, -24811, -24680,
+            -24547, -24413, -24279, -24143, -24007, -23870, -23731, -23592, -23452, -23311,
+            -23170, -23027, -22884, -22739, -22594, -22448, -22301, -22154, -22005, -21856,
+            -21705, -21554, -21403, -21250, -21096, -20942, -20787, -20631, -20475, -20317,
+            -20159, -20000, -19841, -19680, -19519, -19357, -19195, -19032, -18868, -18703,
+            -18537, -18371, -18204, -18037, -17869, -17700, -17530, -17360, -17189, -17018,
+            -16846, -16673, -16499, -16325, -16151, -15976, -15800, -15623, -15446, -15269,
+            -15090, -14912, -14732, -14553, -14372, -14191, -14010, -13828, -13645, -13462,
+            -13279, -13094, -12910, -12725, -12539, -12353, -12167, -11980, -11793, -11605,
+            -11417, -11228, -11039, -10849, -10659, -10469, -10278, -10087, -9896, -9704,
+            -9512, -9319, -9126, -8933, -8739, -8545, -8351, -8157, -7962, -7767,
+            -7571, -7375, -7179, -6983, -6786, -6590, -6393, -6195, -5998, -5800,
+            -5602, -5404, -5205, -5007, -4808, -4609, -4410, -4210, -4011, -3811,
+            -3612, -3412, -3212, -3012, -2811, -2611, -2410, -2210, -2009, -1809,
+            -1608, -1407, -1206, -1005, -804, -603, -402, -201, 0, 201,
+            402, 603, 804, 1005, 1206, 1407, 1608, 1809, 2009, 2210,
+            2410, 2611, 2811, 3012, 3212, 3412, 3612, 3811, 4011, 4210,
+            4410, 4609, 4808, 5007, 5205, 5404, 5602, 5800, 5998, 6195,
+            6393, 6590, 6786, 6983, 7179, 7375, 7571, 7767, 7962, 8157,
+            8351, 8545, 8739, 8933, 9126, 9319, 9512, 9704, 9896, 10087,
+            10278, 10469, 10659, 10849, 11039, 11228, 11417, 11605, 11793, 11980,
+            12167, 12353, 12539, 12725, 12910, 13094, 13279, 13462, 13645, 13828,
+            14010, 14191, 14372, 14553, 14732, 14912, 15090, 15269, 15446, 15623,
+            15800, 15976, 16151, 16325, 16499, 16673, 16846, 17018, 17189, 17360,
+            17530, 17700, 17869, 18037, 18204, 18371, 18537, 18703, 18868, 19032,
+            19195, 19357, 19519, 19680, 19841, 20000, 20159, 20317, 20475, 20631,
+            20787, 20942, 21096, 21250, 21403, 21554, 21705, 21856, 22005, 22154,
+            22301, 22448, 22594, 22739, 22884, 23027, 23170, 23311, 23452, 23592,
+            23731, 23870, 24007, 24143, 24279, 24413, 24547, 24680, 24811, 24942,
+            25072, 25201, 25329, 25456, 25582, 25708, 25832, 25955, 26077, 26198,
+            26319, 26438, 26556, 26674, 26790, 26905, 27019, 27133, 27245, 27356,
+            27466, 27575, 27683, 27790, 27896, 28001, 28105, 28208, 28310, 28411,
+            28510, 28609, 28706, 28803, 28898, 28992, 29085, 29177, 29268, 29358,
+            29447, 29534, 29621, 29706, 29791, 29874, 29956, 30037, 30117, 30195,
+            30273, 30349, 30424, 30498, 30571, 30643, 30714, 30783, 30852, 30919,
+            30985, 31050, 31113, 31176, 31237, 31297, 31356, 31414, 31470, 31526,
+            31580, 31633, 31685, 31736, 31785, 31833, 31880, 31926, 31971, 32014,
+            32057, 32098, 32137, 32176, 32213, 32250, 32285, 32318, 32351, 32382,
+            32412, 32441, 32469, 32495, 32521, 32545, 32567, 32589, 32609, 32628,
+            32646, 32663, 32678, 32692, 32705, 32717, 32728, 32737, 32745, 32752,
+            32757, 32761, 32765, 32766, 32767,
+        },
+    },
+    { // saw
+        { // octave 0: 256 harmonics
+            0, -17755, -29093, -32767, -32351, -31689, -31837, -32021, -31831, -31634,
+            -31655, -31675, -31552, -31433, -31414, -31392, -31294, -31201, -31165, -31126,
+            -31040, -30958, -30914, -30866, -30787, -30711, -30662, -30610, -30534, -30462,
+            -30410, -30354, -30282, -30212, -30158, -30100, -30030, -29961, -29905, -29847,
+            -29777, -29710, -29653, -29593, -29525, -29459, -29400, -29340, -29273, -29207,
+            -29148, -29087, -29020, -28955, -28896, -28834, -28768, -28703, -28643, -28582,
+            -28516, -28451, -28391, -28329, -28263, -28199, -28138, -28076, -28011, -27947,
+            -27886, -27824, -27759, -27695, -27634, -27571, -27506, -27443, -27381, -27319,
+            -27254, -27190, -27129, -27066, -27002, -26938, -26877, -26814, -26749, -26686,
+            -26624, -26561, -26497, -26434, -26372, -26309, -26245, -26181, -26119, -26057,
+            -25992, -25929, -25867, -25804, -25740, -25677, -25615, -25552, -25488, -25424,
+            -25362, -25299, -25235, -25172, -25110, -25047, -24983, -24920, -24858, -24795,
+            -24731, -24667, -24605, -24542, -24478, -24415, -24353, -24290, -24226, -24163,
+            -24100, -24037, -23974, -23910, -23848, -23785, -23721, -23658, -23596, -23533,
+            -23469, -23406, -23343, -23280, -23217, -23153, -23091, -23028, -22964, -22901,
+            -22839, -22775, -22712, -22649, -22586, -22523, -22459, -22396, -22334, -22271,
+            -22207, -22144, -22082, -22018, -21955, -21892, -21829, -21766, -21702, -21639,
+            -21577, -21514, -21450, -21387, -21324, -21261, -21198, -21135, -21072, -21009,
+            -20945, -20882, -20820, -20756, -20693, -20630, -20567, -20504, -20441, -20378,
+            -20315, -20252, -20188, -20125, -20063, -19999, -19936, -19873, -19810, -19747,
+            -19684, -19621, -19558, -19495, -19431, -19368, -19306, -19242, -19179, -19116,
+            -19053, -18990, -18927, -18864, -18801, -18738, -18674, -18611, -18548, -18485,
+            -18422, -18359, -18296, -18233, -18170, -18107, -18044, -17980, -17917, -17854,
+            -17791, -17728, -17665, -17602, -17539, -17476, -17412, -17350, -17287, -17223,
+            -17160, -17097, -17034, -16971, -16908, -16845, -16782, -16719, -16655, -16592,
+            -16530, -16466, -16403, -16340, -16277, -16214, -16151, -16088, -16025, -15962,
+            -15898, -15835, -15772, -15709, -15646, -15583, -15520, -15457, -15394, -15331,
+            -15268, -15204, -15141, -15078, -15015, -14952, -14889, -14826, -14763, -14700,
+            -14637, -14574, -14511, -14447, -14384, -14321, -14258, -14195, -14132, -14069,
+            -14006, -13943, -13880, -13817, -13754, -13690, -13627, -13564, -13501, -13438,
+            -13375, -13312, -13249, -13186, -13122, -13060, -12996, -12933, -12870, -12807,
+            -12744, -12681, -12618, -12555, -12492, -12429, -12365, -12302, -12239, -12176,
+            -12113, -12050, -11987, -11924, -11861, -11798, -11735, -11671, -11608, -11545,
+            -11482, -11419, -11356, -11293, -11230, -11167, -11104, -11041, -10978, -10914,
+            -10851, -10788, -10725, -10662, -10599, -10536, -10473, -10410, -10347, -10284,
+            -10221, -10157, -10094, -10031, -9968, -9905, -9842, -9779, -9716, -9653,
+            -9589, -9527, -9463, -9400, -9337, -9274, -9211, -9148, -9085, -9022,
+            -8959, -8896, -8832, -8769, -8706, -8643, -8580, -8517, -8454, -8391,
+            -8328, -8265, -8202, -8138, -8075, -8012, -7949, -7886, -7823, -7760,
+            -7697, -7634, -7571, -7508, -7445, -7381, -7318, -7255, -7192, -7129,
+            -7066, -7003, -6940, -6877, -6814, -6751, -6688, -6624, -6561, -6498,
+            -6435, -6372, -6309, -6246, -6183, -6120, -6057, -5994, -5930, -5867,
+            -5804, -5741, -5678, -5615, -5552, -5489, -5426, -5363, -5299, -5236,
+            -5173, -5110, -5047, -4984, -4921, -4858, -4795, -4732, -4669, -4605,
+            -4542, -4479, -4416, -4353, -4290, -4227, -4164, -4101, -4038, -3975,
+            -3912, -3848, -3785, -3722, -3659, -3596, -3533, -3470, -3407, -3344,
+            -3281, -3218, -3154, -3091, -3028, -2965, -2902, -2839, -2776, -2713,
+            -2650, -2587, -2524, -2461, -2397, -2334, -2271, -2208, -2145, -2082,
+            -2019, -1956, -1893, -1830, -1766, -1703, -1640, -1577, -1514, -1451,
+            -1388, -1325, -1262, -1199, -1136, -1072, -1009, -946, -883, -820,
+            -757, -694, -631, -568, -505, -442, -379, -315, -252, -189,
+            -126, -63, 0, 63, 126, 189, 252, 315, 379, 442,
+            505, 568, 631, 694, 757, 820, 883, 946, 1009, 1072,
+            1136, 1199, 1262, 1325, 1388, 1451, 1514, 1577, 1640, 1703,
+            1766, 1830, 1893, 1956, 2019, 2082, 2145, 2208, 2271, 2334,
+            2397, 2461, 2524, 2587, 2650, 2713, 2776, 2839, 2902, 2965,
+            3028, 3091, 3154, 3218, 3281, 3344, 3407, 3470, 3533, 3596,
+            3659, 3722, 3785, 3848, 3912, 3975, 4038, 4101, 4164, 4227,
+            4290, 4353, 4416, 4479, 4542, 4605, 4669, 4732, 4795, 4858,
+            4921, 4984, 5047, 5110, 5173, 5236, 5299, 5363, 5426, 5489,
+            5552, 5615, 5678, 5741, 5804, 5867, 5930, 5994, 6057, 6120,
+            6183, 6246, 6309, 6372, 6435, 6498, 6561, 6624, 6688, 6751,
+            6814, 6877, 6940, 7003, 7066, 7129, 7192, 7255, 7318, 7381,
+            7445, 7508, 7571, 7634, 7697, 7760, 7823, 7886, 7949, 8012,
+            8075, 8138, 8202, 8265, 8328, 8391, 8454, 8517, 8580, 8643,
+            8706, 8769, 8832, 8896, 8959, 9022, 9085, 9148, 9211, 9274,
+            9337, 9400, 9463, 9527, 9589, 9653, 9716, 9779, 9842, 9905,
+            9968, 10031, 10094, 10157, 10221, 10284, 10347, 10410, 10473, 10536,
+            10599, 10662, 10725, 10788, 10851, 10914, 10978, 11041, 11104, 11167,
+            11230, 11293, 11356, 11419, 11482, 11545, 11608, 11671, 11735, 11798,
+            11861, 11924, 11987, 12050, 12113, 12176, 12239, 12302, 12365, 12429,
+            12492, 12555, 12618, 12681, 12744, 12807, 12870, 12933, 12996, 13060,
+            13122, 13186, 13249, 13312, 13375, 13438, 13501, 13564, 13627, 13690,
+            13754, 13817, 13880, 13943, 14006, 14069, 14132, 14195, 14258, 14321,
+            14384, 14447, 14511, 14574, 14637, 14700, 14763, 14826, 14889, 14952,
+            15015, 15078, 15141, 15204, 15268, 15331, 15394, 15457, 15520, 15583,
+            15646, 15709, 15772, 15835, 15898, 15962, 16025, 16088, 16151, 16214,
+            16277, 16340, 16403, 16466, 16530, 16592, 16655, 16719, 16782, 16845,
+            16908, 16971, 17034, 17097, 17160, 17223, 17287, 17350, 17412, 17476,
+            17539, 17602, 17665, 17728, 17791, 17854, 17917, 17980, 18044, 18107,
+            18170, 18233, 18296, 18359, 18422, 18485, 18548, 18611, 18674, 18738,
+            18801, 18864, 18927, 18990, 19053, 19116, 19179, 19242, 19306, 19368,
+            19431, 19495, 19558, 19621, 19684, 19747, 19810, 19873, 19936, 19999,
+            20063, 20125, 20188, 20252, 20315, 20378, 20441, 20504, 20567, 20630,
+            20693, 20756, 20820, 20882, 20945, 21009, 21072, 21135, 21198, 21261,
+            21324, 21387, 21450, 21514, 21577, 21639, 21702, 21766, 21829, 21892,
+            21955, 22018, 22082, 22144, 22207, 22271, 22334, 22396, 22459, 22523,
+            22586, 22649, 22712, 22775, 22839, 22901, 22964, 23028, 23091, 23153,
+            23217, 23280, 23343, 23406, 23469, 23533, 23596, 23658, 23721, 23785,
+            23848, 23910, 23974, 24037, 24100, 24163, 24226, 24290, 24353, 24415,
+            24478, 24542, 24605, 24667, 24731, 24795, 24858, 24920, 24983, 25047,
+            25110, 25172, 25235, 25299, 25362, 25424, 25488, 25552, 25615, 25677,
+            25740, 25804, 25867, 25929, 25992, 26057, 26119, 26181, 26245, 26309,
+            26372, 26434, 26497, 26561, 26624, 26686, 26749, 26814, 26877, 26938,
+            27002, 27066, 27129, 27190, 27254, 27319, 27381, 27443, 27506, 27571,
+            27634, 27695, 27759, 27824, 27886, 27947, 28011, 28076, 28138, 28199,
+            28263, 28329, 28391, 28451, 28516, 28582, 28643, 28703, 28768, 28834,
+            28896, 28955, 29020, 29087, 29148, 29207, 29273, 29340, 29400, 29459,
+            29525, 29593, 29653, 29710, 29777, 29847, 29905, 29961, 30030, 30100,
+            30158, 30212, 30282, 30354, 30410, 30462, 30534, 30610, 30662, 30711,
+            30787, 30866, 30914, 30958, 31040, 31126, 31165, 31201, 31294, 31392,
+            31414, 31433, 31552, 31675, 31655, 31634, 31831, 32021, 31837, 31689,
+            32351, 32767, 29093, 17755, 0,
+        },
+        { // octave 1: 128 harmonics
+            0, -9413, -17849, -24560, -29183, -31782, -32767, -32731, -32261, -31793,
+            -31543, -31528, -31640, -31745, -31754, -31653, -31492, -31337, -31237, -31200,
+            -31200, -31194, -31151, -31067, -30960, -30858, -30781, -30733, -30702, -30667,
+            -30613, -30536, -30448, -30363, -30294, -30241, -30197, -30150, -30091, -30019,
+            -29939, -29863, -29796, -29741, -29690, -29638, -29576, -29506, -29431, -29359,
+            -29294, -29237, -29183, -29127, -29065, -28996, -28924, -28854, -28790, -28732,
+            -28675, -28617, -28554, -28486, -28417, -28349, -28285, -28226, -28168, -28108,
+            -28045, -27978, -27909, -27842, -27779, -27719, -27660, -27600, -27536, -27470,
+            -27402, -27336, -27273, -27212, -27153, -27091, -27028, -26961, -26895, -26829,
+            -26766, -26705, -26645, -26583, -26519, -26454, -26387, -26322, -26259, -26198,
+            -26137, -26075, -26011, -25946, -25880, -25815, -25752, -25691, -25630, -25567,
+            -25503, -25438, -25373, -25308, -25245, -25184, -25122, -25060, -24996, -24930,
+            -24865, -24801, -24738, -24676, -24614, -24552, -24488, -24423, -24358, -24294,
+            -24231, -24169, -24107, -24044, -23980, -23915, -23850, -23786, -23724, -23662,
+            -23599, -23536, -23472, -23408, -23343, -23279, -23216, -23154, -23092, -23029,
+            -22965, -22900, -22836, -22772, -22709, -22647, -22584, -22521, -22457, -22393,
+            -22328, -22265, -22202, -22139, -22077, -22013, -21949, -21885, -21821, -21757,
+            -21694, -21632, -21569, -21506, -21442, -21377, -21313, -21250, -21187, -21124,
+            -21062, -20998, -20934, -20870, -20806, -20742, -20680, -20617, -20554, -20491,
+            -20427, -20362, -20298, -20235, -20172, -20109, -20047, -19983, -19919, -19855,
+            -19791, -19728, -19665, -19602, -19539, -19476, -19412, -19347, -19284, -19220,
+            -19157, -19094, -19031, -18968, -18904, -18840, -18776, -18713, -18650, -18587,
+            -18524, -18460, -18396, -18332, -18269, -18205, -18142, -18080, -18016, -17953,
+            -17889, -17825, -17761, -17698, -17635, -17572, -17509, -17445, -17381, -17317,
+            -17254, -17190, -17128, -17065, -17001, -16938, -16874, -16810, -16746, -16683,
+            -16620, -16557, -16494, -16430, -16366, -16302, -16239, -16176, -16113, -16050,
+            -15986, -15923, -15859, -15795, -15731, -15668, -15605, -15542, -15479, -15415,
+            -15351, -15288, -15224, -15161, -15098, -15035, -14971, -14908, -14844, -14780,
+            -14717, -14653, -14590, -14527, -14464, -14400, -14336, -14273, -14209, -14146,
+            -14083, -14020, -13956, -13893, -13829, -13765, -13702, -13638, -13575, -13512,
+            -13449, -13385, -13321, -13258, -13194, -13131, -13068, -13005, -12941, -12878,
+            -12814, -12750, -12687, -12623, -12560, -12497, -12434, -12370, -12306, -12243,
+            -12179, -12116, -12053, -11990, -11926, -11863, -11799, -11735, -11672, -11609,
+            -11545, -11482, -11419, -11355, -11291, -11228, -11164, -11101, -11038, -10975,
+            -10911, -10848, -10784, -10720, -10657, -10594, -10531, -10467, -10404, -10340,
+            -10276, -10213, -10149, -10086, -10023, -9960, -9896, -9833, -9769, -9705,
+            -9642, -9579, -9516, -9452, -9389, -9325, -9261, -9198, -9134, -9071,
+            -9008, -8945, -8881, -8818, -8754, -8690, -8627, -8564, -8501, -8437,
+            -8374, -8310, -8246, -8183, -8119, -8056, -7993, -7930, -7866, -7803,
+            -7739, -7675, -7612, -7549, -7486, -7422, -7359, -7295, -7231, -7168,
+            -7105, -7041, -6978, -6915, -6851, -6788, -6724, -6660, -6597, -6534,
+            -6471, -6407, -6344, -6280, -6216, -6153, -6090, -6026, -5963, -5900,
+            -5836, -5773, -5709, -5645, -5582, -5519, -5456, -5392, -5329, -5265,
+            -5201, -5138, -5075, -5012, -4948, -4885, -4821, -4758, -4694, -4630,
+            -4567, -4504, -4441, -4377, -4314, -4250, -4186, -4123, -4060, -3997,
+            -3933, -3870, -3806, -3743, -3679, -3616, -3552, -3489, -3426, -3362,
+            -3299, -3235, -3171, -3108, -3045, -2982, -2918, -2855, -2791, -2728,
+            -2664, -2601, -2537, -2474, -2411, -2347, -2284, -2220, -2157, -2093,
+            -2030, -1967, -1903, -1840, -1776, -1713, -1649, -1586, -1522, -1459,
+            -1396, -1332, -1269, -1205, -1142, -1078, -1015, -952, -888, -825,
+            -761, -698, -634, -571, -507, -444, -381, -317, -254, -190,
+            -127, -63, 0, 63, 127, 190, 254, 317, 381, 444,
+            507, 571, 634, 698, 761, 825, 888, 952, 1015, 1078,
+            1142, 1205, 1269, 1332, 1396, 1459, 1522, 1586, 1649, 1713,
+            1776, 1840, 1903, 1967, 2030, 2093, 2157, 2220, 2284, 2347,
+            2411, 2474, 2537, 2601, 2664, 2728, 2791, 2855, 2918, 2982,
+            3045, 3108, 3171, 3235, 3299, 3362, 3426, 3489, 3552, 3616,
+            3679, 3743, 3806, 3870, 3933, 3997, 4060, 4123, 4186, 4250,
+            4314, 4377, 4441, 4504, 4567, 4630, 4694, 4758, 4821, 4885,
+            4948, 5012, 5075, 5138, 5201, 5265, 5329, 5392, 5456, 5519,
+            5582, 5645, 5709, 5773, 5836, 5900, 5963, 6026, 6090, 6153,
+            6216, 6280, 6344, 6407, 6471, 6534, 6597, 6660, 6724, 6788,
+            6851, 6915, 6978, 7041, 7105, 7168, 7231, 7295, 7359, 7422,
+            7486, 7549, 7612, 7675, 7739, 7803, 7866, 7930, 7993, 8056,
+            8119, 8183, 8246, 8310, 8374, 8437, 8501, 8564, 8627, 8690,
+            8754, 8818, 8881, 8945, 9008, 9071, 9134, 9198, 9261, 9325,
+            9389, 9452, 9516, 9579, 9642, 9705, 9769, 9833, 9896, 9960,
+            10023, 10086, 10149, 10213, 10276, 10340, 10404, 10467, 10531, 10594,
+            10657, 10720, 10784, 10848, 10911, 10975, 11038, 11101, 11164, 11228,
+            11291, 11355, 11419, 11482, 11545, 11609, 11672, 11735, 11799, 11863,
+            11926, 11990, 12053, 12116, 12179, 12243, 12306, 12370, 12434, 12497,
+            12560, 12623, 12687, 12750, 12814, 12878, 12941, 13005, 13068, 13131,
+            13194, 13258, 13321, 13385, 13449, 13512, 13575, 13638, 13702, 13765,
+            13829, 13893, 13956, 14020, 14083, 14146, 14209, 14273, 14336, 14400,
+            14464, 14527, 14590, 14653, 14717, 14780, 14844, 14908, 14971, 15035,
+            15098, 15161, 15224, 15288, 15351, 15415, 15479, 15542, 15605, 15668,
+            15731, 15795, 15859, 15923, 15986, 16050, 16113, 16176, 16239, 16302,
+            16366, 16430, 16494, 16557, 16620, 16683, 16746, 16810, 16874, 16938,
+            17001, 17065, 17128, 17190, 17254, 17317, 17381, 17445, 17509, 17572,
+            17635, 17698, 17761, 17825, 17889, 17953, 18016, 18080, 18142, 18205,
+            18269, 18332, 18396, 18460, 18524, 18587, 18650, 18713, 18776, 18840,
+            18904, 18968, 19031, 19094, 19157, 19220, 19284, 19347, 19412, 19476,
+            19539, 19602, 19665, 19728, 19791, 19855, 19919, 19983, 20047, 20109,
+            20172, 20235, 20298, 20362, 20427, 20491, 20554, 20617, 20680, 20742,
+            20806, 20870, 20934, 20998, 21062, 21124, 21187, 21250, 21313, 21377,
+            21442, 21506, 21569, 21632, 21694, 21757, 21821, 21885, 21949, 22013,
+            22077, 22139, 22202, 22265, 22328, 22393, 22457, 22521, 22584, 22647,
+            22709, 22772, 22836, 22900, 22965, 23029, 23092, 23154, 23216, 23279,
+            23343, 23408, 23472, 23536, 23599, 23662, 23724, 23786, 23850, 23915,
+            23980, 24044, 24107, 24169, 24231, 24294, 24358, 24423, 24488, 24552,
+            24614, 24676, 24738, 24801, 24865, 24930, 24996, 25060, 25122, 25184,
+            25245, 25308, 25373, 25438, 25503, 25567, 25630, 25691, 25752, 25815,
+            25880, 25946, 26011, 26075, 26137, 26198, 26259, 26322, 26387, 26454,
+            26519, 26583, 26645, 26705, 26766, 26829, 26895, 26961, 27028, 27091,
+            27153, 27212, 27273, 27336, 27402, 27470, 27536, 27600, 27660, 27719,
+            27779, 27842, 27909, 27978, 28045, 28108, 28168, 28226, 28285, 28349,
+            28417, 28486, 28554, 28617, 28675, 28732, 28790, 28854, 28924, 28996,
+            29065, 29127, 29183, 29237, 29294, 29359, 29431, 29506, 29576, 29638,
+            29690, 29741, 29796, 29863, 29939, 30019, 30091, 30150, 30197, 30241,
+            30294, 30363, 30448, 30536, 30613, 30667, 30702, 30733, 30781, 30858,
+            30960, 31067, 31151, 31194, 31200, 31200, 31237, 31337, 31492, 31653,
+            31754, 31745, 31640, 31528, 31543, 31793, 32261, 32731, 32767, 31782,
+            29183, 24560, 17849, 9413, 0,
+        },
+        { // octave 2: 64 harmonics
+            0, -4826, -9520, -13957, -18030, -21651, -24761, -27327, -29347, -30844,
+            -31864, -32474, -32748, -32767, -32612, -32355, -32059, -31773, -31529, -31347,
+            -31230, -31175, -31167, -31189, -31223, -31250, -31259, -31241, -31192, -31115,
+            -31016, -30903, -30785, -30671, -30568, -30481, -30412, -30359, -30319, -30287,
+            -30257, -30224, -30183, -30132, -30069, -29996, -29914, -29827, -29740, -29654,
+            -29575, -29503, -29440, -29383, -29333, -29286, -29239, -29190, -29136, -29077,
+            -29011, -28941, -28866, -28788, -28711, -28636, -28564, -28497, -28435, -28376,
+            -28321, -28268, -28214, -28158, -28100, -28037, -27971, -27902, -27831, -27758,
+            -27686, -27615, -27547, -27481, -27419, -27360, -27302, -27245, -27188, -27129,
+            -27068, -27004, -26938, -26870, -26800, -26730, -26661, -26592, -26526, -26462,
+            -26399, -26339, -26280, -26221, -26161, -26101, -26038, -25974, -25908, -25841,
+            -25772, -25704, -25636, -25569, -25503, -25439, -25377, -25316, -25256, -25196,
+            -25135, -25073, -25010, -24945, -24880, -24813, -24745, -24678, -24611, -24545,
+            -24480, -24416, -24354, -24292, -24231, -24170, -24109, -24046, -23982, -23918,
+            -23852, -23785, -23719, -23652, -23586, -23520, -23456, -23392, -23330, -23268,
+            -23206, -23145, -23082, -23019, -22955, -22891, -22825, -22759, -22692, -22626,
+            -22560, -22495, -22431, -22368, -22305, -22243, -22181, -22119, -22056, -21993,
+            -21929, -21864, -21798, -21732, -21666, -21600, -21535, -21470, -21407, -21343,
+            -21281, -21218, -21156, -21093, -21030, -20966, -20902, -20837, -20772, -20706,
+            -20640, -20575, -20510, -20445, -20382, -20318, -20256, -20193, -20130, -20067,
+            -20004, -19940, -19876, -19811, -19746, -19680, -19615, -19549, -19485, -19420,
+            -19357, -19293, -19230, -19168, -19105, -19042, -18978, -18914, -18850, -18785,
+            -18719, -18654, -18589, -18524, -18459, -18395, -18331, -18268, -18205, -18142,
+            -18079, -18016, -17952, -17888, -17823, -17758, -17693, -17628, -17563, -17498,
+            -17434, -17370, -17306, -17243, -17180, -17117, -17054, -16990, -16926, -16862,
+            -16797, -16732, -16667, -16602, -16537, -16473, -16408, -16344, -16281, -16218,
+            -16154, -16091, -16028, -15964, -15900, -15836, -15771, -15706, -15641, -15576,
+            -15512, -15447, -15383, -15319, -15255, -15192, -15129, -15066, -15002, -14938,
+            -14874, -14810, -14745, -14681, -14616, -14551, -14486, -14422, -14357, -14294,
+            -14230, -14167, -14103, -14040, -13977, -13913, -13849, -13784, -13719, -13655,
+            -13590, -13525, -13460, -13396, -13332, -13268, -13205, -13141, -13078, -13014,
+            -12951, -12887, -12823, -12758, -12694, -12629, -12564, -12499, -12435, -12370,
+            -12306, -12243, -12179, -12116, -12052, -11989, -11925, -11861, -11797, -11732,
+            -11668, -11603, -11538, -11473, -11409, -11345, -11281, -11217, -11154, -11090,
+            -11027, -10963, -10899, -10835, -10771, -10706, -10642, -10577, -10512, -10448,
+            -10383, -10319, -10255, -10192, -10128, -10065, -10001, -9938, -9874, -9810,
+            -9745, -9681, -9616, -9551, -9487, -9422, -9358, -9294, -9230, -9166,
+            -9103, -9039, -8976, -8912, -8848, -8784, -8719, -8655, -8590, -8525,
+            -8461, -8396, -8332, -8268, -8204, -8141, -8077, -8014, -7950, -7886,
+            -7822, -7758, -7694, -7629, -7564, -7500, -7435, -7371, -7307, -7243,
+            -7179, -7115, -7052, -6988, -6924, -6861, -6796, -6732, -6668, -6603,
+            -6538, -6474, -6409, -6345, -6281, -6217, -6153, -6090, -6026, -5962,
+            -5899, -5835, -5771, -5706, -5642, -5577, -5513, -5448, -5384, -5319,
+            -5255, -5191, -5128, -5064, -5001, -4937, -4873, -4809, -4745, -4681,
+            -4616, -4551, -4487, -4422, -4358, -4294, -4230, -4166, -4102, -4039,
+            -3975, -3911, -3847, -3783, -3719, -3655, -3590, -3526, -3461, -3397,
+            -3332, -3268, -3204, -3140, -3077, -3013, -2949, -2886, -2822, -2758,
+            -2693, -2629, -2564, -2500, -2435, -2371, -2307, -2242, -2179, -2115,
+            -2051, -1987, -1924, -1860, -1796, -1732, -1668, -1603, -1539, -1474,
+            -1410, -1345, -1281, -1217, -1153, -1089, -1026, -962, -898, -834,
+            -770, -706, -642, -577, -513, -448, -384, -319, -255, -191,
+            -127, -64, 0, 64, 127, 191, 255, 319, 384, 448,
+            513, 577, 642, 706, 770, 834, 898, 962, 1026, 1089,
+            1153, 1217, 1281, 1345, 1410, 1474, 1539, 1603, 1668, 1732,
+            1796, 1860, 1924, 1987, 2051, 2115, 2179, 2242, 2307, 2371,
+            2435, 2500, 2564, 2629, 2693, 2758, 2822, 2886, 2949, 3013,
+            3077, 3140, 3204, 3268, 3332, 3397, 3461, 3526, 3590, 3655,
+            3719, 3783, 3847, 3911, 3975, 4039, 4102, 4166, 4230, 4294,
+            4358, 4422, 4487, 4551, 4616, 4681, 4745, 4809, 4873, 4937,
+            5001, 5064, 5128, 5191, 5255, 5319, 5384, 5448, 5513, 5577,
+            5642, 5706, 5771, 5835, 5899, 5962, 6026, 6090, 6153, 6217,
+            6281, 6345, 6409, 6474, 6538, 6603, 6668, 6732, 6796, 6861,
+            6924, 6988, 7052, 7115, 7179, 7243, 7307, 7371, 7435, 7500,
+            7564, 7629, 7694, 7758, 7822, 7886, 7950, 8014, 8077, 8141,
+            8204, 8268, 8332, 8396, 8461, 8525, 8590, 8655, 8719, 8784,
+            8848, 8912, 8976, 9039, 9103, 9166, 9230, 9294, 9358, 9422,
+            9487, 9551, 9616, 9681, 9745, 9810, 9874, 9938, 10001, 10065,
+            10128, 10192, 10255, 10319, 10383, 10448, 10512, 10577, 10642, 10706,
+            10771, 10835, 10899, 10963, 11027, 11090, 11154, 11217, 11281, 11345,
+            11409, 11473, 11538, 11603, 11668, 11732, 11797, 11861, 11925, 11989,
+            12052, 12116, 12179, 12243, 12306, 12370, 12435, 12499, 12564, 12629,
+            12694, 12758, 12823, 12887, 12951, 13014, 13078, 13141, 13205, 13268,
+            13332, 13396, 13460, 13525, 13590, 13655, 13719, 13784, 13849, 13913,
+            13977, 14040, 14103, 14167, 14230, 14294, 14357, 14422, 14486, 14551,
+            14616, 14681, 14745, 14810, 14874, 14938, 15002, 15066, 15129, 15192,
+            15255, 15319, 15383, 15447, 15512, 15576, 15641, 15706, 15771, 15836,
+            15900, 15964, 16028, 16091, 16154, 16218, 16281, 16344, 16408, 16473,
+            16537, 16602, 16667, 16732, 16797, 16862, 16926, 16990, 17054, 17117,
+            17180, 17243, 17306, 17370, 17434, 17498, 17563, 17628, 17693, 17758,
+            17823, 17888, 17952, 18016, 18079, 18142, 18205, 18268, 18331, 18395,
+            18459, 18524, 18589, 18654, 18719, 18785, 18850, 18914, 18978, 19042,
+            19105, 19168, 19230, 19293, 19357, 19420, 19485, 19549, 19615, 19680,
+            19746, 19811, 19876, 19940, 20004, 20067, 20130, 20193, 20256, 20318,
+            20382, 20445, 20510, 20575, 20640, 20706, 20772, 20837, 20902, 20966,
+            21030, 21093, 21156, 21218, 21281, 21343, 21407, 21470, 21535, 21600,
+            21666, 21732, 21798, 21864, 21929, 21993, 22056, 22119, 22181, 22243,
+            22305, 22368, 22431, 22495, 22560, 22626, 22692, 22759, 22825, 22891,
+            22955, 23019, 23082, 23145, 23206, 23268, 23330, 23392, 23456, 23520,
+            23586, 23652, 23719, 23785, 23852, 23918, 23982, 24046, 24109, 24170,
+            24231, 24292, 24354, 24416, 24480, 24545, 24611, 24678, 24745, 24813,
+            24880, 24945, 25010, 25073, 25135, 25196, 25256, 25316, 25377, 25439,
+            25503, 25569, 25636, 25704, 25772, 25841, 25908, 25974, 26038, 26101,
+            26161, 26221, 26280, 26339, 26399, 26462, 26526, 26592, 26661, 26730,
+            26800, 26870, 26938, 27004, 27068, 27129, 27188, 27245, 27302, 27360,
+            27419, 27481, 27547, 27615, 27686, 27758, 27831, 27902, 27971, 28037,
+            28100, 28158, 28214, 28268, 28321, 28376, 28435, 28497, 28564, 28636,
+            28711, 28788, 28866, 28941, 29011, 29077, 29136, 29190, 29239, 29286,
+            29333, 29383, 29440, 29503, 29575, 29654, 29740, 29827, 29914, 29996,
+            30069, 30132, 30183, 30224, 30257, 30287, 30319, 30359, 30412, 30481,
+            30568, 30671, 30785, 30903, 31016, 31115, 31192, 31241, 31259, 31250,
+            31223, 31189, 31167, 31175, 31230, 31347, 31529, 31773, 32059, 32355,
+            32612, 32767, 32748, 32474, 31864, 30844, 29347, 27327, 24761, 21651,
+            18030, 13957, 9520, 4826, 0,
+        },
+        { // octave 3: 32 harmonics
+            0, -2484, -4950, -7381, -9759, -12068, -14293, -16421, -18438, -20335,
+            -22102, -23733, -25223, -26568, -27769, -28825, -29739, -30517, -31163, -31685,
+            -32093, -32394, -32600, -32720, -32767, -32750, -32681, -32570, -32427, -32262,
+            -32081, -31895, -31707, -31525, -31353, -31194, -31051, -30924, -30816, -30725,
+            -30650, -30591, -30546, -30511, -30486, -30466, -30451, -30436, -30421, -30403,
+            -30380, -30350, -30314, -30270, -30218, -30158, -30090, -30015, -29934, -29848,
+            -29758, -29666, -29572, -29478, -29385, -29294, -29207, -29123, -29043, -28968,
+            -28898, -28832, -28771, -28714, -28660, -28608, -28559, -28511, -28464, -28416,
+            -28367, -28317, -28264, -28209, -28151, -28089, -28025, -27957, -27887, -27814,
+            -27740, -27663, -27586, -27507, -27429, -27351, -27275, -27199, -27125, -27054,
+            -26984, -26917, -26851, -26788, -26727, -26668, -26609, -26552, -26496, -26439,
+            -26383, -26326, -26268, -26209, -26149, -26087, -26024, -25959, -25892, -25823,
+            -25754, -25683, -25611, -25539, -25466, -25393, -25320, -25248, -25177, -25107,
+            -25038, -24970, -24903, -24838, -24774, -24711, -24649, -24588, -24528, -24468,
+            -24408, -24348, -24288, -24227, -24166, -24103, -24040, -23976, -23910, -23844,
+            -23776, -23708, -23639, -23569, -23499, -23429, -23358, -23288, -23218, -23149,
+            -23080, -23012, -22945, -22879, -22814, -22749, -22686, -22623, -22560, -22498,
+            -22436, -22375, -22313, -22251, -22189, -22126, -22063, -21999, -21934, -21869,
+            -21802, -21735, -21668, -21600, -21531, -21462, -21393, -21324, -21256, -21187,
+            -21119, -21051, -20983, -20917, -20851, -20785, -20721, -20656, -20593, -20529,
+            -20466, -20404, -20341, -20278, -20215, -20152, -20089, -20025, -19961, -19896,
+            -19830, -19764, -19697, -19630, -19563, -19495, -19427, -19359, -19290, -19222,
+            -19154, -19087, -19019, -18952, -18886, -18820, -18755, -18690, -18625, -18561,
+            -18497, -18434, -18370, -18307, -18244, -18180, -18117, -18053, -17988, -17924,
+            -17859, -17793, -17727, -17661, -17594, -17527, -17459, -17392, -17324, -17256,
+            -17189, -17121, -17054, -16987, -16920, -16854, -16788, -16723, -16658, -16593,
+            -16529, -16464, -16401, -16337, -16273, -16209, -16145, -16081, -16017, -15953,
+            -15888, -15823, -15757, -15691, -15625, -15558, -15491, -15424, -15357, -15290,
+            -15222, -15155, -15088, -15021, -14954, -14888, -14821, -14756, -14690, -14625,
+            -14560, -14496, -14431, -14367, -14303, -14239, -14175, -14111, -14047, -13982,
+            -13917, -13852, -13787, -13722, -13656, -13590, -13523, -13456, -13390, -13323,
+            -13255, -13188, -13121, -13054, -12987, -12921, -12855, -12788, -12723, -12657,
+            -12592, -12527, -12462, -12398, -12333, -12269, -12205, -12141, -12076, -12012,
+            -11947, -11882, -11817, -11752, -11687, -11621, -11555, -11488, -11422, -11355,
+            -11288, -11221, -11154, -11087, -11021, -10954, -10887, -10821, -10755, -10689,
+            -10624, -10558, -10493, -10429, -10364, -10299, -10235, -10171, -10106, -10042,
+            -9977, -9913, -9848, -9783, -9717, -9652, -9586, -9520, -9454, -9387,
+            -9321, -9254, -9187, -9120, -9053, -8987, -8920, -8854, -8787, -8721,
+            -8656, -8590, -8525, -8460, -8395, -8330, -8266, -8201, -8137, -8072,
+            -8008, -7943, -7878, -7813, -7748, -7683, -7617, -7551, -7485, -7419,
+            -7353, -7286, -7220, -7153, -7086, -7019, -6953, -6886, -6820, -6754,
+            -6688, -6622, -6556, -6491, -6426, -6361, -6296, -6232, -6167, -6102,
+            -6038, -5973, -5909, -5844, -5779, -5714, -5648, -5583, -5517, -5451,
+            -5385, -5318, -5252, -5185, -5119, -5052, -4985, -4919, -4852, -4786,
+            -4720, -4654, -4588, -4523, -4457, -4392, -4327, -4262, -4197, -4133,
+            -4068, -4004, -3939, -3874, -3809, -3744, -3679, -3614, -3548, -3483,
+            -3417, -3350, -3284, -3218, -3151, -3085, -3018, -2951, -2885, -2818,
+            -2752, -2686, -2620, -2554, -2489, -2423, -2358, -2293, -2228, -2163,
+            -2099, -2034, -1970, -1905, -1840, -1775, -1710, -1645, -1580, -1514,
+            -1448, -1382, -1316, -1250, -1183, -1117, -1050, -984, -917, -851,
+            -784, -718, -652, -586, -520, -454, -389, -324, -259, -194,
+            -129, -65, 0, 65, 129, 194, 259, 324, 389, 454,
+            520, 586, 652, 718, 784, 851, 917, 984, 1050, 1117,
+            1183, 1250, 1316, 1382, 1448, 1514, 1580, 1645, 1710, 1775,
+            1840, 1905, 1970, 2034, 2099, 2163, 2228, 2293, 2358, 2423,
+            2489, 2554, 2620, 2686, 2752, 2818, 2885, 2951, 3018, 3085,
+            3151, 3218, 3284, 3350, 3417, 3483, 3548, 3614, 3679, 3744,
+            3809, 3874, 3939, 4004, 4068, 4133, 4197, 4262, 4327, 4392,
+            4457, 4523, 4588, 4654, 4720, 4786, 4852, 4919, 4985, 5052,
+            5119, 5185, 5252, 5318, 5385, 5451, 5517, 5583, 5648, 5714,
+            5779, 5844, 5909, 5973, 6038, 6102, 6167, 6232, 6296, 6361,
+            6426, 6491, 6556, 6622, 6688, 6754, 6820, 6886, 6953, 7019,
+            7086, 7153, 7220, 7286, 7353, 7419, 7485, 7551, 7617, 7683,
+            7748, 7813, 7878, 7943, 8008, 8072, 8137, 8201, 8266, 8330,
+            8395, 8460, 8525, 8590, 8656, 8721, 8787, 8854, 8920, 8987,
+            9053, 9120, 9187, 9254, 9321, 9387, 9454, 9520, 9586, 9652,
+            9717, 9783, 9848, 9913, 9977, 10042, 10106, 10171, 10235, 10299,
+            10364, 10429, 10493, 10558, 10624, 10689, 10755, 10821, 10887, 10954,
+            11021, 11087, 11154, 11221, 11288, 11355, 11422, 11488, 11555, 11621,
+            11687, 11752, 11817, 11882, 11947, 12012, 12076, 12141, 12205, 12269,
+            12333, 12398, 12462, 12527, 12592, 12657, 12723, 12788, 12855, 12921,
+            12987, 13054, 13121, 13188, 13255, 13323, 13390, 13456, 13523, 13590,
+            13656, 13722, 13787, 13852, 13917, 13982, 14047, 14111, 14175, 14239,
+            14303, 14367, 14431, 14496, 14560, 14625, 14690, 14756, 14821, 14888,
+            14954, 15021, 15088, 15155, 15222, 15290, 15357, 15424, 15491, 15558,
+            15625, 15691, 15757, 15823, 15888, 15953, 16017, 16081, 16145, 16209,
+            16273, 16337, 16401, 16464, 16529, 16593, 16658, 16723, 16788, 16854,
+            16920, 16987, 17054, 17121, 17189, 17256, 17324, 17392, 17459, 17527,
+            17594, 17661, 17727, 17793, 17859, 17924, 17988, 18053, 18117, 18180,
+            18244, 18307, 18370, 18434, 18497, 18561, 18625, 18690, 18755, 18820,
+            18886, 18952, 19019, 19087, 19154, 19222, 19290, 19359, 19427, 19495,
+            19563, 19630, 19697, 19764, 19830, 19896, 19961, 20025, 20089, 20152,
+            20215, 20278, 20341, 20404, 20466, 20529, 20593, 20656, 20721, 20785,
+            20851, 20917, 20983, 21051, 21119, 21187, 21256, 21324, 21393, 21462,
+            21531, 21600, 21668, 21735, 21802, 21869, 21934, 21999, 22063, 22126,
+            22189, 22251, 22313, 22375, 22436, 22498, 22560, 22623, 22686, 22749,
+            22814, 22879, 22945, 23012, 23080, 23149, 23218, 23288, 23358, 23429,
+            23499, 23569, 23639, 23708, 23776, 23844, 23910, 23976, 24040, 24103,
+            24166, 24227, 24288, 24348, 24408, 24468, 24528, 24588, 24649, 24711,
+            24774, 24838, 24903, 24970, 25038, 25107, 25177, 25248, 25320, 25393,
+            25466, 25539, 25611, 25683, 25754, 25823, 25892, 25959, 26024, 26087,
+            26149, 26209, 26268, 26326, 26383, 26439, 26496, 26552, 26609, 26668,
+            26727, 26788, 26851, 26917, 26984, 27054, 27125, 27199, 27275, 27351,
+            27429, 27507, 27586, 27663, 27740, 27814, 27887, 27957, 28025, 28089,
+            28151, 28209, 28264, 28317, 28367, 28416, 28464, 28511, 28559, 28608,
+            28660, 28714, 28771, 28832, 28898, 28968, 29043, 29123, 29207, 29294,
+            29385, 29478, 29572, 29666, 29758, 29848, 29934, 30015, 30090, 30158,
+            30218, 30270, 30314, 30350, 30380, 30403, 30421, 30436, 30451, 30466,
+            30486, 30511, 30546, 30591, 30650, 30725, 30816, 30924, 31051, 31194,
+            31353, 31525, 31707, 31895, 32081, 32262, 32427, 32570, 32681, 32750,
+            32767, 32720, 32600, 32394, 32093, 31685, 31163, 30517, 29739, 28825,
+            27769, 26568, 25223, 23733, 22102, 20335, 18438, 16421, 14293, 12068,
+            9759, 7381, 4950, 2484, 0,
+        },
+        { // octave 4: 16 harmonics
+            0, -1307, -2611, -3910, -5201, -6482, -7751, -9005, -10241, -11458,
+            -12652, -13823, -14968, -16086, -17173, -18230, -19254, -20243, -21198, -22115,
+            -22996, -23837, -24640, -25404, -26127, -26810, -27453, -28055, -28617, -29140,
+            -29623, -30067, -30474, -30842, -31175, -31471, -31734, -31963, -32161, -32328,
+            -32465, -32575, -32659, -32717, -32753, -32767, -32761, -32736, -32695, -32637,
+            -32567, -32483, -32389, -32285, -32174, -32055, -31931, -31802, -31671, -31537,
+            -31402, -31267, -31132, -30999, -30868, -30740, -30615, -30494, -30376, -30263,
+            -30155, -30052, -29953, -29860, -29772, -29688, -29609, -29535, -29466, -29400,
+            -29339, -29281, -29226, -29175, -29126, -29080, -29035, -28992, -28950, -28909,
+            -28868, -28828, -28787, -28746, -28704, -28661, -28616, -28570, -28523, -28473,
+            -28421, -28368, -28312, -28254, -28193, -28130, -28065, -27998, -27928, -27857,
+            -27783, -27708, -27631, -27552, -27472, -27391, -27308, -27225, -27142, -27057,
+            -26973, -26889, -26804, -26720, -26636, -26553, -26471, -26389, -26308, -26229,
+            -26151, -26073, -25998, -25923, -25850, -25778, -25708, -25639, -25571, -25504,
+            -25439, -25375, -25312, -25249, -25188, -25128, -25068, -25008, -24949, -24891,
+            -24832, -24774, -24716, -24657, -24598, -24539, -24479, -24419, -24358, -24297,
+            -24234, -24171, -24107, -24042, -23977, -23910, -23842, -23774, -23704, -23634,
+            -23563, -23491, -23419, -23345, -23271, -23197, -23122, -23047, -22971, -22895,
+            -22819, -22743, -22667, -22591, -22515, -22440, -22365, -22290, -22216, -22142,
+            -22069, -21996, -21924, -21853, -21782, -21712, -21642, -21574, -21505, -21438,
+            -21371, -21305, -21239, -21174, -21109, -21045, -20981, -20917, -20854, -20791,
+            -20728, -20665, -20602, -20538, -20475, -20412, -20348, -20284, -20219, -20155,
+            -20090, -20024, -19958, -19891, -19824, -19757, -19689, -19620, -19551, -19481,
+            -19411, -19340, -19269, -19198, -19126, -19054, -18982, -18909, -18836, -18763,
+            -18690, -18617, -18544, -18471, -18398, -18325, -18252, -18180, -18107, -18036,
+            -17964, -17893, -17822, -17752, -17682, -17612, -17543, -17474, -17406, -17338,
+            -17271, -17204, -17137, -17070, -17004, -16939, -16873, -16808, -16742, -16677,
+            -16612, -16547, -16482, -16417, -16352, -16287, -16222, -16156, -16090, -16024,
+            -15958, -15891, -15825, -15757, -15690, -15622, -15554, -15485, -15416, -15347,
+            -15277, -15207, -15137, -15066, -14995, -14924, -14853, -14781, -14710, -14638,
+            -14566, -14494, -14422, -14350, -14279, -14207, -14135, -14064, -13993, -13922,
+            -13851, -13781, -13710, -13640, -13571, -13502, -13432, -13364, -13295, -13227,
+            -13159, -13092, -13025, -12958, -12891, -12824, -12758, -12692, -12626, -12560,
+            -12494, -12428, -12362, -12296, -12230, -12164, -12098, -12032, -11965, -11899,
+            -11832, -11765, -11697, -11630, -11562, -11494, -11426, -11357, -11288, -11219,
+            -11149, -11080, -11010, -10940, -10869, -10799, -10728, -10657, -10586, -10515,
+            -10444, -10373, -10302, -10230, -10159, -10088, -10017, -9946, -9876, -9805,
+            -9735, -9664, -9595, -9525, -9455, -9386, -9317, -9248, -9180, -9112,
+            -9044, -8976, -8908, -8841, -8774, -8707, -8640, -8573, -8507, -8440,
+            -8374, -8308, -8241, -8175, -8109, -8042, -7976, -7909, -7842, -7775,
+            -7708, -7641, -7573, -7506, -7438, -7370, -7301, -7233, -7164, -7095,
+            -7025, -6956, -6886, -6816, -6746, -6676, -6605, -6535, -6464, -6393,
+            -6323, -6252, -6181, -6110, -6039, -5968, -5898, -5827, -5757, -5686,
+            -5616, -5546, -5476, -5407, -5337, -5268, -5199, -5130, -5062, -4994,
+            -4925, -4858, -4790, -4722, -4655, -4588, -4521, -4454, -4387, -4321,
+            -4254, -4187, -4121, -4054, -3987, -3921, -3854, -3787, -3720, -3653,
+            -3586, -3519, -3451, -3383, -3315, -3247, -3179, -3110, -3041, -2972,
+            -2903, -2834, -2764, -2694, -2624, -2554, -2484, -2413, -2343, -2272,
+            -2202, -2131, -2060, -1990, -1919, -1848, -1778, -1707, -1637, -1567,
+            -1496, -1427, -1357, -1287, -1218, -1149, -1080, -1011, -942, -874,
+            -806, -738, -670, -602, -535, -468, -401, -334, -267, -200,
+            -133, -67, 0, 67, 133, 200, 267, 334, 401, 468,
+            535, 602, 670, 738, 806, 874, 942, 1011, 1080, 1149,
+            1218, 1287, 1357, 1427, 1496, 1567, 1637, 1707, 1778, 1848,
+            1919, 1990, 2060, 2131, 2202, 2272, 2343, 2413, 2484, 2554,
+            2624, 2694, 2764, 2834, 2903, 2972, 3041, 3110, 3179, 3247,
+            3315, 3383, 3451, 3519, 3586, 3653, 3720, 3787, 3854, 3921,
+            3987, 4054, 4121, 4187, 4254, 4321, 4387, 4454, 4521, 4588,
+            4655, 4722, 4790, 4858, 4925, 4994, 5062, 5130, 5199, 5268,
+            5337, 5407, 5476, 5546, 5616, 5686, 5757, 5827, 5898, 5968,
+            6039, 6110, 6181, 6252, 6323, 6393, 6464, 6535, 6605, 6676,
+            6746, 6816, 6886, 6956, 7025, 7095, 7164, 7233, 7301, 7370,
+            7438, 7506, 7573, 7641, 7708, 7775, 7842, 7909, 7976, 8042,
+            8109, 8175, 8241, 8308, 8374, 8440, 8507, 8573, 8640, 8707,
+            8774, 8841, 8908, 8976, 9044, 9112, 9180, 9248, 9317, 9386,
+            9455, 9525, 9595, 9664, 9735, 9805, 9876, 9946, 10017, 10088,
+            10159, 10230, 10302, 10373, 10444, 10515, 10586, 10657, 10728, 10799,
+            10869, 10940, 11010, 11080, 11149, 11219, 11288, 11357, 11426, 11494,
+            11562, 11630, 11697, 11765, 11832, 11899, 11965, 12032, 12098, 12164,
+            12230, 12296, 12362, 12428, 12494, 12560, 12626, 12692, 12758, 12824,
+            12891, 12958, 13025, 13092, 13159, 13227, 13295, 13364, 13432, 13502,
+            13571, 13640, 13710, 13781, 13851, 13922, 13993, 14064, 14135, 14207,
+            14279, 14350, 14422, 14494, 14566, 14638, 14710, 14781, 14853, 14924,
+            14995, 15066, 15137, 15207, 15277, 15347, 15416, 15485, 15554, 15622,
+            15690, 15757, 15825, 15891, 15958, 16024, 16090, 16156, 16222, 16287,
+            16352, 16417, 16482, 16547, 16612, 16677, 16742, 16808, 16873, 16939,
+            17004, 17070, 17137, 17204, 17271, 17338, 17406, 17474, 17543, 17612,
+            17682, 17752, 17822, 17893, 17964, 18036, 18107, 18180, 18252, 18325,
+            18398, 18471, 18544, 18617, 18690, 18763, 18836, 18909, 18982, 19054,
+            19126, 19198, 19269, 19340, 19411, 19481, 19551, 19620, 19689, 19757,
+            19824, 19891, 19958, 20024, 20090, 20155, 20219, 20284, 20348, 20412,
+            20475, 20538, 20602, 20665, 20728, 20791, 20854, 20917, 20981, 21045,
+            21109, 21174, 21239, 21305, 21371, 21438, 21505, 21574, 21642, 21712,
+            21782, 21853, 21924, 21996, 22069, 22142, 22216, 22290, 22365, 22440,
+            22515, 22591, 22667, 22743, 22819, 22895, 22971, 23047, 23122, 23197,
+            23271, 23345, 23419, 23491, 23563, 23634, 23704, 23774, 23842, 23910,
+            23977, 24042, 24107, 24171, 24234, 24297, 24358, 24419, 24479, 24539,
+            24598, 24657, 24716, 24774, 24832, 24891, 24949, 25008, 25068, 25128,
+            25188, 25249, 25312, 25375, 25439, 25504, 25571, 25639, 25708, 25778,
+            25850, 25923, 25998, 26073, 26151, 26229, 26308, 26389, 26471, 26553,
+            26636, 26720, 26804, 26889, 26973, 27057, 27142, 27225, 27308, 27391,
+            27472, 27552, 27631, 27708, 27783, 27857, 27928, 27998, 28065, 28130,
+            28193, 28254, 28312, 28368, 28421, 28473, 28523, 28570, 28616, 28661,
+            28704, 28746, 28787, 28828, 28868, 28909, 28950, 28992, 29035, 29080,
+            29126, 29175, 29226, 29281, 29339, 29400, 29466, 29535, 29609, 29688,
+            29772, 29860, 29953, 30052, 30155, 30263, 30376, 30494, 30615, 30740,
+            30868, 30999, 31132, 31267, 31402, 31537, 31671, 31802, 31931, 32055,
+            32174, 32285, 32389, 32483, 32567, 32637, 32695, 32736, 32761, 32767,
+            32753, 32717, 32659, 32575, 32465, 32328, 32161, 31963, 31734, 31471,
+            31175, 30842, 30474, 30067, 29623, 29140, 28617, 28055, 27453, 26810,
+            26127, 25404, 24640, 23837, 22996, 22115, 21198, 20243, 19254, 18230,
+            17173, 16086, 14968, 13823, 12652, 11458, 10241, 9005, 7751, 6482,
+            5201, 3910, 2611, 1307, 0,
+        },
+        { // octave 5: 8 harmonics
+            0, -717, -1433, -2149, -2863, -3576, -4286, -4994, -5700, -6402,
+            -7100, -7795, -8485, -9170, -9850, -10524, -11193, -11855, -12511, -13159,
+            -13801, -14435, -15061, -15678, -16288, -16888, -17479, -18061, -18634, -19196,
+            -19749, -20291, -20822, -21343, -21853, -22352, -22840, -23316, -23780, -24233,
+            -24675, -25104, -25521, -25926, -26320, -26701, -27069, -27426, -27770, -28102,
+            -28421, -28729, -29024, -29307, -29578, -29837, -30083, -30318, -30541, -30753,
+            -30952, -31141, -31318, -31484, -31638, -31782, -31915, -32038, -32150, -32253,
+            -32345, -32427, -32500, -32564, -32618, -32664, -32701, -32729, -32750, -32762,
+            -32767, -32764, -32754, -32738, -32714, -32684, -32648, -32606, -32558, -32505,
+            -32447, -32384, -32316, -32243, -32167, -32086, -32002, -31915, -31824, -31730,
+            -31634, -31535, -31433, -31330, -31224, -31117, -31009, -30899, -30788, -30676,
+            -30563, -30450, -30336, -30222, -30108, -29994, -29880, -29767, -29654, -29541,
+            -29429, -29318, -29208, -29098, -28990, -28883, -28777, -28672, -28568, -28466,
+            -28366, -28266, -28169, -28072, -27978, -27884, -27793, -27703, -27615, -27528,
+            -27442, -27359, -27277, -27196, -27117, -27039, -26963, -26888, -26814, -26742,
+            -26671, -26602, -26533, -26466, -26399, -26334, -26270, -26206, -26144, -26082,
+            -26020, -25960, -25900, -25841, -25782, -25723, -25665, -25607, -25549, -25492,
+            -25434, -25377, -25319, -25262, -25204, -25146, -25088, -25030, -24971, -24912,
+            -24853, -24793, -24733, -24672, -24610, -24548, -24486, -24422, -24358, -24294,
+            -24228, -24162, -24095, -24028, -23959, -23890, -23820, -23750, -23679, -23606,
+            -23533, -23460, -23386, -23310, -23235, -23158, -23081, -23003, -22925, -22846,
+            -22766, -22686, -22605, -22524, -22442, -22360, -22277, -22195, -22111, -22028,
+            -21944, -21859, -21775, -21691, -21606, -21521, -21436, -21351, -21266, -21181,
+            -21096, -21011, -20927, -20842, -20757, -20673, -20589, -20505, -20422, -20339,
+            -20256, -20173, -20091, -20009, -19928, -19847, -19766, -19686, -19606, -19527,
+            -19448, -19370, -19292, -19215, -19138, -19061, -18985, -18910, -18835, -18760,
+            -18686, -18613, -18540, -18467, -18395, -18323, -18251, -18180, -18109, -18039,
+            -17969, -17899, -17830, -17761, -17692, -17623, -17555, -17486, -17418, -17350,
+            -17282, -17215, -17147, -17079, -17012, -16944, -16877, -16809, -16741, -16674,
+            -16606, -16538, -16470, -16402, -16333, -16264, -16196, -16127, -16057, -15988,
+            -15918, -15848, -15777, -15707, -15636, -15564, -15493, -15421, -15348, -15276,
+            -15202, -15129, -15055, -14981, -14907, -14832, -14757, -14681, -14606, -14529,
+            -14453, -14376, -14299, -14222, -14144, -14066, -13988, -13909, -13831, -13752,
+            -13673, -13593, -13514, -13434, -13355, -13275, -13195, -13114, -13034, -12954,
+            -12874, -12793, -12713, -12633, -12553, -12472, -12392, -12312, -12232, -12152,
+            -12073, -11993, -11913, -11834, -11755, -11676, -11597, -11519, -11441, -11363,
+            -11285, -11207, -11130, -11053, -10976, -10900, -10823, -10747, -10672, -10596,
+            -10521, -10447, -10372, -10298, -10224, -10150, -10077, -10004, -9931, -9858,
+            -9786, -9714, -9642, -9570, -9498, -9427, -9356, -9285, -9214, -9143,
+            -9073, -9002, -8932, -8862, -8792, -8721, -8651, -8581, -8511, -8441,
+            -8371, -8301, -8231, -8161, -8091, -8021, -7950, -7880, -7809, -7738,
+            -7668, -7597, -7525, -7454, -7382, -7311, -7239, -7166, -7094, -7021,
+            -6949, -6876, -6802, -6729, -6655, -6581, -6506, -6432, -6357, -6282,
+            -6207, -6131, -6055, -5979, -5903, -5827, -5750, -5673, -5596, -5519,
+            -5441, -5364, -5286, -5208, -5129, -5051, -4973, -4894, -4816, -4737,
+            -4658, -4579, -4500, -4421, -4342, -4263, -4184, -4105, -4026, -3947,
+            -3868, -3789, -3711, -3632, -3553, -3475, -3397, -3318, -3240, -3162,
+            -3085, -3007, -2930, -2852, -2775, -2699, -2622, -2546, -2470, -2394,
+            -2318, -2242, -2167, -2092, -2017, -1943, -1868, -1794, -1721, -1647,
+            -1573, -1500, -1427, -1355, -1282, -1210, -1137, -1065, -994, -922,
+            -850, -779, -708, -637, -566, -495, -424, -353, -282, -212,
+            -141, -71, 0, 71, 141, 212, 282, 353, 424, 495,
+            566, 637, 708, 779, 850, 922, 994, 1065, 1137, 1210,
+            1282, 1355, 1427, 1500, 1573, 1647, 1721, 1794, 1868, 1943,
+            2017, 2092, 2167, 2242, 2318, 2394, 2470, 2546, 2622, 2699,
+            2775, 2852, 2930, 3007, 3085, 3162, 3240, 3318, 3397, 3475,
+            3553, 3632, 3711, 3789, 3868, 3947, 4026, 4105, 4184, 4263,
+            4342, 4421, 4500, 4579, 4658, 4737, 4816, 4894, 4973, 5051,
+            5129, 5208, 5286, 5364, 5441, 5519, 5596, 5673, 5750, 5827,
+            5903, 5979, 6055, 6131, 6207, 6282, 6357, 6432, 6506, 6581,
+            6655, 6729, 6802, 6876, 6949, 7021, 7094, 7166, 7239, 7311,
+            7382, 7454, 7525, 7597, 7668, 7738, 7809, 7880, 7950, 8021,
+            8091, 8161, 8231, 8301, 8371, 8441, 8511, 8581, 8651, 8721,
+            8792, 8862, 8932, 9002, 9073, 9143, 9214, 9285, 9356, 9427,
+            9498, 9570, 9642, 9714, 9786, 9858, 9931, 10004, 10077, 10150,
+            10224, 10298, 10372, 10447, 10521, 10596, 10672, 10747, 10823, 10900,
+            10976, 11053, 11130, 11207, 11285, 11363, 11441, 11519, 11597, 11676,
+            11755, 11834, 11913, 11993, 12073, 12152, 12232, 12312, 12392, 12472,
+            12553, 12633, 12713, 12793, 12874, 12954, 13034, 13114, 13195, 13275,
+            13355, 13434, 13514, 13593, 13673, 13752, 13831, 13909, 13988, 14066,
+            14144, 14222, 14299, 14376, 14453, 14529, 14606, 14681, 14757, 14832,
+            14907, 14981, 15055, 15129, 15202, 15276, 15348, 15421, 15493, 15564,
+            15636, 15707, 15777, 15848, 15918, 15988, 16057, 16127, 16196, 16264,
+            16333, 16402, 16470, 16538, 16606, 16674, 16741, 16809, 16877, 16944,
+            17012, 17079, 17147, 17215, 17282, 17350, 17418, 17486, 17555, 17623,
+            17692, 17761, 17830, 17899, 17969, 18039, 18109, 18180, 18251, 18323,
+            18395, 18467, 18540, 18613, 18686, 18760, 18835, 18910, 18985, 19061,
+            19138, 19215, 19292, 19370, 19448, 19527, 19606, 19686, 19766, 19847,
+            19928, 20009, 20091, 20173, 20256, 20339, 20422, 20505, 20589, 20673,
+            20757, 20842, 20927, 21011, 21096, 21181, 21266, 21351, 21436, 21521,
+            21606, 21691, 21775, 21859, 21944, 22028, 22111, 22195, 22277, 22360,
+            22442, 22524, 22605, 22686, 22766, 22846, 22925, 23003, 23081, 23158,
+            23235, 23310, 23386, 23460, 23533, 23606, 23679, 23750, 23820, 23890,
+            23959, 24028, 24095, 24162, 24228, 24294, 24358, 24422, 24486, 24548,
+            24610, 24672, 24733, 24793, 24853, 24912, 24971, 25030, 25088, 25146,
+            25204, 25262, 25319, 25377, 25434, 25492, 25549, 25607, 25665, 25723,
+            25782, 25841, 25900, 25960, 26020, 26082, 26144, 26206, 26270, 26334,
+            26399, 26466, 26533, 26602, 26671, 26742, 26814, 26888, 26963, 27039,
+            27117, 27196, 27277, 27359, 27442, 27528, 27615, 27703, 27793, 27884,
+            27978, 28072, 28169, 28266, 28366, 28466, 28568, 28672, 28777, 28883,
+            28990, 29098, 29208, 29318, 29429, 29541, 29654, 29767, 29880, 29994,
+            30108, 30222, 30336, 30450, 30563, 30676, 30788, 30899, 31009, 31117,
+            31224, 31330, 31433, 31535, 31634, 31730, 31824, 31915, 32002, 32086,
+            32167, 32243, 32316, 32384, 32447, 32505, 32558, 32606, 32648, 32684,
+            32714, 32738, 32754, 32764, 32767, 32762, 32750, 32729, 32701, 32664,
+            32618, 32564, 32500, 32427, 32345, 32253, 32150, 32038, 31915, 31782,
+            31638, 31484, 31318, 31141, 30952, 30753, 30541, 30318, 30083, 29837,
+            29578, 29307, 29024, 28729, 28421, 28102, 27770, 27426, 27069, 26701,
+            26320, 25926, 25521, 25104, 24675, 24233, 23780, 23316, 22840, 22352,
+            21853, 21343, 20822, 20291, 19749, 19196, 18634, 18061, 17479, 16888,
+            16288, 15678, 15061, 14435, 13801, 13159, 12511, 11855, 11193, 10524,
+            9850, 9170, 8485, 7795, 7100, 6402, 5700, 4994, 4286, 3576,
+            2863, 2149, 1433, 717, 0,
+        },
+        { // octave 6: 4 harmonics
+            0, -421, -843, -1264, -1685, -2106, -2526, -2946, -3365, -3783,
+            -4201, -4618, -5034, -5450, -5864, -6277, -6689, -7100, -7509, -7917,
+            -8323, -8728, -9131, -9533, -9932, -10330, -10726, -11120, -11512, -11902,
+            -12289, -12675, -13058, -13438, -13816, -14192, -14564, -14935, -15302, -15667,
+            -16029, -16388, -16744, -17097, -17446, -17793, -18137, -18477, -18814, -19148,
+            -19478, -19805, -20128, -20448, -20764, -21077, -21385, -21691, -21992, -22290,
+            -22584, -22873, -23159, -23442, -23720, -23994, -24264, -24530, -24792, -25050,
+            -25303, -25553, -25798, -26039, -26276, -26509, -26737, -26961, -27181, -27396,
+            -27608, -27814, -28017, -28215, -28409, -28598, -28783, -28964, -29140, -29312,
+            -29480, -29643, -29802, -29957, -30107, -30253, -30394, -30531, -30664, -30793,
+            -30917, -31037, -31153, -31264, -31372, -31475, -31574, -31668, -31759, -31845,
+            -31928, -32006, -32080, -32151, -32217, -32279, -32338, -32392, -32443, -32490,
+            -32533, -32572, -32608, -32640, -32668, -32692, -32714, -32731, -32745, -32756,
+            -32763, -32767, -32767, -32764, -32758, -32749, -32736, -32721, -32702, -32681,
+            -32656, -32629, -32598, -32565, -32529, -32491, -32449, -32405, -32359, -32310,
+            -32258, -32204, -32148, -32089, -32028, -31965, -31899, -31832, -31762, -31691,
+            -31617, -31541, -31464, -31385, -31304, -31221, -31137, -31051, -30963, -30874,
+            -30783, -30691, -30598, -30503, -30407, -30310, -30211, -30112, -30011, -29909,
+            -29807, -29703, -29598, -29493, -29387, -29280, -29172, -29063, -28954, -28845,
+            -28734, -28623, -28512, -28400, -28288, -28176, -28063, -27950, -27836, -27723,
+            -27609, -27495, -27381, -27266, -27152, -27038, -26924, -26809, -26695, -26581,
+            -26467, -26353, -26240, -26126, -26013, -25900, -25788, -25675, -25563, -25451,
+            -25340, -25229, -25118, -25008, -24899, -24789, -24680, -24572, -24464, -24357,
+            -24250, -24144, -24038, -23933, -23828, -23724, -23621, -23518, -23416, -23314,
+            -23213, -23113, -23013, -22914, -22815, -22717, -22620, -22523, -22427, -22332,
+            -22237, -22143, -22049, -21957, -21864, -21773, -21682, -21591, -21502, -21413,
+            -21324, -21236, -21149, -21062, -20976, -20890, -20805, -20720, -20636, -20553,
+            -20470, -20387, -20305, -20224, -20143, -20062, -19982, -19902, -19823, -19744,
+            -19666, -19588, -19510, -19433, -19356, -19279, -19203, -19127, -19051, -18976,
+            -18900, -18825, -18751, -18676, -18602, -18528, -18454, -18380, -18306, -18233,
+            -18159, -18086, -18013, -17940, -17867, -17794, -17721, -17648, -17575, -17502,
+            -17429, -17356, -17283, -17209, -17136, -17063, -16989, -16916, -16842, -16768,
+            -16694, -16620, -16546, -16472, -16397, -16322, -16247, -16172, -16096, -16020,
+            -15944, -15868, -15792, -15715, -15638, -15560, -15483, -15405, -15326, -15248,
+            -15169, -15090, -15010, -14930, -14850, -14769, -14688, -14607, -14526, -14444,
+            -14361, -14279, -14196, -14112, -14029, -13944, -13860, -13775, -13690, -13604,
+            -13519, -13432, -13346, -13259, -13172, -13084, -12996, -12908, -12819, -12730,
+            -12641, -12551, -12461, -12371, -12280, -12190, -12098, -12007, -11915, -11823,
+            -11731, -11638, -11546, -11453, -11359, -11266, -11172, -11078, -10984, -10890,
+            -10795, -10700, -10606, -10511, -10415, -10320, -10224, -10129, -10033, -9937,
+            -9841, -9745, -9649, -9553, -9457, -9360, -9264, -9168, -9071, -8975,
+            -8878, -8782, -8685, -8589, -8493, -8396, -8300, -8204, -8108, -8012,
+            -7916, -7820, -7724, -7628, -7533, -7437, -7342, -7247, -7152, -7057,
+            -6962, -6868, -6773, -6679, -6585, -6491, -6398, -6305, -6211, -6119,
+            -6026, -5934, -5841, -5749, -5658, -5566, -5475, -5384, -5293, -5203,
+            -5113, -5023, -4933, -4844, -4755, -4666, -4578, -4490, -4402, -4314,
+            -4227, -4140, -4053, -3966, -3880, -3794, -3708, -3623, -3538, -3453,
+            -3369, -3284, -3200, -3116, -3033, -2950, -2867, -2784, -2701, -2619,
+            -2537, -2455, -2374, -2292, -2211, -2130, -2050, -1969, -1889, -1809,
+            -1729, -1649, -1569, -1490, -1410, -1331, -1252, -1173, -1095, -1016,
+            -937, -859, -780, -702, -624, -546, -468, -390, -312, -234,
+            -156, -78, 0, 78, 156, 234, 312, 390, 468, 546,
+            624, 702, 780, 859, 937, 1016, 1095, 1173, 1252, 1331,
+            1410, 1490, 1569, 1649, 1729, 1809, 1889, 1969, 2050, 2130,
+            2211, 2292, 2374, 2455, 2537, 2619, 2701, 2784, 2867, 2950,
+            3033, 3116, 3200, 3284, 3369, 3453, 3538, 3623, 3708, 3794,
+            3880, 3966, 4053, 4140, 4227, 4314, 4402, 4490, 4578, 4666,
+            4755, 4844, 4933, 5023, 5113, 5203, 5293, 5384, 5475, 5566,
+            5658, 5749, 5841, 5934, 6026, 6119, 6211, 6305, 6398, 6491,
+            6585, 6679, 6773, 6868, 6962, 7057, 7152, 7247, 7342, 7437,
+            7533, 7628, 7724, 7820, 7916, 8012, 8108, 8204, 8300, 8396,
+            8493, 8589, 8685, 8782, 8878, 8975, 9071, 9168, 9264, 9360,
+            9457, 9553, 9649, 9745, 9841, 9937, 10033, 10129, 10224, 10320,
+            10415, 10511, 10606, 10700, 10795, 10890, 10984, 11078, 11172, 11266,
+            11359, 11453, 11546, 11638, 11731, 11823, 11915, 12007, 12098, 12190,
+            12280, 12371, 12461, 12551, 12641, 12730, 12819, 12908, 12996, 13084,
+            13172, 13259, 13346, 13432, 13519, 13604, 13690, 13775, 13860, 13944,
+            14029, 14112, 14196, 14279, 14361, 14444, 14526, 14607, 14688, 14769,
+            14850, 14930, 15010, 15090, 15169, 15248, 15326, 15405, 15483, 15560,
+            15638, 15715, 15792, 15868, 15944, 16020, 16096, 16172, 16247, 16322,
+            16397, 16472, 16546, 16620, 16694, 16768, 16842, 16916, 16989, 17063,
+            17136, 17209, 17283, 17356, 17429, 17502, 17575, 17648, 17721, 17794,
+            17867, 17940, 18013, 18086, 18159, 18233, 18306, 18380, 18454, 18528,
+            18602, 18676, 18751, 18825, 18900, 18976, 19051, 19127, 19203, 19279,
+            19356, 19433, 19510, 19588, 19666, 19744, 19823, 19902, 19982, 20062,
+            20143, 20224, 20305, 20387, 20470, 20553, 20636, 20720, 20805, 20890,
+            20976, 21062, 21149, 21236, 21324, 21413, 21502, 21591, 21682, 21773,
+            21864, 21957, 22049, 22143, 22237, 22332, 22427, 22523, 22620, 22717,
+            22815, 22914, 23013, 23113, 23213, 23314, 23416, 23518, 23621, 23724,
+            23828, 23933, 24038, 24144, 24250, 24357, 24464, 24572, 24680, 24789,
+            24899, 25008, 25118, 25229, 25340, 25451, 25563, 25675, 25788, 25900,
+            26013, 26126, 26240, 26353, 26467, 26581, 26695, 26809, 26924, 27038,
+            27152, 27266, 27381, 27495, 27609, 27723, 27836, 27950, 28063, 28176,
+            28288, 28400, 28512, 28623, 28734, 28845, 28954, 29063, 29172, 29280,
+            29387, 29493, 29598, 29703, 29807, 29909, 30011, 30112, 30211, 30310,
+            30407, 30503, 30598, 30691, 30783, 30874, 30963, 31051, 31137, 31221,
+            31304, 31385, 31464, 31541, 31617, 31691, 31762, 31832, 31899, 31965,
+            32028, 32089, 32148, 32204, 32258, 32310, 32359, 32405, 32449, 32491,
+            32529, 32565, 32598, 32629, 32656, 32681, 32702, 32721, 32736, 32749,
+            32758, 32764, 32767, 32767, 32763, 32756, 32745, 32731, 32714, 32692,
+            32668, 32640, 32608, 32572, 32533, 32490, 32443, 32392, 32338, 32279,
+            32217, 32151, 32080, 32006, 31928, 31845, 31759, 31668, 31574, 31475,
+            31372, 31264, 31153, 31037, 30917, 30793, 30664, 30531, 30394, 30253,
+            30107, 29957, 29802, 29643, 29480, 29312, 29140, 28964, 28783, 28598,
+            28409, 28215, 28017, 27814, 27608, 27396, 27181, 26961, 26737, 26509,
+            26276, 26039, 25798, 25553, 25303, 25050, 24792, 24530, 24264, 23994,
+            23720, 23442, 23159, 22873, 22584, 22290, 21992, 21691, 21385, 21077,
+            20764, 20448, 20128, 19805, 19478, 19148, 18814, 18477, 18137, 17793,
+            17446, 17097, 16744, 16388, 16029, 15667, 15302, 14935, 14564, 14192,
+            13816, 13438, 13058, 12675, 12289, 11902, 11512, 11120, 10726, 10330,
+            9932, 9533, 9131, 8728, 8323, 7917, 7509, 7100, 6689, 6277,
+            5864, 5450, 5034, 4618, 4201, 3783, 3365, 2946, 2526, 2106,
+            1685, 1264, 843, 421, 0,
+        },
+        { // octave 7: 2 harmonics
+            0, -274, -548, -822, -1096, -1369, -1643, -1916, -2190, -2463,
+            -2736, -3009, -3281, -3554, -3826, -4097, -4369, -4640, -4911, -5181,
+            -5451, -5721, -5990, -6259, -6527, -6795, -7062, -7329, -7595, -7861,
+            -8126, -8390, -8654, -8917, -9180, -9441, -9703, -9963, -10223, -10481,
+            -10739, -10997, -11253, -11509, -11764, -12018, -12271, -12523, -12774, -13024,
+            -13273, -13521, -13769, -14015, -14260, -14504, -14747, -14989, -15230, -15470,
+            -15709, -15946, -16182, -16418, -16651, -16884, -17116, -17346, -17575, -17802,
+            -18029, -18254, -18477, -18700, -18921, -19140, -19358, -19575, -19791, -20005,
+            -20217, -20428, -20638, -20846, -21053, -21258, -21461, -21663, -21864, -22063,
+            -22260, -22456, -22650, -22842, -23033, -23222, -23410, -23596, -23780, -23963,
+            -24144, -24323, -24501, -24676, -24850, -25023, -25193, -25362, -25529, -25694,
+            -25858, -26020, -26180, -26338, -26494, -26648, -26801, -26952, -27101, -27248,
+            -27393, -27536, -27678, -27817, -27955, -28091, -28225, -28357, -28487, -28615,
+            -28741, -28865, -28988, -29108, -29227, -29344, -29458, -29571, -29682, -29791,
+            -29897, -30002, -30105, -30206, -30305, -30402, -30497, -30591, -30682, -30771,
+            -30858, -30943, -31027, -31108, -31187, -31265, -31340, -31413, -31485, -31554,
+            -31622, -31687, -31751, -31812, -31872, -31930, -31986, -32039, -32091, -32141,
+            -32189, -32235, -32279, -32321, -32361, -32399, -32436, -32470, -32503, -32533,
+            -32562, -32589, -32614, -32637, -32658, -32677, -32694, -32710, -32723, -32735,
+            -32745, -32753, -32759, -32764, -32766, -32767, -32766, -32763, -32759, -32752,
+            -32744, -32734, -32722, -32709, -32694, -32677, -32658, -32638, -32616, -32592,
+            -32566, -32539, -32511, -32480, -32448, -32414, -32379, -32342, -32303, -32263,
+            -32222, -32178, -32133, -32087, -32039, -31989, -31938, -31886, -31832, -31776,
+            -31719, -31661, -31601, -31540, -31477, -31413, -31348, -31281, -31212, -31143,
+            -31072, -30999, -30926, -30851, -30775, -30697, -30618, -30538, -30457, -30374,
+            -30291, -30206, -30120, -30032, -29944, -29854, -29763, -29671, -29579, -29484,
+            -29389, -29293, -29196, -29098, -28998, -28898, -28797, -28694, -28591, -28487,
+            -28382, -28275, -28168, -28061, -27952, -27842, -27732, -27620, -27508, -27395,
+            -27281, -27167, -27051, -26935, -26818, -26701, -26583, -26464, -26344, -26224,
+            -26103, -25981, -25859, -25736, -25612, -25488, -25364, -25239, -25113, -24987,
+            -24860, -24733, -24605, -24477, -24348, -24219, -24089, -23959, -23829, -23698,
+            -23567, -23435, -23303, -23171, -23038, -22905, -22772, -22639, -22505, -22371,
+            -22236, -22102, -21967, -21832, -21697, -21561, -21426, -21290, -21154, -21018,
+            -20882, -20745, -20609, -20472, -20336, -20199, -20062, -19925, -19788, -19651,
+            -19514, -19378, -19241, -19104, -18967, -18830, -18693, -18556, -18419, -18283,
+            -18146, -18009, -17873, -17737, -17600, -17464, -17328, -17192, -17057, -16921,
+            -16786, -16651, -16515, -16381, -16246, -16112, -15977, -15843, -15710, -15576,
+            -15443, -15310, -15177, -15044, -14912, -14780, -14648, -14517, -14386, -14255,
+            -14124, -13994, -13864, -13734, -13605, -13476, -13347, -13219, -13091, -12964,
+            -12836, -12709, -12583, -12457, -12331, -12205, -12080, -11956, -11831, -11707,
+            -11584, -11461, -11338, -11215, -11094, -10972, -10851, -10730, -10610, -10490,
+            -10370, -10251, -10132, -10014, -9896, -9778, -9661, -9545, -9428, -9312,
+            -9197, -9082, -8967, -8853, -8739, -8626, -8513, -8400, -8288, -8176,
+            -8065, -7954, -7844, -7733, -7624, -7514, -7405, -7297, -7189, -7081,
+            -6974, -6867, -6760, -6654, -6548, -6443, -6338, -6233, -6128, -6025,
+            -5921, -5818, -5715, -5612, -5510, -5408, -5307, -5205, -5104, -5004,
+            -4904, -4804, -4704, -4605, -4506, -4407, -4309, -4211, -4113, -4015,
+            -3918, -3821, -3724, -3628, -3532, -3436, -3340, -3244, -3149, -3054,
+            -2959, -2864, -2770, -2676, -2582, -2488, -2394, -2301, -2207, -2114,
+            -2021, -1928, -1835, -1743, -1650, -1558, -1466, -1374, -1282, -1190,
+            -1098, -1006, -914, -823, -731, -640, -548, -457, -365, -274,
+            -183, -91, 0, 91, 183, 274, 365, 457, 548, 640,
+            731, 823, 914, 1006, 1098, 1190, 1282, 1374, 1466, 1558,
+            1650, 1743, 1835, 1928, 2021, 2114, 2207, 2301, 2394, 2488,
+            2582, 2676, 2770, 2864, 2959, 3054, 3149, 3244, 3340, 3436,
+            3532, 3628, 3724, 3821, 3918, 4015, 4113, 4211, 4309, 4407,
+            4506, 4605, 4704, 4804, 4904, 5004, 5104, 5205, 5307, 5408,
+            5510, 5612, 5715, 5818, 5921, 6025, 6128, 6233, 6338, 6443,
+            6548, 6654, 6760, 6867, 6974, 7081, 7189, 7297, 7405, 7514,
+            7624, 7733, 7844, 7954, 8065, 8176, 8288, 8400, 8513, 8626,
+            8739, 8853, 8967, 9082, 9197, 9312, 9428, 9545, 9661, 9778,
+            9896, 10014, 10132, 10251, 10370, 10490, 10610, 10730, 10851, 10972,
+            11094, 11215, 11338, 11461, 11584, 11707, 11831, 11956, 12080, 12205,
+            12331, 12457, 12583, 12709, 12836, 12964, 13091, 13219, 13347, 13476,
+            13605, 13734, 13864, 13994, 14124, 14255, 14386, 14517, 14648, 14780,
+            14912, 15044, 15177, 15310, 15443, 15576, 15710, 15843, 15977, 16112,
+            16246, 16381, 16515, 16651, 16786, 16921, 17057, 17192, 17328, 17464,
+            17600, 17737, 17873, 18009, 18146, 18283, 18419, 18556, 18693, 18830,
+            18967, 19104, 19241, 19378, 19514, 19651, 19788, 19925, 20062, 20199,
+            20336, 20472, 20609, 20745, 20882, 21018, 21154, 21290, 21426, 21561,
+            21697, 21832, 21967, 22102, 22236, 22371, 22505, 22639, 22772, 22905,
+            23038, 23171, 23303, 23435, 23567, 23698, 23829, 23959, 24089, 24219,
+            24348, 24477, 24605, 24733, 24860, 24987, 25113, 25239, 25364, 25488,
+            25612, 25736, 25859, 25981, 26103, 26224, 26344, 26464, 26583, 26701,
+            26818, 26935, 27051, 27167, 27281, 27395, 27508, 27620, 27732, 27842,
+            27952, 28061, 28168, 28275, 28382, 28487, 28591, 28694, 28797, 28898,
+            28998, 29098, 29196, 29293, 29389, 29484, 29579, 29671, 29763, 29854,
+            29944, 30032, 30120, 30206, 30291, 30374, 30457, 30538, 30618, 30697,
+            30775, 30851, 30926, 30999, 31072, 31143, 31212, 31281, 31348, 31413,
+            31477, 31540, 31601, 31661, 31719, 31776, 31832, 31886, 31938, 31989,
+            32039, 32087, 32133, 32178, 32222, 32263, 32303, 32342, 32379, 32414,
+            32448, 32480, 32511, 32539, 32566, 32592, 32616, 32638, 32658, 32677,
+            32694, 32709, 32722, 32734, 32744, 32752, 32759, 32763, 32766, 32767,
+            32766, 32764, 32759, 32753, 32745, 32735, 32723, 32710, 32694, 32677,
+            32658, 32637, 32614, 32589, 32562, 32533, 32503, 32470, 32436, 32399,
+            32361, 32321, 32279, 32235, 32189, 32141, 32091, 32039, 31986, 31930,
+            31872, 31812, 31751, 31687, 31622, 31554, 31485, 31413, 31340, 31265,
+            31187, 31108, 31027, 30943, 30858, 30771, 30682, 30591, 30497, 30402,
+            30305, 30206, 30105, 30002, 29897, 29791, 29682, 29571, 29458, 29344,
+            29227, 29108, 28988, 28865, 28741, 28615, 28487, 28357, 28225, 28091,
+            27955, 27817, 27678, 27536, 27393, 27248, 27101, 26952, 26801, 26648,
+            26494, 26338, 26180, 26020, 25858, 25694, 25529, 25362, 25193, 25023,
+            24850, 24676, 24501, 24323, 24144, 23963, 23780, 23596, 23410, 23222,
+            23033, 22842, 22650, 22456, 22260, 22063, 21864, 21663, 21461, 21258,
+            21053, 20846, 20638, 20428, 20217, 20005, 19791, 19575, 19358, 19140,
+            18921, 18700, 18477, 18254, 18029, 17802, 17575, 17346, 17116, 16884,
+            16651, 16418, 16182, 15946, 15709, 15470, 15230, 14989, 14747, 14504,
+            14260, 14015, 13769, 13521, 13273, 13024, 12774, 12523, 12271, 12018,
+            11764, 11509, 11253, 10997, 10739, 10481, 10223, 9963, 9703, 9441,
+            9180, 8917, 8654, 8390, 8126, 7861, 7595, 7329, 7062, 6795,
+            6527, 6259, 5990, 5721, 5451, 5181, 4911, 4640, 4369, 4097,
+            3826, 3554, 3281, 3009, 2736, 2463, 2190, 1916, 1643, 1369,
+            1096, 822, 548, 274, 0,
+        },
+        { // octave 8: 1 harmonics
+            0, -201, -402, -603, -804, -1005, -1206, -1407, -1608, -1809,
+            -2009, -2210, -2410, -2611, -2811, -3012, -3212, -3412, -3612, -3811,
+            -4011, -4210, -4410, -4609, -4808, -5007, -5205, -5404, -5602, -5800,
+            -5998, -6195, -6393, -6590, -6786, -6983, -7179, -7375, -7571, -7767,
+            -7962, -8157, -8351, -8545, -8739, -8933, -9126, -9319, -9512, -9704,
+            -9896, -10087, -10278, -10469, -10659, -10849, -11039, -11228, -11417, -11605,
+            -11793, -11980, -12167, -12353, -12539, -12725, -12910, -13094, -13279, -13462,
+            -13645, -13828, -14010, -14191, -14372, -14553, -14732, -14912, -15090, -15269,
+            -15446, -15623, -15800, -15976, -16151, -16325, -16499, -16673, -16846, -17018,
+            -17189, -17360, -17530, -17700, -17869, -18037, -18204, -18371, -18537, -18703,
+            -18868, -19032, -19195, -19357, -19519, -19680, -19841, -20000, -20159, -20317,
+            -20475, -20631, -20787, -20942, -21096, -21250, -21403, -21554, -21705, -21856,
+            -22005, -22154, -22301, -22448, -22594, -22739, -22884, -23027, -23170, -23311,
+            -23452, -23592, -23731, -23870, -24007, -24143, -24279, -24413, -24547, -24680,
+            -24811, -24942, -25072, -25201, -25329, -25456, -25582, -25708, -25832, -25955,
+            -26077, -26198, -26319, -26438, -26556, -26674, -26790, -26905, -27019, -27133,
+            -27245, -27356, -27466, -27575, -27683, -27790, -27896, -28001, -28105, -28208,
+            -28310, -28411, -28510, -28609, -28706, -28803, -28898, -28992, -29085, -29177,
+            -29268, -29358, -29447, -29534, -29621, -29706, -29791, -29874, -29956, -30037,
+            -30117, -30195, -30273, -30349, -30424, -30498, -30571, -30643, -30714, -30783,
+            -30852, -30919, -30985, -31050, -31113, -31176, -31237, -31297, -31356, -31414,
+            -31470, -31526, -31580, -31633, -31685, -31736, -31785, -31833, -31880, -31926,
+            -31971, -32014, -32057, -32098, -32137, -32176, -32213, -32250, -32285, -32318,
+            -32351, -32382, -32412, -32441, -32469, -32495, -32521, -32545, -32567, -32589,
+            -32609, -32628, -32646, -32663, -32678, -32692, -32705, -32717, -32728, -32737,
+            -32745, -32752, -32757, -32761, -32765, -32766, -32767, -32766, -32765, -32761,
+            -32757, -32752, -32745, -32737, -32728, -32717, -32705, -32692, -32678, -32663,
+            -32646, -32628, -32609, -32589, -32567, -32545, -32521, -32495, -32469, -32441,
+            -32412, -32382, -32351, -32318, -32285, -32250, -32213, -32176, -32137, -32098,
+            -32057, -32014, -31971, -31926, -31880, -31833, -31785, -31736, -31685, -31633,
+            -31580, -31526, -31470, -31414, -31356, -31297, -31237, -31176, -31113, -31050,
+            -30985, -30919, -30852, -30783, -30714, -30643, -30571, -30498, -30424, -30349,
+            -30273, -30195, -30117, -30037, -29956, -29874, -29791, -29706, -29621, -29534,
+            -29447, -29358, -29268, -29177, -29085, -28992, -28898, -28803, -28706, -28609,
+            -28510, -28411, -28310, -28208, -28105, -28001, -27896, -27790, -27683, -27575,
+            -27466, -27356, -27245, -27133, -27019, -26905, -26790, -26674, -26556, -26438,
+            -26319, -26198, -26077, -25955, -25832, -25708, -25582, -25456, -25329, -25201,
+            -25072, -24942, -24811, -24680, -24547, -24413, -24279, -24143, -24007, -23870,
+            -23731, -23592, -23452, -23311, -23170, -23027, -22884, -22739, -22594, -22448,
+            -22301, -22154, -22005, -21856, -21705, -21554, -21403, -21250, -21096, -20942,
+            -20787, -20631, -20475, -20317, -20159, -20000, -19841, -19680, -19519, -19357,
+            -19195, -19032, -18868, -18703, -18537, -18371, -18204, -18037, -17869, -17700,
+            -17530, -17360, -17189, -17018, -16846, -16673, -16499, -16325, -16151, -15976,
+            -15800, -15623, -15446, -15269, -15090, -14912, -14732, -14553, -14372, -14191,
+            -14010, -13828, -13645, -13462, -13279, -13094, -12910, -12725, -12539, -12353,
+            -12167, -11980, -11793, -11605, -11417, -11228, -11039, -10849, -10659, -10469,
+            -10278, -10087, -9896, -9704, -9512, -9319, -9126, -8933, -8739, -8545,
+            -8351, -8157, -7962, -7767, -7571, -7375, -7179, -6983, -6786, -6590,
+            -6393, -6195, -5998, -5800, -5602, -5404, -5205, -5007, -4808, -4609,
+            -4410, -4210, -4011, -3811, -3612, -3412, -3212, -3012, -2811, -2611,
+            -2410, -2210, -2009, -1809, -1608, -1407, -1206, -1005, -804, -603,
+            -402, -201, 0, 201, 402, 603, 804, 1005, 1206, 1407,
+            1608, 1809, 2009, 2210, 2410, 2611, 2811, 3012, 3212, 3412,
+            3612, 3811, 4011, 4210, 4410, 4609, 4808, 5007, 5205, 5404,
+            5602, 5800, 5998, 6195, 6393, 6590, 6786, 6983, 7179, 7375,
+            7571, 7767, 7962, 8157, 8351, 8545, 8739, 8933, 9126, 9319,
+            9512, 9704, 9896, 10087, 10278, 10469, 10659, 10849, 11039, 11228,
+            11417, 11605, 11793, 11980, 12167, 12353, 12539, 12725, 12910, 13094,
+            13279, 13462, 13645, 13828, 14010, 14191, 14372, 14553, 14732, 14912,
+            15090, 15269, 15446, 15623, 15800, 15976, 16151, 16325, 16499, 16673,
+            16846, 17018, 17189, 17360, 17530, 17700, 17869, 18037, 18204, 18371,
+            18537, 18703, 18868, 19032, 19195, 19357, 19519, 19680, 19841, 20000,
+            20159, 20317, 20475, 20631, 20787, 20942, 21096, 21250, 21403, 21554,
+            21705, 21856, 22005, 22154, 22301, 22448, 22594, 22739, 22884, 23027,
+            23170, 23311, 23452, 23592, 23731, 23870, 24007, 24143, 24279, 24413,
+            24547, 24680, 24811, 24942, 25072, 25201, 25329, 25456, 25582, 25708,
+            25832, 25955, 26077, 26198, 26319, 26438, 26556, 26674, 26790, 26905,
+            27019, 27133, 27245, 27356, 27466, 27575, 27683, 27790, 27896, 28001,
+            28105, 28208, 28310, 28411, 28510, 28609, 28706, 28803, 28898, 28992,
+            29085, 29177, 29268, 29358, 29447, 29534, 29621, 29706, 29791, 29874,
+            29956, 30037, 30117, 30195, 30273, 30349, 30424, 30498, 30571, 30643,
+            30714, 30783, 30852, 30919, 30985, 31050, 31113, 31176, 31237, 31297,
+            31356, 31414, 31470, 31526, 31580, 31633, 31685, 31736, 31785, 31833,
+            31880, 31926, 31971, 32014, 32057, 32098, 32137, 32176, 32213, 32250,
+            32285, 32318, 32351, 32382, 32412, 32441, 32469, 32495, 32521, 32545,
+            32567, 32589, 32609, 32628, 32646, 32663, 32678, 32692, 32705, 32717,
+            32728, 32737, 32745, 32752, 32757, 32761, 32765, 32766, 32767, 32766,
+            32765, 32761, 32757, 32752, 32745, 32737, 32728, 32717, 32705, 32692,
+            32678, 32663, 32646, 32628, 32609, 32589, 32567, 32545, 32521, 32495,
+            32469, 32441, 32412, 32382, 32351, 32318, 32285, 32250, 32213, 32176,
+            32137, 32098, 32057, 32014, 31971, 31926, 31880, 31833, 31785, 31736,
+            31685, 31633, 31580, 31526, 31470, 31414, 31356, 31297, 31237, 31176,
+            31113, 31050, 30985, 30919, 30852, 30783, 30714, 30643, 30571, 30498,
+            30424, 30349, 30273, 30195, 30117, 30037, 29956, 29874, 29791, 29706,
+            29621, 29534, 29447, 29358, 29268, 29177, 29085, 28992, 28898, 28803,
+            28706, 28609, 28510, 28411, 28310, 28208, 28105, 28001, 27896, 27790,
+            27683, 27575, 27466, 27356, 27245, 27133, 27019, 26905, 26790, 26674,
+            26556, 26438, 26319, 26198, 26077, 25955, 25832, 25708, 25582, 25456,
+            25329, 25201, 25072, 24942, 24811, 24680, 24547, 24413, 24279, 24143,
+            24007, 23870, 23731, 23592, 23452, 23311, 23170, 23027, 22884, 22739,
+            22594, 22448, 22301, 22154, 22005, 21856, 21705, 21554, 21403, 21250,
+            21096, 20942, 20787, 20631, 20475, 20317, 20159, 20000, 19841, 19680,
+            19519, 19357, 19195, 19032, 18868, 18703, 18537, 18371, 18204, 18037,
+            17869, 17700, 17530, 17360, 17189, 17018, 16846, 16673, 16499, 16325,
+            16151, 15976, 15800, 15623, 15446, 15269, 15090, 14912, 14732, 14553,
+            14372, 14191, 14010, 13828, 13645, 13462, 13279, 13094, 12910, 12725,
+            12539, 12353, 12167, 11980, 11793, 11605, 11417, 11228, 11039, 10849,
+            10659, 10469, 10278, 10087, 9896, 9704, 9512, 9319, 9126, 8933,
+            8739, 8545, 8351, 8157, 7962, 7767, 7571, 7375, 7179, 6983,
+            6786, 6590, 6393, 6195, 5998, 5800, 5602, 5404, 5205, 5007,
+            4808, 4609, 4410, 4210, 4011, 3811, 3612, 3412, 3212, 3012,
+            2811, 2611, 2410, 2210, 2009, 1809, 1608, 1407, 1206, 1005,
+            804, 603, 402, 201, 0,
+        },
+    },
+};
+// clang-format on
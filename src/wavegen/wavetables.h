@@ -0,0 +1,17 @@
+// Generated by scripts/gen_wavetables.py - do not edit
+#ifndef WAVETABLES_H
+#define WAVETABLES_H
+
+#include <stdint.h>
+
+#define WT_BITS 10
+#define WT_SIZE 1024
+#define WT_OCTAVES 9
+#define WT_OCTAVE_SHIFT 23 // Table k serves increments below 2^(WT_OCTAVE_SHIFT + k)
+
+enum { WT_SQUARE, WT_TRIANGLE, WT_SAW, WT_WAVES };
+
+extern const int16_t wt_sine[WT_SIZE + 1];
+extern const int16_t wt_bank[WT_WAVES][WT_OCTAVES][WT_SIZE + 1];
+
+#endif
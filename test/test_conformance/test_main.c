@@ -0,0 +1,269 @@
+// Conformance of the C engine against golden vectors from the Python reference model
+// (scripts/waveform_test.py, exported by scripts/export_golden.py). Runs on the host:
+//     pio test -e native
+//
+// Every vector is rendered through both kernels and compared two ways:
+//   samples   RMS and peak error in % of full scale, for sounds with no noise in them
+//             (the model's noise comes from NumPy, the engine's from its own xorshift)
+//   envelope  worst level difference in dB between 256-sample RMS windows, where the
+//             model is above -40 dBFS - checks decay, glide-free loudness and the
+//             compressor on every vector, noisy or not
+// Each report line carries the render throughput next to its pass/fail, so a kernel
+// change is shown to be both correct and faster.
+//
+// Known differences:
+// - the model boosts sine by 1.1 after the compressor and the engine does not; the test
+//   applies the same gain and clip to the engine's sine before comparing
+// - the engine's square/saw/triangle are band-limited and peak-normalized where the
+//   model's are naive: error at the edges, and the level drifts as harmonics drop out
+//   at high pitch (covered by their tolerances)
+
+#include "unity.h"
+#include "wavegen/presets.h"
+#include "wavegen/pwm_audio.h"
+#include "wavegen/waveform_gen.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define GOLDEN_PATH "test/golden/vectors.bin" // From the project dir; GOLDEN_VECTORS overrides
+#define GOLDEN_VERSION 1
+#define ENV_WINDOW 256
+#define ENV_FLOOR 0.01f // -40 dBFS: quieter windows are all noise floor and rounding
+#define TIMING_RUNS 3   // Best-of for the throughput column
+#define MODEL_SINE_GAIN 1.1f
+
+// Tolerances by oscillator; any noise in the sound makes it a level-only comparison
+static const struct {
+    float rms;    // % FS
+    float env_db; // Worst window
+} tolerance[5] = {
+    {1.0f, 0.5f},  // Sine: the same shape in both
+    {12.0f, 2.0f}, // Square: band-limited edges ring where the naive ones jump
+    {4.0f, 0.5f},  // Triangle: rounded corners, peak-normalized ~3% louder at high pitch
+    {12.0f, 2.0f}, // Saw: as square
+    {0.0f, 2.0f},  // Noise
+};
+#define TOL_ENV_NOISE_DB 2.0f // Two generators, each window a 256-sample estimate
+
+typedef struct {
+    char name[24];
+    WaveParams params;
+    int length;
+    int16_t* samples;
+} Golden;
+
+static Golden* vectors;
+static int vector_count;
+static int32_t* render_buf;
+
+static bool load_golden(const char* path) {
+    FILE* f = fopen(path, "rb");
+    if (!f)
+        return false;
+
+    char magic[4];
+    uint32_t header[3];
+    if (fread(magic, 1, 4, f) != 4 || memcmp(magic, "WGLD", 4) != 0 ||
+        fread(header, sizeof(uint32_t), 3, f) != 3 || header[0] != GOLDEN_VERSION ||
+        header[2] != (uint32_t) SAMPLE_RATE) {
+        fclose(f);
+        return false;
+    }
+
+    vector_count = (int) header[1];
+    vectors = calloc((size_t) vector_count, sizeof(Golden));
+    int max_len = 0;
+    for (int i = 0; i < vector_count; i++) {
+        Golden* g = &vectors[i];
+        float p[9];
+        uint32_t length;
+        if (fread(g->name, 1, 24, f) != 24 || fread(p, sizeof(float), 9, f) != 9 ||
+            fread(&length, sizeof(length), 1, f) != 1) {
+            fclose(f);
+            return false;
+        }
+        g->name[23] = '\0';
+        g->params = (WaveParams) {.frequency = p[0],
+                                  .amplitude = p[1],
+                                  .decay = p[2],
+                                  .waveform_id = (int) p[3],
+                                  .offset_dc = p[4],
+                                  .pitch_decay = p[5],
+                                  .noise_mix = p[6],
+                                  .env_curve = p[7],
+                                  .comp_amount = p[8]};
+        g->length = (int) length;
+        g->samples = malloc(length * sizeof(int16_t));
+        if (fread(g->samples, sizeof(int16_t), length, f) != length) {
+            fclose(f);
+            return false;
+        }
+        if (g->length > max_len)
+            max_len = g->length;
+    }
+    fclose(f);
+
+    render_buf = malloc((size_t) (max_len + 1) * sizeof(int32_t));
+    return true;
+}
+
+void setUp(void) {}
+
+void tearDown(void) {
+    waveform_set_kernel(WAVEGEN_KERNEL_DEFAULT);
+}
+
+// ==================================================
+// METRICS
+// ==================================================
+typedef struct {
+    int length;    // Samples the engine rendered
+    float rms_err; // % FS
+    float max_err; // % FS
+    float env_db;  // Worst window level difference
+    double ns;     // Render time per sample
+} Result;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000u + (uint64_t) ts.tv_nsec;
+}
+
+static Result measure(const Golden* g, WaveKernel kernel) {
+    Result r = {0};
+    r.ns = INFINITY;
+
+    waveform_set_kernel(kernel);
+    for (int run = 0; run < TIMING_RUNS; run++) {
+        WaveVoice v;
+        waveform_voice_start(&v, &g->params);
+        uint64_t start = now_ns();
+        r.length = waveform_voice_render_q15(&v, render_buf, g->length + 1);
+        double ns = (double) (now_ns() - start) / (g->length + 1);
+        if (ns < r.ns)
+            r.ns = ns;
+    }
+
+    if (g->params.waveform_id == 0) {
+        for (int i = 0; i < r.length; i++) {
+            float x = render_buf[i] * MODEL_SINE_GAIN;
+            render_buf[i] = (int32_t) fmaxf(-32768.0f, fminf(32768.0f, x));
+        }
+    }
+
+    // Q15: the engine spans +-32768, the model +-32767
+    int n = (r.length < g->length) ? r.length : g->length;
+    double sum = 0.0;
+    for (int i = 0; i < n; i++) {
+        float d = fabsf((float) render_buf[i] - g->samples[i]) * (100.0f / 32768.0f);
+        sum += (double) d * d;
+        if (d > r.max_err)
+            r.max_err = d;
+    }
+    r.rms_err = (n > 0) ? (float) sqrt(sum / n) : 0.0f;
+
+    for (int w = 0; w + ENV_WINDOW <= n; w += ENV_WINDOW) {
+        double a = 0.0, b = 0.0;
+        for (int i = w; i < w + ENV_WINDOW; i++) {
+            a += (double) render_buf[i] * render_buf[i];
+            b += (double) g->samples[i] * g->samples[i];
+        }
+        float level_c = (float) sqrt(a / ENV_WINDOW) / 32768.0f;
+        float level_py = (float) sqrt(b / ENV_WINDOW) / 32767.0f;
+        if (level_py < ENV_FLOOR)
+            continue;
+        float db = fabsf(20.0f * log10f(fmaxf(level_c, 1e-6f) / level_py));
+        if (db > r.env_db)
+            r.env_db = db;
+    }
+    return r;
+}
+
+static bool noisy(const WaveParams* p) {
+    return p->waveform_id == 4 || p->noise_mix > 0.0f;
+}
+
+// Checks one vector on one kernel and prints its report line; true on pass
+static bool check(const Golden* g, WaveKernel kernel) {
+    Result r = measure(g, kernel);
+    const WaveParams* p = &g->params;
+
+    float tol_rms = tolerance[p->waveform_id].rms;
+    float tol_env = noisy(p) ? TOL_ENV_NOISE_DB : tolerance[p->waveform_id].env_db;
+
+    bool pass = abs(r.length - g->length) <= 1; // decay * rate rounds in float vs double
+    if (!noisy(p))
+        pass &= r.rms_err <= tol_rms;
+    pass &= r.env_db <= tol_env;
+
+    char rms[16] = "-";
+    if (!noisy(p))
+        snprintf(rms, sizeof(rms), "%.2f/%.0f", r.rms_err, tol_rms);
+    printf("%s %-24s %-5s len %6d/%-6d rms %% %-10s max %% %6.2f  env dB %.2f/%.1f  "
+           "%7.2f ns/sample %10.0f samples/s\n",
+           pass ? "PASS" : "FAIL", g->name, (kernel == WAVE_KERNEL_FLOAT) ? "float" : "fixed",
+           r.length, g->length, rms, r.max_err, r.env_db, tol_env, r.ns, 1e9 / r.ns);
+    return pass;
+}
+
+static int check_range(bool presets) {
+    int failures = 0;
+    for (int i = 0; i < vector_count; i++) {
+        if ((strncmp(vectors[i].name, "preset_", 7) == 0) != presets)
+            continue;
+        failures += !check(&vectors[i], WAVE_KERNEL_FIXED);
+        failures += !check(&vectors[i], WAVE_KERNEL_FLOAT);
+    }
+    return failures;
+}
+
+// ==================================================
+// TESTS
+// ==================================================
+// The exported presets must still be the firmware's (re-run export_golden.py if not)
+static void test_golden_presets_current(void) {
+    int n = 0;
+    for (int i = 0; i < vector_count; i++) {
+        if (strncmp(vectors[i].name, "preset_", 7) != 0)
+            continue;
+        TEST_ASSERT_TRUE_MESSAGE(n < num_presets, "more golden presets than drum_presets");
+        const WaveParams* a = &vectors[i].params;
+        const WaveParams* b = &drum_presets[n++];
+        TEST_ASSERT_TRUE_MESSAGE(a->frequency == b->frequency && a->amplitude == b->amplitude &&
+                                     a->decay == b->decay && a->waveform_id == b->waveform_id &&
+                                     a->offset_dc == b->offset_dc &&
+                                     a->pitch_decay == b->pitch_decay &&
+                                     a->noise_mix == b->noise_mix &&
+                                     a->env_curve == b->env_curve &&
+                                     a->comp_amount == b->comp_amount,
+                                 vectors[i].name);
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(num_presets, n, "drum_presets missing from the golden set");
+}
+
+static void test_presets_conform(void) {
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, check_range(true), "preset renders out of tolerance");
+}
+
+static void test_grid_conforms(void) {
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, check_range(false), "grid renders out of tolerance");
+}
+
+int main(int argc, char** argv) {
+    const char* path = getenv("GOLDEN_VECTORS");
+    if (!load_golden(path ? path : GOLDEN_PATH)) {
+        printf("Cannot read golden vectors at %s (run scripts/export_golden.py)\n",
+               path ? path : GOLDEN_PATH);
+        return 1;
+    }
+
+    UNITY_BEGIN();
+    RUN_TEST(test_golden_presets_current);
+    RUN_TEST(test_presets_conform);
+    RUN_TEST(test_grid_conforms);
+    return UNITY_END();
+}
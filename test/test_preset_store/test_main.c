@@ -0,0 +1,295 @@
+// Preset store (src/wavegen/preset_store.c) on the NOR flash image of lib/hal_native:
+//     pio test -e native -f test_preset_store
+//
+// Every test keeps a model of what each slot should hold and checks the store against it,
+// before and after a remount (preset_store_init on the flash as left behind):
+//   edits       random saves, overwrites and deletes, across many compactions
+//   renders     stored renders match a direct render of the sound, and survive compaction
+//   power cuts  a save cut off at its Nth flash operation (hal_native_flash_fail_after),
+//               for every N the save takes, then a remount: each slot must hold its old
+//               or its new record, and the store must take new saves
+
+#include "hal_native.h"
+#include "pico/stdlib.h"
+#include "unity.h"
+#include "wavegen/preset_store.h"
+#include "wavegen/presets.h"
+#include "wavegen/waveform_gen.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define STORE ((uint8_t*) hal_native_flash + PRESET_STORE_OFFSET)
+#define EDIT_SLOTS 12  // Slots the random edits use, so records get overwritten
+#define EDIT_OPS 6000
+#define REMOUNT_EVERY 97
+#define MAX_RENDER 32768 // Samples; longer than any preset
+#define PAGE_BYTES 256   // FLASH_PAGE_SIZE: record headers and sample pages
+
+typedef struct {
+    bool live;
+    bool rendered;
+    WaveParams params;
+} Slot;
+
+static Slot model[PRESET_STORE_SLOTS];
+static int32_t render_buf[MAX_RENDER];
+static uint8_t snapshot[PRESET_STORE_BYTES];
+
+// Blank flash, as on a new board
+static void format(void) {
+    memset(STORE, 0xFF, PRESET_STORE_BYTES);
+    memset(model, 0, sizeof(model));
+    hal_native_flash_fail_after(-1);
+    TEST_ASSERT_TRUE(preset_store_init());
+}
+
+void setUp(void) {
+    srand(362);
+    format();
+}
+
+void tearDown(void) {
+    hal_native_flash_fail_after(-1);
+}
+
+// ==================================================
+// CHECKS
+// ==================================================
+static bool slot_matches(int slot, const Slot* s) {
+    const PresetRecord* r = preset_store_get(slot);
+    if (!r || !s->live)
+        return !r && !s->live;
+    return memcmp(&r->params, &s->params, sizeof(WaveParams)) == 0 &&
+           (preset_store_samples(r) != NULL) == s->rendered;
+}
+
+static void check_model(void) {
+    for (int slot = 0; slot < PRESET_STORE_SLOTS; slot++) {
+        TEST_ASSERT_TRUE_MESSAGE(slot_matches(slot, &model[slot]), "slot differs from model");
+    }
+}
+
+static void check_remount(void) {
+    check_model();
+    TEST_ASSERT_TRUE(preset_store_init());
+    check_model();
+}
+
+// The stored render must be the engine's, saturated to 16 bits
+static void check_render(int slot) {
+    const PresetRecord* r = preset_store_get(slot);
+    WaveVoice v;
+    waveform_voice_start(&v, &r->params);
+    int n = waveform_voice_render_q15(&v, render_buf, MAX_RENDER);
+    TEST_ASSERT_EQUAL_INT(n, (int) r->length);
+
+    const int16_t* samples = preset_store_samples(r);
+    for (int i = 0; i < n; i++) {
+        int32_t x = (render_buf[i] > 32767) ? 32767 : render_buf[i];
+        TEST_ASSERT_EQUAL_INT16(x, samples[i]);
+    }
+}
+
+static WaveParams random_sound(bool short_render) {
+    WaveParams p = drum_presets[rand() % num_presets];
+    p.amplitude = (rand() % 100) / 100.0f;
+    if (short_render)
+        p.decay = 0.02f + (rand() % 20) / 100.0f; // Keeps renders to a few pages
+    return p;
+}
+
+static void save(int slot, const WaveParams* p, bool render) {
+    TEST_ASSERT_TRUE(preset_store_save(slot, "test", p, render));
+    model[slot] = (Slot) {true, render, *p};
+}
+
+// ==================================================
+// TESTS
+// ==================================================
+static void test_edits_across_remounts(void) {
+    uint32_t first_gen;
+    PresetStoreStats stats;
+    preset_store_get_stats(&stats);
+    first_gen = stats.generation;
+
+    for (int op = 0; op < EDIT_OPS; op++) {
+        int slot = rand() % EDIT_SLOTS;
+        if (rand() % 8 == 0) {
+            TEST_ASSERT_TRUE(preset_store_delete(slot));
+            model[slot].live = false;
+        } else {
+            bool render = rand() % 6 == 0;
+            WaveParams p = random_sound(render);
+            save(slot, &p, render);
+        }
+        if (op % REMOUNT_EVERY == 0)
+            check_remount();
+    }
+    check_remount();
+
+    preset_store_get_stats(&stats);
+    TEST_ASSERT_TRUE_MESSAGE(stats.generation > first_gen + 2, "too few compactions");
+}
+
+static void test_renders_survive_compaction(void) {
+    for (int p = 0; p < num_presets; p++) {
+        save(p, &drum_presets[p], true);
+        check_render(p);
+    }
+
+    // Churn another slot until the presets have been copied through several compactions
+    PresetStoreStats stats;
+    preset_store_get_stats(&stats);
+    uint32_t gen = stats.generation;
+    while (stats.generation < gen + 3) {
+        WaveParams p = random_sound(true);
+        save(PRESET_STORE_SLOTS - 1, &p, true);
+        preset_store_get_stats(&stats);
+    }
+
+    check_remount();
+    for (int p = 0; p < num_presets; p++) {
+        check_render(p);
+    }
+}
+
+static void test_oversized_save_keeps_old_record(void) {
+    WaveParams kick = drum_presets[0];
+    save(1, &kick, true);
+
+    WaveParams huge = drum_presets[0];
+    huge.decay = 10.0f; // 220500 samples: more than half the store
+    TEST_ASSERT_FALSE(preset_store_save(1, "huge", &huge, true));
+    check_remount();
+}
+
+// One save cut off after n flash operations; false if it completed
+static bool cut_save(int n, int slot, const WaveParams* p, bool render) {
+    memcpy(STORE, snapshot, PRESET_STORE_BYTES);
+    TEST_ASSERT_TRUE(preset_store_init());
+
+    hal_native_flash_fail_after(n);
+    bool saved = preset_store_save(slot, "cut", p, render);
+    hal_native_flash_fail_after(-1);
+    if (saved)
+        return false;
+
+    // Power back on: the slot holds its old or its new record, the others are untouched
+    TEST_ASSERT_TRUE(preset_store_init());
+    Slot fresh = {true, render, *p};
+    TEST_ASSERT_TRUE_MESSAGE(slot_matches(slot, &model[slot]) || slot_matches(slot, &fresh),
+                             "cut slot holds neither record");
+    for (int s = 0; s < PRESET_STORE_SLOTS; s++) {
+        if (s != slot)
+            TEST_ASSERT_TRUE_MESSAGE(slot_matches(s, &model[s]), "cut save hit another slot");
+    }
+
+    // And keeps working
+    Slot before = model[slot];
+    save(slot, p, render);
+    check_remount();
+    model[slot] = before;
+    return true;
+}
+
+static void cut_every_step(int slot, const WaveParams* p, bool render) {
+    memcpy(snapshot, STORE, PRESET_STORE_BYTES);
+    int n = 0;
+    while (cut_save(n, slot, p, render)) {
+        n++;
+    }
+    TEST_ASSERT_TRUE_MESSAGE(n > 0, "save took no flash operations");
+
+    memcpy(STORE, snapshot, PRESET_STORE_BYTES); // As before the save
+    TEST_ASSERT_TRUE(preset_store_init());
+}
+
+// Fills the active half with params-only saves to slot until a save of p with its render
+// has to compact
+static void fill_half(int slot, const WaveParams* p) {
+    WaveVoice v;
+    waveform_voice_start(&v, p);
+    int span = PAGE_BYTES + (v.total_samples * 2 + PAGE_BYTES - 1) / PAGE_BYTES * PAGE_BYTES;
+    PresetStoreStats stats;
+    preset_store_get_stats(&stats);
+    while (stats.bytes_free >= span) {
+        WaveParams q = random_sound(false);
+        save(slot, &q, false);
+        preset_store_get_stats(&stats);
+    }
+}
+
+static void test_power_cut_append(void) {
+    for (int s = 0; s < EDIT_SLOTS; s++) {
+        WaveParams p = random_sound(true);
+        save(s, &p, s % 3 == 0);
+    }
+    WaveParams p = random_sound(true);
+    cut_every_step(0, &p, true);           // Overwrite, with a render
+    cut_every_step(EDIT_SLOTS, &p, false); // New slot, params only
+}
+
+static void test_power_cut_compaction(void) {
+    for (int s = 0; s < EDIT_SLOTS; s++) {
+        WaveParams p = random_sound(true);
+        save(s, &p, true);
+    }
+
+    WaveParams p = random_sound(true);
+    fill_half(EDIT_SLOTS + 1, &p);
+    PresetStoreStats stats;
+    preset_store_get_stats(&stats);
+    uint32_t gen = stats.generation;
+    cut_every_step(2, &p, true);
+
+    save(2, &p, true);
+    preset_store_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(gen + 1, stats.generation, "save didn't compact");
+}
+
+// A cut compaction leaves whole records in the other half; the next compaction copies a
+// smaller live set there and must not pick them up
+static void test_power_cut_compaction_then_deletes(void) {
+    for (int s = 1; s < 10; s++) {
+        WaveParams p = random_sound(true);
+        save(s, &p, true);
+    }
+    WaveParams p = random_sound(true);
+    fill_half(EDIT_SLOTS + 1, &p);
+
+    Slot kept[PRESET_STORE_SLOTS];
+    memcpy(snapshot, STORE, PRESET_STORE_BYTES);
+    memcpy(kept, model, sizeof(model));
+    for (int n = 0;; n++) {
+        memcpy(STORE, snapshot, PRESET_STORE_BYTES);
+        memcpy(model, kept, sizeof(model));
+        TEST_ASSERT_TRUE(preset_store_init());
+
+        hal_native_flash_fail_after(n);
+        bool saved = preset_store_save(0, "cut", &p, true);
+        hal_native_flash_fail_after(-1);
+        if (saved)
+            break;
+
+        // The half header is the save's last write: cut anywhere, the old half mounts
+        TEST_ASSERT_TRUE(preset_store_init());
+        check_model();
+        for (int s = 5; s < 10; s++) {
+            TEST_ASSERT_TRUE(preset_store_delete(s));
+            model[s].live = false;
+        }
+        save(0, &p, true);
+        check_remount();
+    }
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_edits_across_remounts);
+    RUN_TEST(test_renders_survive_compaction);
+    RUN_TEST(test_oversized_save_keeps_old_record);
+    RUN_TEST(test_power_cut_append);
+    RUN_TEST(test_power_cut_compaction);
+    RUN_TEST(test_power_cut_compaction_then_deletes);
+    return UNITY_END();
+}
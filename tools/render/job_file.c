@@ -0,0 +1,184 @@
+#include "job_file.h"
+#include "wavegen/presets.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_KEYS 16   // Swept keys per line
+#define MAX_VALUES 64 // Values per key
+
+static const struct {
+    const char* name;
+    size_t offset;
+    bool is_int;
+} fields[] = {
+    {"frequency", offsetof(WaveParams, frequency), false},
+    {"amplitude", offsetof(WaveParams, amplitude), false},
+    {"decay", offsetof(WaveParams, decay), false},
+    {"waveform_id", offsetof(WaveParams, waveform_id), true},
+    {"waveform", offsetof(WaveParams, waveform_id), true},
+    {"offset_dc", offsetof(WaveParams, offset_dc), false},
+    {"pitch_decay", offsetof(WaveParams, pitch_decay), false},
+    {"noise_mix", offsetof(WaveParams, noise_mix), false},
+    {"env_curve", offsetof(WaveParams, env_curve), false},
+    {"comp_amount", offsetof(WaveParams, comp_amount), false},
+    {"env_attack", offsetof(WaveParams, env_attack), false},
+    {"env_hold", offsetof(WaveParams, env_hold), false},
+    {"filter_type", offsetof(WaveParams, filter_type), true},
+    {"filter_cutoff", offsetof(WaveParams, filter_cutoff), false},
+    {"filter_res", offsetof(WaveParams, filter_res), false},
+    {"filter_env", offsetof(WaveParams, filter_env), false},
+    {"filter_decay", offsetof(WaveParams, filter_decay), false},
+};
+#define NUM_FIELDS ((int) (sizeof(fields) / sizeof(fields[0])))
+
+typedef struct {
+    int field;
+    int count;
+    float values[MAX_VALUES];
+} Axis;
+
+static int find_field(const char* name) {
+    for (int i = 0; i < NUM_FIELDS; i++) {
+        if (!strcmp(fields[i].name, name))
+            return i;
+    }
+    return -1;
+}
+
+// "a", "a,b,c" or "lo:hi:n" -> values; false if malformed
+static bool parse_values(char* s, Axis* a) {
+    char* end;
+    float lo, hi;
+    long n;
+
+    a->count = 0;
+    if (strchr(s, ':')) {
+        lo = strtof(s, &end);
+        if (*end != ':')
+            return false;
+        hi = strtof(end + 1, &end);
+        if (*end != ':')
+            return false;
+        n = strtol(end + 1, &end, 10);
+        if (*end || n < 1 || n > MAX_VALUES)
+            return false;
+        for (int i = 0; i < n; i++) {
+            a->values[a->count++] = (n == 1) ? lo : lo + (hi - lo) * i / (float) (n - 1);
+        }
+        return true;
+    }
+    for (char* tok = strtok(s, ","); tok; tok = strtok(NULL, ",")) {
+        if (a->count == MAX_VALUES)
+            return false;
+        a->values[a->count++] = strtof(tok, &end);
+        if (*end || end == tok)
+            return false;
+    }
+    return a->count > 0;
+}
+
+static void set_field(WaveParams* p, int field, float value) {
+    char* dst = (char*) p + fields[field].offset;
+    if (fields[field].is_int) {
+        int v = (int) value;
+        memcpy(dst, &v, sizeof(v));
+    } else {
+        memcpy(dst, &value, sizeof(value));
+    }
+}
+
+static bool parse_line(char* line, RenderJob** jobs, int* count) {
+    Axis axes[MAX_KEYS];
+    int num_axes = 0;
+    WaveParams base = {0};
+    char* name = strtok(line, " \t");
+    char* tokens[MAX_KEYS + 1];
+    int num_tokens = 0;
+
+    // Collect first: parse_values() also uses strtok
+    for (char* tok = strtok(NULL, " \t"); tok; tok = strtok(NULL, " \t")) {
+        if (num_tokens == MAX_KEYS + 1)
+            return false;
+        tokens[num_tokens++] = tok;
+    }
+
+    for (int t = 0; t < num_tokens; t++) {
+        char* eq = strchr(tokens[t], '=');
+        if (!eq)
+            return false;
+        *eq = '\0';
+        if (!strcmp(tokens[t], "preset")) {
+            int idx = atoi(eq + 1);
+            if (idx < 0 || idx >= num_presets)
+                return false;
+            base = drum_presets[idx];
+            continue;
+        }
+        if (num_axes == MAX_KEYS)
+            return false;
+        Axis* a = &axes[num_axes++];
+        a->field = find_field(tokens[t]);
+        if (a->field < 0 || !parse_values(eq + 1, a))
+            return false;
+    }
+
+    long combos = 1;
+    for (int i = 0; i < num_axes; i++) {
+        combos *= axes[i].count;
+        if (*count + combos > JOB_FILE_MAX_JOBS)
+            return false;
+    }
+
+    RenderJob* grown = realloc(*jobs, (size_t) (*count + combos) * sizeof(RenderJob));
+    if (!grown)
+        return false;
+    *jobs = grown;
+
+    // Mixed-radix counter over the axes; the last key varies fastest
+    for (long c = 0; c < combos; c++) {
+        RenderJob* j = &(*jobs)[(*count)++];
+        j->params = base;
+        long rest = c;
+        for (int i = num_axes - 1; i >= 0; i--) {
+            set_field(&j->params, axes[i].field, axes[i].values[rest % axes[i].count]);
+            rest /= axes[i].count;
+        }
+        if (combos == 1)
+            snprintf(j->name, JOB_NAME_LEN, "%s", name);
+        else
+            snprintf(j->name, JOB_NAME_LEN, "%.40s_%0*ld", name, (combos > 1000) ? 6 : 3, c);
+    }
+    return true;
+}
+
+bool job_file_load(const char* path, RenderJob** jobs, int* count) {
+    FILE* f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "%s: cannot open\n", path);
+        return false;
+    }
+
+    char line[1024];
+    char copy[1024];
+    int line_no = 0;
+    while (fgets(line, sizeof(line), f)) {
+        line_no++;
+        char* hash = strchr(line, '#');
+        if (hash)
+            *hash = '\0';
+        line[strcspn(line, "\r\n")] = '\0';
+        if (strspn(line, " \t") == strlen(line))
+            continue;
+
+        strcpy(copy, line);
+        if (!parse_line(line, jobs, count)) {
+            fprintf(stderr, "%s:%d: bad job: %s\n", path, line_no, copy);
+            fclose(f);
+            return false;
+        }
+    }
+    fclose(f);
+    return true;
+}
@@ -0,0 +1,26 @@
+#ifndef JOB_FILE_H
+#define JOB_FILE_H
+
+#include "wavegen/waveform_gen.h"
+
+// Render job list. One sound per line, expanded into every combination of its values:
+//     name [preset=N] key=value ...
+//     kick_sweep preset=0 frequency=40:80:5 decay=0.2,0.4
+// A value is a number, a list a,b,c, or a range lo:hi:n (n evenly spaced points, ends
+// included). Keys are the WaveParams field names (waveform also works for waveform_id).
+// preset=N starts from drum_presets[N], otherwise from all zeros. A line with more than
+// one combination names its jobs name_000, name_001, ... '#' starts a comment.
+
+#define JOB_NAME_LEN 64
+#define JOB_FILE_MAX_JOBS 1000000
+
+typedef struct {
+    char name[JOB_NAME_LEN];
+    WaveParams params;
+} RenderJob;
+
+// Appends the jobs in path to *jobs (realloc'd, *count updated). Prints the offending
+// line and returns false on a parse error.
+bool job_file_load(const char* path, RenderJob** jobs, int* count);
+
+#endif
@@ -0,0 +1,121 @@
+#include "job_queue.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+// [lo, hi) packed as lo | hi << 32. The owner moves lo up, thieves move hi down. A job
+// index is never handed out twice, so a range can't return to an earlier value (no ABA).
+typedef struct {
+    _Alignas(64) _Atomic uint64_t range; // Own cache line - the owner hits it every job
+} WorkerRange;
+
+typedef struct {
+    WorkerRange ranges[JOB_QUEUE_MAX_WORKERS];
+    int workers;
+    JobFn fn;
+    void* ctx;
+} JobQueue;
+
+typedef struct {
+    JobQueue* q;
+    int id;
+} Worker;
+
+static inline uint64_t pack(uint32_t lo, uint32_t hi) {
+    return lo | (uint64_t) hi << 32;
+}
+
+static bool take_own(JobQueue* q, int id, int* job) {
+    _Atomic uint64_t* r = &q->ranges[id].range;
+    uint64_t cur = atomic_load(r);
+    for (;;) {
+        uint32_t lo = (uint32_t) cur, hi = (uint32_t) (cur >> 32);
+        if (lo >= hi)
+            return false;
+        if (atomic_compare_exchange_weak(r, &cur, pack(lo + 1, hi))) {
+            *job = (int) lo;
+            return true;
+        }
+    }
+}
+
+// Moves the back half of the fullest other range into the (empty) own one
+static bool steal(JobQueue* q, int id) {
+    for (;;) {
+        int victim = -1;
+        uint32_t most = 0;
+        for (int k = 1; k < q->workers; k++) {
+            int v = (id + k) % q->workers;
+            uint64_t cur = atomic_load(&q->ranges[v].range);
+            uint32_t left = (uint32_t) (cur >> 32) - (uint32_t) cur;
+            if ((uint32_t) cur < (uint32_t) (cur >> 32) && left > most) {
+                most = left;
+                victim = v;
+            }
+        }
+        if (victim < 0)
+            return false; // Every range is empty: all jobs are taken
+
+        _Atomic uint64_t* r = &q->ranges[victim].range;
+        uint64_t cur = atomic_load(r);
+        uint32_t lo = (uint32_t) cur, hi = (uint32_t) (cur >> 32);
+        if (lo >= hi)
+            continue;
+        uint32_t split = lo + (hi - lo) / 2; // A last job is taken whole
+        if (atomic_compare_exchange_strong(r, &cur, pack(lo, split))) {
+            atomic_store(&q->ranges[id].range, pack(split, hi));
+            return true;
+        }
+    }
+}
+
+static void* worker_main(void* arg) {
+    Worker* w = arg;
+    int job;
+    do {
+        while (take_own(w->q, w->id, &job)) {
+            w->q->fn(job, w->id, w->q->ctx);
+        }
+    } while (steal(w->q, w->id));
+    return NULL;
+}
+
+void job_queue_run(int count, int threads, JobFn fn, void* ctx) {
+    // Per call, so concurrent runs (e.g. two Python threads in render_batch) stay apart.
+    // 16 KB of ranges is too much for a caller's stack; sizeof is a multiple of 64.
+    JobQueue* q = aligned_alloc(_Alignof(JobQueue), sizeof(JobQueue));
+    if (!q) {
+        for (int job = 0; job < count; job++) {
+            fn(job, 0, ctx);
+        }
+        return;
+    }
+    Worker workers[JOB_QUEUE_MAX_WORKERS];
+    pthread_t tids[JOB_QUEUE_MAX_WORKERS];
+
+    if (threads < 1)
+        threads = 1;
+    if (threads > JOB_QUEUE_MAX_WORKERS)
+        threads = JOB_QUEUE_MAX_WORKERS;
+
+    q->workers = threads;
+    q->fn = fn;
+    q->ctx = ctx;
+    for (int k = 0; k < threads; k++) {
+        uint32_t lo = (uint32_t) ((int64_t) count * k / threads);
+        uint32_t hi = (uint32_t) ((int64_t) count * (k + 1) / threads);
+        atomic_store(&q->ranges[k].range, pack(lo, hi));
+        workers[k] = (Worker) {q, k};
+    }
+
+    for (int k = 1; k < threads; k++) {
+        pthread_create(&tids[k], NULL, worker_main, &workers[k]);
+    }
+    worker_main(&workers[0]);
+    for (int k = 1; k < threads; k++) {
+        pthread_join(tids[k], NULL);
+    }
+    free(q);
+}
@@ -0,0 +1,18 @@
+#ifndef JOB_QUEUE_H
+#define JOB_QUEUE_H
+
+// Work-stealing job runner. Jobs [0, count) are split into one contiguous range per
+// worker. A worker takes jobs from the front of its own range, and once that is empty it
+// steals the back half of the fullest other range. Ranges are single 64-bit words updated
+// by CAS, so there are no locks. Render jobs vary in length by orders of magnitude
+// (a sweep over decay), so a static split would leave most cores idle at the end.
+
+typedef void (*JobFn)(int job, int worker, void* ctx);
+
+#define JOB_QUEUE_MAX_WORKERS 256
+
+// Runs fn once for every job on threads workers (the caller is worker 0), then returns.
+// Reentrant: each call has its own queue, so runs from several threads don't interfere.
+void job_queue_run(int count, int threads, JobFn fn, void* ctx);
+
+#endif
@@ -0,0 +1,158 @@
+// Offline batch renderer on the firmware's synthesis code - built by env:render:
+//     pio run -e render
+//     .pio/build/render/program [-j N] [-o dir] [--kernel fixed|float] [--pwm]
+//                               [--max-seconds s] jobs.txt...
+//
+// Renders every job in the job files (format in job_file.h, example in sweeps.txt) to
+// <dir>/<name>.wav at SAMPLE_RATE through waveform_voice_render_q15, the call the streaming
+// engine makes on the device, so the samples are the firmware's bit for bit. Jobs run on
+// all cores (-j) from a work-stealing queue and stream into memory-mapped WAV files.
+// --pwm writes undithered 8-bit PWM levels (pwm_level_q15) instead of 16-bit PCM. That is
+// not the device's output, which is soft clipped, noise-shaped and oversampled on the PWM.
+
+#include "job_file.h"
+#include "job_queue.h"
+#include "wav_writer.h"
+#include "wavegen/pwm_audio.h"
+#include "wavegen/waveform_gen.h"
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#define BLOCK 1024 // Samples per render call and WAV write
+#define DEFAULT_MAX_SECONDS 10.0f
+
+typedef struct {
+    _Alignas(64) long samples; // Per worker - no sharing on the hot path
+    int jobs;
+} WorkerStats;
+
+typedef struct {
+    const RenderJob* jobs;
+    const char* dir;
+    WavFormat format;
+    int max_samples;
+    WorkerStats stats[JOB_QUEUE_MAX_WORKERS];
+    atomic_int failures;
+} Batch;
+
+static void render_job(int job, int worker, void* ctx) {
+    Batch* b = ctx;
+    const RenderJob* j = &b->jobs[job];
+    int32_t q15[BLOCK];
+    char path[1024];
+    WaveVoice v;
+    WavWriter w;
+
+    waveform_voice_start(&v, &j->params);
+    int frames = (v.total_samples < b->max_samples) ? v.total_samples : b->max_samples;
+
+    snprintf(path, sizeof(path), "%s/%s.wav", b->dir, j->name);
+    if (!wav_open(&w, path, (uint32_t) SAMPLE_RATE, b->format, (uint32_t) frames)) {
+        fprintf(stderr, "%s: cannot write\n", path);
+        atomic_fetch_add(&b->failures, 1);
+        return;
+    }
+    for (int done = 0; done < frames; done += BLOCK) {
+        int n = (frames - done < BLOCK) ? frames - done : BLOCK;
+        waveform_voice_render_q15(&v, q15, n);
+        wav_write_q15(&w, q15, n);
+    }
+    if (!wav_close(&w)) {
+        fprintf(stderr, "%s: write failed\n", path);
+        atomic_fetch_add(&b->failures, 1);
+    }
+
+    b->stats[worker].samples += frames;
+    b->stats[worker].jobs++;
+}
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int usage(const char* prog) {
+    fprintf(stderr,
+            "usage: %s [-j threads] [-o dir] [--kernel fixed|float] [--pwm] "
+            "[--max-seconds s] jobs.txt...\n",
+            prog);
+    return 2;
+}
+
+int main(int argc, char** argv) {
+    static Batch b;
+    RenderJob* jobs = NULL;
+    int count = 0;
+    int threads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+    float max_seconds = DEFAULT_MAX_SECONDS;
+    WaveKernel kernel = WAVEGEN_KERNEL_DEFAULT;
+
+    b.dir = ".";
+    b.format = WAV_PCM16;
+    for (int i = 1; i < argc; i++) {
+        bool has_value = (i + 1 < argc);
+        if (!strcmp(argv[i], "-j") && has_value) {
+            threads = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "-o") && has_value) {
+            b.dir = argv[++i];
+        } else if (!strcmp(argv[i], "--kernel") && has_value) {
+            const char* k = argv[++i];
+            if (!strcmp(k, "fixed"))
+                kernel = WAVE_KERNEL_FIXED;
+            else if (!strcmp(k, "float"))
+                kernel = WAVE_KERNEL_FLOAT;
+            else
+                return usage(argv[0]);
+        } else if (!strcmp(argv[i], "--pwm")) {
+            b.format = WAV_PWM8;
+        } else if (!strcmp(argv[i], "--max-seconds") && has_value) {
+            max_seconds = strtof(argv[++i], NULL);
+        } else if (argv[i][0] == '-') {
+            return usage(argv[0]);
+        } else if (!job_file_load(argv[i], &jobs, &count)) {
+            return 1;
+        }
+    }
+    if (count == 0)
+        return usage(argv[0]);
+
+    if (threads < 1)
+        threads = 1;
+    if (threads > JOB_QUEUE_MAX_WORKERS)
+        threads = JOB_QUEUE_MAX_WORKERS;
+    mkdir(b.dir, 0755);
+
+    b.jobs = jobs;
+    b.max_samples = (int) (max_seconds * SAMPLE_RATE);
+    waveform_set_kernel(kernel); // Global - set before any worker starts
+
+    double start = now_s();
+    job_queue_run(count, threads, render_job, &b);
+    double elapsed = now_s() - start;
+
+    long samples = 0;
+    for (int i = 0; i < threads; i++) {
+        samples += b.stats[i].samples;
+    }
+    printf("%d jobs, %d threads, %.1f s of audio in %.3f s (%.0f samples/s, %.0fx real time)\n",
+           count, threads, samples / SAMPLE_RATE, elapsed, samples / elapsed,
+           samples / SAMPLE_RATE / elapsed);
+    if (threads > 1) {
+        for (int i = 0; i < threads; i++) {
+            printf("  worker %-3d %6d jobs %12ld samples\n", i, b.stats[i].jobs,
+                   b.stats[i].samples);
+        }
+    }
+
+    free(jobs);
+    int failures = atomic_load(&b.failures);
+    if (failures)
+        fprintf(stderr, "%d jobs failed\n", failures);
+    return failures ? 1 : 0;
+}
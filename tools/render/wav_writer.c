@@ -0,0 +1,91 @@
+#include "wav_writer.h"
+#include "wavegen/pwm_audio.h"
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#define WAV_HEADER 44
+
+static uint8_t* put_u32(uint8_t* p, uint32_t v) {
+    p[0] = (uint8_t) v;
+    p[1] = (uint8_t) (v >> 8);
+    p[2] = (uint8_t) (v >> 16);
+    p[3] = (uint8_t) (v >> 24);
+    return p + 4;
+}
+
+static uint8_t* put_u16(uint8_t* p, uint16_t v) {
+    p[0] = (uint8_t) v;
+    p[1] = (uint8_t) (v >> 8);
+    return p + 2;
+}
+
+static void write_header(uint8_t* p, uint32_t rate, int bytes, uint32_t frames) {
+    uint32_t data = frames * (uint32_t) bytes;
+
+    memcpy(p, "RIFF", 4);
+    p = put_u32(p + 4, 36 + data);
+    memcpy(p, "WAVEfmt ", 8);
+    p = put_u32(p + 8, 16);
+    p = put_u16(p, 1); // PCM
+    p = put_u16(p, 1); // Mono
+    p = put_u32(p, rate);
+    p = put_u32(p, rate * (uint32_t) bytes);
+    p = put_u16(p, (uint16_t) bytes);
+    p = put_u16(p, (uint16_t) (bytes * 8));
+    memcpy(p, "data", 4);
+    put_u32(p + 4, data);
+}
+
+bool wav_open(WavWriter* w, const char* path, uint32_t rate, WavFormat format, uint32_t frames) {
+    int bytes = (format == WAV_PCM16) ? 2 : 1;
+
+    w->format = format;
+    w->frames = frames;
+    w->pos = 0;
+    w->size = WAV_HEADER + (size_t) frames * bytes;
+    w->fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (w->fd < 0)
+        return false;
+
+    if (ftruncate(w->fd, (off_t) w->size) != 0) {
+        close(w->fd);
+        return false;
+    }
+    w->map = mmap(NULL, w->size, PROT_READ | PROT_WRITE, MAP_SHARED, w->fd, 0);
+    if (w->map == MAP_FAILED) {
+        close(w->fd);
+        return false;
+    }
+    madvise(w->map, w->size, MADV_SEQUENTIAL);
+
+    write_header(w->map, rate, bytes, frames);
+    return true;
+}
+
+void wav_write_q15(WavWriter* w, const int32_t* q15, int n) {
+    if (n > (int) (w->frames - w->pos))
+        n = (int) (w->frames - w->pos);
+
+    uint8_t* out = w->map + WAV_HEADER;
+    if (w->format == WAV_PCM16) {
+        out += (size_t) w->pos * 2;
+        for (int i = 0; i < n; i++) {
+            int32_t x = (q15[i] > 32767) ? 32767 : (q15[i] < -32768) ? -32768 : q15[i];
+            put_u16(out + 2 * i, (uint16_t) x);
+        }
+    } else {
+        out += w->pos;
+        for (int i = 0; i < n; i++) {
+            out[i] = (uint8_t) pwm_level_q15(q15[i]);
+        }
+    }
+    w->pos += (uint32_t) n;
+}
+
+bool wav_close(WavWriter* w) {
+    bool ok = (munmap(w->map, w->size) == 0);
+    ok &= (close(w->fd) == 0);
+    return ok;
+}
@@ -0,0 +1,30 @@
+#ifndef WAV_WRITER_H
+#define WAV_WRITER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Mono WAV file written through a shared memory mapping: the file is sized up front from
+// the frame count, so samples are converted straight into the page cache with no stdio
+// buffering or write() calls, and the kernel flushes it in the background.
+
+typedef enum {
+    WAV_PCM16, // Q15 samples, saturated to 16 bits
+    WAV_PWM8   // Undithered PWM levels (pwm_level_q15, 0..PWM_WRAP) as 8-bit unsigned PCM
+} WavFormat;
+
+typedef struct {
+    int fd;
+    uint8_t* map;
+    size_t size;
+    WavFormat format;
+    uint32_t frames; // Capacity
+    uint32_t pos;    // Frames written
+} WavWriter;
+
+bool wav_open(WavWriter* w, const char* path, uint32_t rate, WavFormat format, uint32_t frames);
+void wav_write_q15(WavWriter* w, const int32_t* q15, int n); // Drops frames past the capacity
+bool wav_close(WavWriter* w);
+
+#endif